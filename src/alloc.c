@@ -0,0 +1,455 @@
+/**
+ * @file alloc.c
+ * @brief BIGNUM / GF2N 배열 (Num) 할당자
+ * @details
+ * - 할당자 hook (UW_ALLOC) : 전역 / 스레드별 / BN_CTX 별 지정, 지정하지 않으면 calloc / realloc / free
+ * - BIGNUM / GF2N 는 생성 시점의 할당자를 저장 -> 재할당 / 해제 모두 같은 할당자 사용
+ * - bump arena (UW_ARENA) : 포인터 증가 할당, UW_Arena_Reset 으로 일괄 해제, 스레드별 arena (UW_Arena_Thread)
+ * - size-class pool (UW_SLAB) : cache line 정렬 블록, 크기 등급별 free list
+ * - arena / slab 은 lock 없음 (스레드마다 생성해서 사용)
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include <string.h>
+#include "alloc.h"
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+// ALLOC_LINE 배수로 올림
+#define LINE_UP(x)		(((x) + ALLOC_LINE - 1) & ~(size_t)(ALLOC_LINE - 1))
+
+static const UW_ALLOC			*Alloc_Global = NULL;	// 전역 할당자
+static UW_TLS const UW_ALLOC	*Alloc_Thread = NULL;	// 스레드별 할당자 (전역보다 우선)
+static UW_TLS UW_ARENA			*Arena_Thread = NULL;	// 스레드별 arena
+
+// cache line 정렬 할당 (size : ALLOC_LINE 배수)
+static void *Mem_Line_Alloc(const size_t size)
+{
+#if defined(_MSC_VER)
+	return _aligned_malloc(size, ALLOC_LINE);
+#else
+	return aligned_alloc(ALLOC_LINE, size);
+#endif
+}
+
+static void Mem_Line_Free(void *p)
+{
+#if defined(_MSC_VER)
+	_aligned_free(p);
+#else
+	free(p);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Set global allocator
+ * @details
+ * - 이후 생성되는 BIGNUM / GF2N / BN_CTX 의 배열 할당자 (스레드별 할당자가 없는 경우) \n
+ * - NULL 이면 calloc / realloc / free \n
+ * - 이미 생성된 값은 생성 시점의 할당자 유지 \n
+ * @param[in] UW_ALLOC *alloc (const)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Alloc_Set(const UW_ALLOC *alloc)
+{
+	Alloc_Global = alloc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Set allocator of calling thread
+ * @details
+ * - 호출 스레드에서 이후 생성되는 BIGNUM / GF2N / BN_CTX 의 배열 할당자 (전역 할당자보다 우선) \n
+ * - NULL 이면 전역 할당자 사용 \n
+ * @param[in] UW_ALLOC *alloc (const)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Alloc_Set_Thread(const UW_ALLOC *alloc)
+{
+	Alloc_Thread = alloc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Get current allocator
+ * @return UW_ALLOC * 스레드별 할당자 > 전역 할당자 > NULL (calloc / realloc / free)
+ * @date 2026. 10. 17. \n
+ */
+const UW_ALLOC *UW_Alloc_Get(void)
+{
+	return (Alloc_Thread != NULL) ? Alloc_Thread : Alloc_Global;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Allocate WORD array
+ * @details
+ * - len 개 WORD 배열 할당 후 0 초기화 (calloc) \n
+ * @param[in] UW_ALLOC *alloc (const) NULL 이면 calloc
+ * @param[in] UNWORD len (const)
+ * @return UNWORD * 배열 (실패 시 NULL)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD *UW_Mem_Alloc(const UW_ALLOC *alloc, const UNWORD len)
+{
+	UNWORD *p;
+
+	if(alloc == NULL)
+		return (UNWORD *)calloc(len, sizeof(UNWORD));
+
+	p = (UNWORD *)alloc->Alloc(alloc->State, len * sizeof(UNWORD));
+	if(p != NULL)
+		memset(p, 0, len * sizeof(UNWORD));
+	return p;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Reallocate WORD array
+ * @details
+ * - realloc 과 동일 : min(old_len, len) 개 WORD 유지, 늘어난 부분 초기화 X \n
+ * - p == NULL 이면 새로 할당 \n
+ * @param[in] UW_ALLOC *alloc (const) NULL 이면 realloc
+ * @param[in] UNWORD *p
+ * @param[in] UNWORD old_len (const) 기존 배열 크기
+ * @param[in] UNWORD len (const) 새 배열 크기
+ * @return UNWORD * 배열 (실패 시 NULL)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD *UW_Mem_Realloc(const UW_ALLOC *alloc, UNWORD *p, const UNWORD old_len, const UNWORD len)
+{
+	UNWORD *q;
+
+	if(alloc == NULL)
+		return (UNWORD *)realloc(p, len * sizeof(UNWORD));
+	if(alloc->Realloc != NULL)
+		return (UNWORD *)alloc->Realloc(alloc->State, p, old_len * sizeof(UNWORD), len * sizeof(UNWORD));
+
+	q = (UNWORD *)alloc->Alloc(alloc->State, len * sizeof(UNWORD));
+	if((q != NULL) && (p != NULL))
+	{
+		memcpy(q, p, ((old_len < len) ? old_len : len) * sizeof(UNWORD));
+		alloc->Free(alloc->State, p, old_len * sizeof(UNWORD));
+	}
+	return q;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Free WORD array
+ * @param[in] UW_ALLOC *alloc (const) NULL 이면 free
+ * @param[in] UNWORD *p
+ * @param[in] UNWORD len (const) 배열 크기
+ * @date 2026. 10. 17. \n
+ */
+void UW_Mem_Free(const UW_ALLOC *alloc, UNWORD *p, const UNWORD len)
+{
+	if(alloc == NULL)
+		free(p);
+	else if(p != NULL)
+		alloc->Free(alloc->State, p, len * sizeof(UNWORD));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// bump arena
+
+static void *Arena_Alloc(void *state, size_t size)
+{
+	UW_ARENA *a = (UW_ARENA *)state;
+	UCHAR *c, *p;
+	size_t csize;
+
+	// 크기 0 블록도 서로 다른 주소 (제자리 Realloc 시 겹침 방지)
+	size = (size == 0) ? ALLOC_LINE : LINE_UP(size);
+
+	// 현재 chunk 부족 -> 새 chunk (이전 chunk 는 Reset / Free 까지 유지)
+	if((a->Chunk == NULL) || (a->Used + size > a->Size))
+	{
+		csize = (size + ALLOC_LINE > a->Chunk_Size) ? (size + ALLOC_LINE) : a->Chunk_Size;
+		c = (UCHAR *)Mem_Line_Alloc(csize);
+		if(c == NULL)
+			return NULL;
+		((UCHAR **)c)[0] = a->Chunk;
+		a->Chunk = c;
+		a->Used = ALLOC_LINE;
+		a->Size = csize;
+	}
+
+	p = a->Chunk + a->Used;
+	a->Used += size;
+	a->Last = p;
+	return p;
+}
+
+static void *Arena_Realloc(void *state, void *p, size_t old_size, size_t size)
+{
+	UW_ARENA *a = (UW_ARENA *)state;
+	size_t end;
+	void *q;
+
+	if(p == NULL)
+		return Arena_Alloc(state, size);
+
+	// 마지막 블록 -> 제자리에서 크기 변경
+	if((UCHAR *)p == a->Last)
+	{
+		end = (size_t)(a->Last - a->Chunk) + ((size == 0) ? ALLOC_LINE : LINE_UP(size));
+		if(end <= a->Size)
+		{
+			a->Used = end;
+			return p;
+		}
+	}
+
+	q = Arena_Alloc(state, size);
+	if(q != NULL)
+		memcpy(q, p, (old_size < size) ? old_size : size);
+	return q;
+}
+
+static void Arena_Free(void *state, void *p, size_t size)
+{
+	UW_ARENA *a = (UW_ARENA *)state;
+
+	(void)size;
+	// 마지막 블록만 되돌림 (그 외는 Reset 까지 유지)
+	if((UCHAR *)p == a->Last)
+	{
+		a->Used = (size_t)(a->Last - a->Chunk);
+		a->Last = NULL;
+	}
+}
+
+/**
+ * @brief Initialize bump arena
+ * @details
+ * - chunk_size 단위로 메모리 확보 (0 이면 ARENA_CHUNK_SIZE), chunk 는 첫 할당 시 생성 \n
+ * - &arena->Alloc 을 UW_Alloc_Set / UW_Alloc_Set_Thread / BN_CTX_Set_Alloc 에 전달 \n
+ * @param[out] UW_ARENA *arena
+ * @param[in] size_t chunk_size (const)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Arena_Init(UW_ARENA *arena, const size_t chunk_size)
+{
+	arena->Alloc.Alloc = Arena_Alloc;
+	arena->Alloc.Realloc = Arena_Realloc;
+	arena->Alloc.Free = Arena_Free;
+	arena->Alloc.State = arena;
+	arena->Chunk = NULL;
+	arena->Last = NULL;
+	arena->Used = arena->Size = 0;
+	arena->Chunk_Size = (chunk_size == 0) ? ARENA_CHUNK_SIZE : LINE_UP(chunk_size);
+}
+
+/**
+ * @brief Reset bump arena
+ * @details
+ * - arena 에서 할당된 모든 배열 일괄 해제 (마지막 chunk 는 유지, 재사용) \n
+ * - Reset 이전에 arena 로 생성된 BIGNUM / GF2N / BN_CTX 사용 X (다시 Init 해서 사용) \n
+ * @param[in,out] UW_ARENA *arena
+ * @date 2026. 10. 17. \n
+ */
+void UW_Arena_Reset(UW_ARENA *arena)
+{
+	UCHAR *c, *prev;
+
+	if(arena->Chunk == NULL)
+		return;
+
+	c = ((UCHAR **)arena->Chunk)[0];
+	while(c != NULL)
+	{
+		prev = ((UCHAR **)c)[0];
+		Mem_Line_Free(c);
+		c = prev;
+	}
+	((UCHAR **)arena->Chunk)[0] = NULL;
+	arena->Used = ALLOC_LINE;
+	arena->Last = NULL;
+}
+
+/**
+ * @brief Free bump arena
+ * @details
+ * - 모든 chunk 해제 (UW_Arena_Init 상태) \n
+ * @param[in,out] UW_ARENA *arena
+ * @date 2026. 10. 17. \n
+ */
+void UW_Arena_Free(UW_ARENA *arena)
+{
+	UCHAR *c = arena->Chunk, *prev;
+
+	while(c != NULL)
+	{
+		prev = ((UCHAR **)c)[0];
+		Mem_Line_Free(c);
+		c = prev;
+	}
+	UW_Arena_Init(arena, arena->Chunk_Size);
+}
+
+/**
+ * @brief Bump arena of calling thread
+ * @details
+ * - 스레드마다 하나씩 생성 (첫 호출 시, chunk 크기 ARENA_CHUNK_SIZE) \n
+ * - UW_Alloc_Set_Thread(&UW_Arena_Thread()->Alloc) 후 요청 하나 처리, UW_Arena_Reset 으로 일괄 해제 \n
+ * - 스레드 종료 전 UW_Arena_Thread_Free 호출 \n
+ * @return UW_ARENA * 호출 스레드의 arena (실패 시 NULL)
+ * @date 2026. 10. 17. \n
+ */
+UW_ARENA *UW_Arena_Thread(void)
+{
+	if(Arena_Thread == NULL)
+	{
+		Arena_Thread = (UW_ARENA *)malloc(sizeof(UW_ARENA));
+		if(Arena_Thread != NULL)
+			UW_Arena_Init(Arena_Thread, ARENA_CHUNK_SIZE);
+	}
+	return Arena_Thread;
+}
+
+/**
+ * @brief Free bump arena of calling thread
+ * @details
+ * - 호출 스레드의 할당자가 이 arena 이면 할당자도 해제 (전역 할당자 사용) \n
+ * @date 2026. 10. 17. \n
+ */
+void UW_Arena_Thread_Free(void)
+{
+	if(Arena_Thread == NULL)
+		return;
+
+	if(Alloc_Thread == &Arena_Thread->Alloc)
+		Alloc_Thread = NULL;
+	UW_Arena_Free(Arena_Thread);
+	free(Arena_Thread);
+	Arena_Thread = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// size-class pool
+
+// 크기 등급 (ALLOC_LINE << k >= size 인 최소 k, 등급보다 크면 SLAB_CLASSES)
+static UNWORD Slab_Class(const size_t size)
+{
+	UNWORD k = 0;
+
+	while((k < SLAB_CLASSES) && (((size_t)ALLOC_LINE << k) < size))
+		k++;
+	return k;
+}
+
+static void *Slab_Alloc(void *state, size_t size)
+{
+	UW_SLAB *s = (UW_SLAB *)state;
+	UNWORD k = Slab_Class(size);
+	size_t block, bytes, i;
+	UCHAR *slab;
+	void *p;
+
+	// 큰 블록 -> 직접 할당
+	if(k == SLAB_CLASSES)
+		return Mem_Line_Alloc(LINE_UP(size));
+
+	// free list 비어 있으면 slab 하나 할당해서 블록 단위로 분할
+	if(s->Head[k] == NULL)
+	{
+		block = (size_t)ALLOC_LINE << k;
+		bytes = (block > SLAB_SIZE) ? block : SLAB_SIZE;
+		slab = (UCHAR *)Mem_Line_Alloc(bytes + ALLOC_LINE);
+		if(slab == NULL)
+			return NULL;
+		*(void **)slab = s->Slab;
+		s->Slab = slab;
+		for(i = bytes ; i >= block ; i -= block)
+		{
+			p = slab + ALLOC_LINE + i - block;
+			*(void **)p = s->Head[k];
+			s->Head[k] = p;
+		}
+	}
+
+	p = s->Head[k];
+	s->Head[k] = *(void **)p;
+	return p;
+}
+
+static void Slab_Free(void *state, void *p, size_t size)
+{
+	UW_SLAB *s = (UW_SLAB *)state;
+	UNWORD k = Slab_Class(size);
+
+	if(k == SLAB_CLASSES)
+		Mem_Line_Free(p);
+	else
+	{
+		*(void **)p = s->Head[k];
+		s->Head[k] = p;
+	}
+}
+
+static void *Slab_Realloc(void *state, void *p, size_t old_size, size_t size)
+{
+	UNWORD k = Slab_Class(size);
+	void *q;
+
+	if(p == NULL)
+		return Slab_Alloc(state, size);
+	// 같은 등급 -> 블록 그대로 사용
+	if((k < SLAB_CLASSES) && (k == Slab_Class(old_size)))
+		return p;
+
+	q = Slab_Alloc(state, size);
+	if(q != NULL)
+	{
+		memcpy(q, p, (old_size < size) ? old_size : size);
+		Slab_Free(state, p, old_size);
+	}
+	return q;
+}
+
+/**
+ * @brief Initialize size-class pool
+ * @details
+ * - ALLOC_LINE 정렬 블록 (64 B ~ 128 KiB, 2 배 간격 등급), 그보다 큰 배열은 직접 할당 \n
+ * - &slab->Alloc 을 UW_Alloc_Set / UW_Alloc_Set_Thread / BN_CTX_Set_Alloc 에 전달 \n
+ * @param[out] UW_SLAB *slab
+ * @date 2026. 10. 17. \n
+ */
+void UW_Slab_Init(UW_SLAB *slab)
+{
+	UNWORD k;
+
+	slab->Alloc.Alloc = Slab_Alloc;
+	slab->Alloc.Realloc = Slab_Realloc;
+	slab->Alloc.Free = Slab_Free;
+	slab->Alloc.State = slab;
+	for(k = 0 ; k < SLAB_CLASSES ; k++)
+		slab->Head[k] = NULL;
+	slab->Slab = NULL;
+}
+
+/**
+ * @brief Free size-class pool
+ * @details
+ * - 모든 slab 해제 (UW_Slab_Init 상태), 직접 할당된 큰 배열은 각 값의 Free 에서 해제 \n
+ * @param[in,out] UW_SLAB *slab
+ * @date 2026. 10. 17. \n
+ */
+void UW_Slab_Free(UW_SLAB *slab)
+{
+	void *s = slab->Slab, *next;
+
+	while(s != NULL)
+	{
+		next = *(void **)s;
+		Mem_Line_Free(s);
+		s = next;
+	}
+	UW_Slab_Init(slab);
+}
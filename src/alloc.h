@@ -0,0 +1,73 @@
+#ifndef _ALLOC_H_
+#define _ALLOC_H_
+
+#include "config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 스레드 지역 변수
+#if defined(_MSC_VER)
+#define UW_TLS			__declspec(thread)
+#else
+#define UW_TLS			__thread
+#endif
+
+#define ALLOC_LINE			64			// cache line 크기 (arena / slab 블록 정렬 단위)
+#define ARENA_CHUNK_SIZE	(1 << 16)	// arena chunk 기본 크기 (bytes)
+#define SLAB_CLASSES		12			// slab 크기 등급 개수 (ALLOC_LINE << 0 ~ ALLOC_LINE << 11 : 64 B ~ 128 KiB)
+#define SLAB_SIZE			(1 << 16)	// slab 하나 기본 크기 (bytes)
+
+// BIGNUM / GF2N 배열 (Num) 할당자 hook
+// - size 는 byte 단위, Free / Realloc 의 old_size 는 할당 시 크기 (배열 크기 Top 기준)
+// - Realloc == NULL 이면 Alloc + 복사 + Free 사용
+typedef struct _UW_ALLOC
+{
+	void	*(*Alloc)(void *state, size_t size);
+	void	*(*Realloc)(void *state, void *p, size_t old_size, size_t size);
+	void	(*Free)(void *state, void *p, size_t size);
+	void	*State;				// 할당자 상태 (함수 첫 번째 인자)
+} UW_ALLOC;
+
+// bump arena : 할당은 포인터 증가, 개별 해제 X (마지막 블록만 되돌림), UW_Arena_Reset 으로 일괄 해제
+typedef struct _UW_ARENA
+{
+	UW_ALLOC	Alloc;			// 할당자 hook (&arena->Alloc 전달)
+	UCHAR	*Chunk;				// 현재 chunk (첫 ALLOC_LINE bytes : 이전 chunk, chunk 크기)
+	UCHAR	*Last;				// 마지막 할당 블록 (제자리 Realloc / Free)
+	size_t	Used;				// 현재 chunk 사용량
+	size_t	Size;				// 현재 chunk 크기
+	size_t	Chunk_Size;			// chunk 기본 크기
+} UW_ARENA;
+
+// size-class pool : ALLOC_LINE 정렬 블록, 크기 등급별 free list (등급보다 큰 블록은 직접 할당)
+typedef struct _UW_SLAB
+{
+	UW_ALLOC	Alloc;			// 할당자 hook (&slab->Alloc 전달)
+	void	*Head[SLAB_CLASSES];	// 등급별 free list
+	void	*Slab;				// 할당된 slab 목록 (첫 ALLOC_LINE bytes : 다음 slab)
+} UW_SLAB;
+
+void UW_Alloc_Set(const UW_ALLOC *alloc);
+void UW_Alloc_Set_Thread(const UW_ALLOC *alloc);
+const UW_ALLOC *UW_Alloc_Get(void);
+
+UNWORD *UW_Mem_Alloc(const UW_ALLOC *alloc, const UNWORD len);
+UNWORD *UW_Mem_Realloc(const UW_ALLOC *alloc, UNWORD *p, const UNWORD old_len, const UNWORD len);
+void UW_Mem_Free(const UW_ALLOC *alloc, UNWORD *p, const UNWORD len);
+
+void UW_Arena_Init(UW_ARENA *arena, const size_t chunk_size);
+void UW_Arena_Reset(UW_ARENA *arena);
+void UW_Arena_Free(UW_ARENA *arena);
+UW_ARENA *UW_Arena_Thread(void);
+void UW_Arena_Thread_Free(void);
+
+void UW_Slab_Init(UW_SLAB *slab);
+void UW_Slab_Free(UW_SLAB *slab);
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
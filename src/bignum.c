@@ -23,6 +23,9 @@
 #include "bignum.h"
 #include "word.h"
 
+// BN_SBO 내부 배열 표시 (Alloc 비교용, 함수 호출 X)
+const UW_ALLOC BN_SBO_Alloc = { NULL, NULL, NULL, NULL };
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /**
  * @brief Initialize to BIGNUM
@@ -37,7 +40,8 @@
  */
 void BN_Init(BIGNUM *A, const UNWORD len, const SNWORD sign, const SNWORD flag)
 {
-	A->Num = (UNWORD *)calloc(len, sizeof(UNWORD)); 
+	A->Alloc = UW_Alloc_Get();
+	A->Num = UW_Mem_Alloc(A->Alloc, len); 
 	A->Top = A->Length = len; 
 	A->Sign = sign;
 	A->Flag = flag;
@@ -56,7 +60,8 @@ void BN_Init(BIGNUM *A, const UNWORD len, const SNWORD sign, const SNWORD flag)
  */
 void BN_Init_Zero(BIGNUM *A)
 {	
-	A->Num = (UNWORD *)calloc(1, sizeof(UNWORD));
+	A->Alloc = UW_Alloc_Get();
+	A->Num = UW_Mem_Alloc(A->Alloc, 1);
 	A->Top = 1;			// 실제 할당된 배열 크기
 	A->Length = 0; 		// 값이 들어있는 배열 크기
 	A->Sign = ZERO;
@@ -75,7 +80,8 @@ void BN_Init_Zero(BIGNUM *A)
  */
 void BN_Init_One(BIGNUM *A)
 {	
-	A->Num = (UNWORD *)calloc(1, sizeof(UNWORD));
+	A->Alloc = UW_Alloc_Get();
+	A->Num = UW_Mem_Alloc(A->Alloc, 1);
 	A->Num[0] = 1;
 	A->Top = A->Length = 1;
 	A->Sign	= PLUS;
@@ -113,11 +119,50 @@ void BN_Init_Rand(BIGNUM *A, const UNWORD maxsize)
  */
 void BN_Init_Copy(BIGNUM *R, const BIGNUM *A)
 {
-	// A 와 배열 크기 같은 BIGNUM 생성
-	BN_Init(R, A->Top, A->Sign, A->Flag);
+	// A 의 값 크기 (Length, 최소 1) 만큼 BIGNUM 생성
+	BN_Init(R, (A->Length == 0) ? 1 : A->Length, A->Sign, A->Flag);
 	BN_Copy(R, A); // 값 복사
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Initialize to Zero BN_SBO (내부 배열 BIGNUM)
+ * @details
+ * - 메모리 할당 X, Num = 내부 배열 (Top = BN_SBO_WORDS) \n
+ * - Length = 0, Sign = ZERO, Flag = DEFAULT \n
+ * - 값이 BN_SBO_WORDS 보다 커지면 BN_Realloc_Mem 에서 heap 으로 이동 (BN_Free 로 해제) \n
+ * @param[out] BN_SBO *A
+ * @date 2026. 10. 17. \n
+ */
+void BN_SBO_Init(BN_SBO *A)
+{
+	UNWORD i;
+
+	for(i = 0 ; i < BN_SBO_WORDS ; i++)
+		A->Buf[i] = 0;
+	A->BN.Num = A->Buf;
+	A->BN.Top = BN_SBO_WORDS;
+	A->BN.Length = 0;
+	A->BN.Sign = ZERO;
+	A->BN.Flag = DEFAULT;
+	A->BN.Alloc = &BN_SBO_Alloc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Initialize BN_SBO and Copy BIGNUM *A to *R
+ * @details
+ * - BN_SBO_Init 후 BN_Copy (A->Length > BN_SBO_WORDS 이면 heap 사용) \n
+ * @param[out] BN_SBO *R
+ * @param[in] BIGNUM *A (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_SBO_Init_Copy(BN_SBO *R, const BIGNUM *A)
+{
+	BN_SBO_Init(R);
+	BN_Copy(&R->BN, A);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /**
  * @brief Randomize BIGNUM
@@ -131,7 +176,7 @@ void BN_Init_Copy(BIGNUM *R, const BIGNUM *A)
 void BN_Randomize(BIGNUM *A)
 {
 	UNWORD i, j;	 
-	for(i = 0 ; i < A->Top ; i++)
+	for(i = 0 ; i < A->Length ; i++)
 		for(j = 0 ; j < BIT_LEN ; j++)
 		{
 			A->Num[i] <<= 8;
@@ -147,13 +192,16 @@ void BN_Randomize(BIGNUM *A)
  * @details 
  * - BIGNUM *A 를 0 으로 변경 \n
  * - 메모리 재할당 (크기, 부호 변경), Length = 1 \n
+ * - 내부 배열 (BN_SBO) 인 경우 재할당 X \n
  * @param[in,out] BIGNUM *A 
  * @date 2017. 04. 17. \n
  */
 void BN_Zero(BIGNUM *A)
 {		
 	BN_Zeroize(A);
-	A->Num = (UNWORD *)realloc(A->Num, sizeof(UNWORD)); 
+	if(A->Alloc == &BN_SBO_Alloc)
+		return;
+	A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, 1); 
 	A->Top = 1; // Top = 1, Length = 0
 }
 
@@ -178,20 +226,20 @@ void BN_Zeroize(BIGNUM *A)
 /**
  * @brief BIGNUM Copy A to R
  * @details
- * - BIGNUM *A 값을 BIGNUM *R 로 복사 (*A 와 동일 크기 *R 출력) \n
- * - 내부에서 BIGNUM *A 와 동일한 크기 BIGNUM *R 재할당 \n
+ * - BIGNUM *A 값을 BIGNUM *R 로 복사 (A->Length 개 WORD 복사) \n
+ * - *R 배열 크기가 A->Length 보다 작은 경우만 재할당 (배열 크기 유지) \n
  * @param[in,out] BIGNUM *R
  * @param[in] BIGNUM *A (const)
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. 배열 크기 유지 (A->Top 크기로 재할당 X) \n
  */
 void BN_Copy(BIGNUM *R, const BIGNUM *A)
 {
-	UNWORD i;		
-	// *R 배열 크기와 *A 배열 크기가 다르면 동일한 크기인 0 배열로 재할당
-	if(R->Top != A->Top)
-		BN_Zero_Realloc_Mem(R, A->Top);
-	// 값 복사 (R->Top = A->Top 상태)
-	for(i = R->Top ; i > 0 ; i--) 
+	UNWORD i;
+	// *R 배열 크기가 작으면 재할당, 크면 A->Length 이상 이전 값 0 초기화
+	BN_Result_Size(R, A->Length);
+	// 값 복사
+	for(i = A->Length ; i > 0 ; i--)
 		R->Num[i - 1] = A->Num[i - 1];
 	// 나머지 복사
 	R->Length = A->Length;
@@ -206,6 +254,7 @@ void BN_Copy(BIGNUM *R, const BIGNUM *A)
  * - 입력 받은 사이즈 이상의 값은 0 초기화 \n
  * - 나머지 값은 기존의 값 유지 \n
  * - BIGNUM *A 메모리를 입력받은 크기와 동일하게 재할당 \n
+ * - 내부 배열 (BN_SBO) 인 경우 줄이기 X, 늘리는 경우 현재 할당자 (UW_Alloc_Get) 로 heap 배열 할당 후 복사 \n
  * @param[out] BIGNUM *A
  * @param[in] UNWORD size (const)
  * @date 2017. 04. 17. \n 
@@ -213,6 +262,7 @@ void BN_Copy(BIGNUM *R, const BIGNUM *A)
 void BN_Realloc_Mem(BIGNUM *A, const UNWORD size)
 {	
 	UNWORD i;	
+	UNWORD *tmp;
 	if(size == 0)
 		BN_Zero(A);
 	else if(A->Top > size)
@@ -220,16 +270,29 @@ void BN_Realloc_Mem(BIGNUM *A, const UNWORD size)
 		// 입력받은 size 크기 보다 큰 값들을 0 으로 세팅 후
 		for(i = A->Top ; i > size ; i--)
 			A->Num[i - 1] = 0;
-		A->Top = A->Length = size;
-		A->Num = (UNWORD *)realloc(A->Num, (A->Top * sizeof(UNWORD)));
+		if(A->Length > size)
+			A->Length = size;
+		if(A->Alloc == &BN_SBO_Alloc) // 내부 배열 크기 유지
+			return;
+		A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, size);
+		A->Top = size;
 	}
 	else if(A->Top < size)
 	{
 		// 메모리만 재할당 (항상 size > 0)
-		A->Num = (UNWORD *)realloc(A->Num, (size * sizeof(UNWORD)));
+		if(A->Alloc == &BN_SBO_Alloc) // 내부 배열 -> heap 이동
+		{
+			A->Alloc = UW_Alloc_Get();
+			tmp = UW_Mem_Alloc(A->Alloc, size);
+			for(i = 0 ; i < A->Top ; i++)
+				tmp[i] = A->Num[i];
+			A->Num = tmp;
+		}
+		else
+			A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, size);
 		// 재할당 받은 배열 값 0 으로 세팅
 		for(i = A->Top ; i < size ; i++)
-			A->Num[i - 1] = 0;
+			A->Num[i] = 0;
 		A->Top = size; // A->Length = 기존 값 유지
 	}	
 }
@@ -257,24 +320,17 @@ void BN_Zero_Realloc_Mem(BIGNUM *A, const UNWORD size)
 /**
  * @brief Top Check of BIGNUM *A
  * @details
- * - BIGNUM *A 입력 값의 배열 크기 최적화 \n
- * - A->Top != A->Length 인 경우 메모리 재할당 (A->Top == A->Length) \n
- * - BIGNUM *A 가 빈 배열이면 메모리 할당
+ * - BIGNUM *A 가 빈 배열이면 메모리 할당 \n
+ * - 배열 크기 (Top) 는 줄이지 않음 (배열 크기 줄이기 : BN_Shrink) \n
  * @param[in, out] BIGNUM *A
  * @date 2017. 04. 17. \n
- * @todo 경우 더 생각해보기
+ * @date 2026. 10. 17. Top = Length 재할당 제거 \n
  */
 void BN_Top_Check(BIGNUM *A)
-{	
-	// TODO 
-
+{
 	// BIGNUM *A 의 메모리가 할당되지 않은 경우
 	if(A->Top == 0)
 		BN_Init_Zero(A);
-	
-	// 실제 할당된 배열 크기와 값이 들어있는 배열 크기 다르면 재할당
-	if((A->Top != A->Length) && (A->Length != 0))
-		BN_Realloc_Mem(A, A->Length);	
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,51 +338,68 @@ void BN_Top_Check(BIGNUM *A)
  * @brief Result size check of BIGNUM *A
  * @details
  * - 연산의 결과 값의 배열 크기 체크 \n
- * - A->Top 크기가 입력된 연산의 출력 크기 보다 작으면 메모리 재할당 \n
- * - BIGNUM *A 가 빈 배열이면 메모리 할당
+ * - A->Top 크기가 입력된 연산의 출력 크기 보다 작으면 메모리 재할당 (배열 크기 줄이지 않음) \n
+ * - 재할당 X 인 경우 이전 값의 size 이상 WORD 0 초기화 (Length 이상 WORD 는 항상 0) \n
+ * - BIGNUM *A 가 빈 배열이면 메모리 할당 \n
+ * - 호출 후 연산에서 [0, size) WORD 를 모두 쓰고 Length 설정 \n
  * @param[in, out] BIGNUM *A
+ * @param[in] UNWORD size (const) 연산 결과 최대 WORD 개수
  * @date 2017. 04. 17. \n
- * @todo 경우 더 생각해보기
+ * @date 2026. 10. 17. 빈 배열도 size 만큼 할당, 이전 값 0 초기화 \n
  */
 void BN_Result_Size(BIGNUM *A, const UNWORD size)
-{	
-	// TODO 
+{
+	UNWORD i;
 
 	// BIGNUM *A 의 메모리가 할당되지 않은 경우
 	if(A->Top == 0)
 		BN_Init_Zero(A);
-	else if(A->Top < size) // (A->Top >= size) 인 경우 재할당 X
-		BN_Realloc_Mem(A, size); // 
+
+	if(A->Top < size) // 재할당 (늘어난 배열 0 초기화)
+		BN_Realloc_Mem(A, size);
+	else if(A->Length > size) // (A->Top >= size) 인 경우 재할당 X, 결과보다 긴 이전 값만 0 초기화
+	{
+		for(i = size ; i < A->Length ; i++)
+			A->Num[i] = 0;
+		A->Length = size;
+	}
 }
 
 /**
  * @brief Optimize Output of BIGNUM *A
  * @details
- * - BIGNUM *A 값의 크기 최적화 출력 (Memory, Length)
+ * - BIGNUM *A 값의 크기 최적화 출력 (Length)
  * - BIGNUM *A 가 0 인 경우 *A 의 Sign = ZERO
  * - 최상위 WORD 부터 값이 0 인지 체크
+ * - 배열 크기 (Top) 유지, 재할당 X (다음 연산에서 재사용, 배열 크기 줄이기 : BN_Shrink)
  * @param[in, out] BIGNUM *A
  * @date 2017. 04. 17. \n
- * @todo 경우 더 생각해보기
+ * @date 2026. 10. 17. Length 만 정규화 (Top = Length 재할당 제거) \n
  */
 void BN_Optimize(BIGNUM *A)
 {
-	// TODO
-	
-	// 빈 배열 체크
-	while(A->Num[A->Length - 1] == 0)
+	// 빈 배열 체크 (Length == 0 인 경우 Num[-1] 접근 X)
+	while((A->Length != 0) && (A->Num[A->Length - 1] == 0))
 		A->Length--;
 
-	// 실제 할당된 배열 크기와 값이 들어있는 배열 크기 다르면 재할당
-	if((A->Top != A->Length) && (A->Top != 0))
-		BN_Realloc_Mem(A, A->Length); // A->Top = A->Length 세팅
-	
-	//실제 *A 에 저장된 값이 0 인 경우  
-	if((A->Length == 1) && (A->Num[0] == 0))
-	{	
-		A->Length = 0;
-		A->Sign = ZERO; 
-	}
+	if(A->Length == 0)
+		A->Sign = ZERO;
+}
+
+/**
+ * @brief Shrink to fit BIGNUM *A
+ * @details
+ * - BIGNUM *A 배열 크기 (Top) 를 값 크기 (Length, 최소 1) 로 재할당 \n
+ * - 연산 결과는 배열 크기 유지 (BN_Optimize) -> 오래 보관하는 값의 메모리 줄일 때 호출 \n
+ * @param[in, out] BIGNUM *A
+ * @date 2026. 10. 17. \n
+ */
+void BN_Shrink(BIGNUM *A)
+{
+	UNWORD size = (A->Length == 0) ? 1 : A->Length;
+
+	if(A->Top > size)
+		BN_Realloc_Mem(A, size);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -336,12 +409,14 @@ void BN_Optimize(BIGNUM *A)
  * - BIGNUM WORD 배열 동적할당 해제 \n
  * - 0 초기화 없이 단순 메모리 할당 해제 \n
  * - Num = NULL, Top = 0, Length = 0 , Sign = 0, Flag = DEFAULT \n
+ * - 내부 배열 (BN_SBO) 인 경우 해제 X (다시 사용하려면 BN_SBO_Init) \n
  * @param[in,out] BIGNUM *A 
  * @date 2017. 04. 17. \n
  */
 void BN_Free(BIGNUM *A)
 {
-	free(A->Num);
+	if(A->Alloc != &BN_SBO_Alloc)
+		UW_Mem_Free(A->Alloc, A->Num, A->Top);
 	A->Num = NULL;
 	A->Top = 0;
 	A->Length = 0;
@@ -361,11 +436,10 @@ void BN_Free(BIGNUM *A)
  */
 void BN_Zero_Free(BIGNUM *A)
 {
-	while(A->Top > 0)
-	{
-		A->Num[(A->Top - 1)] = 0;
-		A->Top--;
-	}
+	UNWORD i;
+	// Top 유지 (할당자에 배열 크기 전달)
+	for(i = A->Top ; i > 0 ; i--)
+		A->Num[i - 1] = 0;
 	BN_Free(A);
 }
 
@@ -376,59 +450,41 @@ void BN_Zero_Free(BIGNUM *A)
  * - BIGNUM *A 오른쪽으로 n 비트 시프트 \n
  * - 외부에서 결과 값 저장 할 BIGNUM *R 생성해서 입력 \n
  * - BN_RShift_Bit(R, R, s_bit) 가능
+ * - WORD 이동과 bit shift 를 한 번에 처리 (UW_RShift_n) \n
  * @param[out] BIGNUM *R 
  * @param[in] BIGNUM *A 
  * @param[in] s_bit (const) // shift bit
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. 한 번에 이동 (UW_RShift_n), A 빈 배열 할당 X \n
  * @todo sage 에서 음수 일 때 쉬프트 문제...
  */
 void BN_RShift_Bit(BIGNUM *R, BIGNUM *A, const UNWORD s_bit)
 {
-	UNWORD i;
-	UNWORD tmp_word;
-	UNWORD tmp_bit = s_bit;
+	UNWORD i, n;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;			// Move word
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);			// New shift bits
 
-	BN_Top_Check(A);
-	// R = A 인 경우 재할당 X , Ex) BN_RShift_Bit(R, R, shift);
-	BN_Result_Size(R, A->Top);
-	
-	// Right Shift 값이 현재 할당된 배열 보다 크면 결과는 0
-	if(s_bit > (A->Length * BIT_LEN))
-		BN_Zero(R);
-	else
+	// 결과가 0 인 경우 (A = 0 포함, 배열 크기 유지)
+	if(tmp_word >= A->Length)
 	{
-		if(s_bit >= BIT_LEN) // s_bit >= BIT_LEN (워드 이동)
-		{
-			tmp_word = UW_Div(s_bit, BIT_LEN);		// Move word
-			tmp_bit = UW_Mod(s_bit, BIT_LEN);		// New shift bits
-			// WORD 이동
-			for(i = 0 ; i < A->Length - tmp_word ; i++)
-				R->Num[i] = A->Num[i + tmp_word];
-			// 이동된 나머지 WORD = 0 채우기
-			for( ; i < A->Length ; i++)
-				R->Num[i] = 0;
-			// 연산 후 길이
-			R->Length = A->Length - tmp_word;
-		}
-		else
-		{
-			for(i = 0 ; i < A->Length ; i++)
-				R->Num[i] = A->Num[i];
-			// 연산 후 길이
-			R->Length = A->Length;
-		}		
-		if(tmp_bit != 0) // tmp_bit == 0 인 경우 WORD 이동만
-		{
-			// s_bit < BIT_LEN 인 상태 
-			for(i = 0 ; i < (R->Length - 1) ; i++) 
-				R->Num[i] = (R->Num[i + 1] << (BIT_LEN - tmp_bit)) ^ (R->Num[i] >> tmp_bit);
-			// 최상위 WORD 처리 (i = A->Num[A->Top - 1] 일 때)
-			R->Num[i] >>= tmp_bit;
-		}
-		R->Top = A->Top;
-		R->Sign = A->Sign;
-		R->Flag = A->Flag;
+		for(i = 0 ; i < R->Length ; i++)
+			R->Num[i] = 0;
+		R->Length = 0;
+		R->Sign = ZERO;
+		return;
 	}
+
+	n = A->Length - tmp_word;
+	// R = A 인 경우 재할당 X , Ex) BN_RShift_Bit(R, R, shift);
+	BN_Result_Size(R, A->Length);
+	UW_RShift_n(R->Num, A->Num + tmp_word, n, tmp_bit);
+	// 이동된 나머지 WORD = 0 채우기 (Length 이상 WORD 는 항상 0)
+	for(i = n ; i < A->Length ; i++)
+		R->Num[i] = 0;
+
+	R->Length = n;
+	R->Sign = A->Sign;
+	R->Flag = A->Flag;
 	BN_Optimize(R);
 }
 
@@ -438,61 +494,186 @@ void BN_RShift_Bit(BIGNUM *R, BIGNUM *A, const UNWORD s_bit)
  * @details
  * - BIGNUM *A 왼쪽으로 n 비트 시프트 \n
  * - 외부에서 결과 값 저장 할 BIGNUM *R 생성해서 입력 \n
+ * - BN_LShift_Bit(R, R, s_bit) 가능
+ * - 최상위 WORD 의 0 bit 개수 (UW_Clz) 로 결과 길이 계산, WORD 이동과 bit shift 를 한 번에 처리 (UW_LShift_n) \n
  * @param[out] BIGNUM *R 
  * @param[in] BIGNUM *A 
  * @param[in] s_bit (const) // shift bit
  * @date 2017. 04. 13. v1.00 \n
+ * @date 2026. 10. 17. A = 0 인 경우 Num[-1] 읽기 수정, UW_Clz / UW_LShift_n 사용 \n
  */
 void BN_LShift_Bit(BIGNUM *R, BIGNUM *A, const UNWORD s_bit)
 {
-	SNWORD i;
-	UNWORD tmp_word = UW_Div(s_bit, BIT_LEN);	// 실제 추가되는 WORD;
-	UNWORD tmp_bit = UW_Mod(s_bit, BIT_LEN);	// 실제 Shift bit;
-	UNWORD word_len = A->Length;
-	UNWORD zero_cnt = 0;
-	
-	for(i = BIT_LEN - 1 ; i >= 0 ; i--)
+	UNWORD i, len;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;			// 실제 추가되는 WORD
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);			// 실제 Shift bit
+
+	// A = 0 인 경우 결과 0 (최상위 WORD 없음)
+	if(A->Length == 0)
 	{
-		// 상위 WORD 부터 shift 하면서 0 인 bit 체크
-		if((A->Num[word_len - 1] >> i) == 0)
-			zero_cnt++;
-		else
-			break;		
-	}	
-	
-	if(zero_cnt < tmp_bit) // 최상위 WORD 1개 추가
-	{			
-		BN_Result_Size(R, (A->Length + tmp_word + 1));		
-		R->Num[R->Length - 1] = 0;					  // 최상위 배열 빈 상태 유지 (Shift carry 고려)
-		for(i = R->Length - 1 ; i > tmp_word ; i--)
-			R->Num[i - 1] = A->Num[i - 1 - tmp_word]; // Range : [(R->Length - 2), tmp_word]
-		for( ; i > 0 ; i--)							  
-			R->Num[i - 1] = 0;						  // Range : [(tmp_word - 1), 0]
+		for(i = 0 ; i < R->Length ; i++)
+			R->Num[i] = 0;
+		R->Length = 0;
+		R->Sign = ZERO;
+		return;
+	}
+
+	// 최상위 WORD 의 0 bit 가 shift bit 보다 적으면 WORD 1개 추가
+	len = A->Length + tmp_word;
+	if(UW_Clz(A->Num[A->Length - 1]) < tmp_bit)
+		len++;
+
+	BN_Result_Size(R, len);
+	// 상위 WORD 부터 이동 (R = A 인 경우 덮어쓰기 전에 읽음)
+	if(len > A->Length + tmp_word)
+		R->Num[len - 1] = UW_LShift_n(R->Num + tmp_word, A->Num, A->Length, tmp_bit);
+	else
+		UW_LShift_n(R->Num + tmp_word, A->Num, A->Length, tmp_bit);
+	for(i = 0 ; i < tmp_word ; i++)
+		R->Num[i] = 0;
+
+	// R 설정 동일하게
+	R->Length = len;
+	R->Sign = A->Sign;
+	R->Flag = A->Flag;
+}
+
+/**
+ * @brief BIGNUM n-bit Right Shift (in-place)
+ * @details
+ * - A = A >> s_bit, 재할당 X (Top 유지), 밀려난 bit 리턴 \n
+ * - 리턴 값은 밀려난 bit 중 하위 min(s_bit, BIT_LEN) bit (s_bit <= BIT_LEN 이면 밀려난 bit 전부) \n
+ * - 절대값 shift (부호 유지, 결과 0 이면 ZERO) \n
+ * @param[in,out] BIGNUM *A
+ * @param[in] UNWORD s_bit (const)
+ * @return UNWORD 밀려난 bit (A mod 2^min(s_bit, BIT_LEN))
+ * @date 2026. 10. 17. \n
+ */
+UNWORD BN_RShift_Bit_Inplace(BIGNUM *A, const UNWORD s_bit)
+{
+	UNWORD i, n, out;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);
+
+	if(A->Length == 0)
+		return 0;
+	out = A->Num[0];
+	if(s_bit < BIT_LEN)
+		out &= ((UNWORD)1 << s_bit) - 1;
+
+	if(tmp_word >= A->Length)
+	{
+		for(i = 0 ; i < A->Length ; i++)
+			A->Num[i] = 0;
+		A->Length = 0;
+		A->Sign = ZERO;
+		return out;
 	}
-	else // zero_cnt >= tmp_bit(조정)
+
+	n = A->Length - tmp_word;
+	UW_RShift_n(A->Num, A->Num + tmp_word, n, tmp_bit);
+	for(i = n ; i < A->Length ; i++)
+		A->Num[i] = 0;
+	// 최상위 WORD 만 0 이 될 수 있음
+	A->Length = (A->Num[n - 1] == 0) ? n - 1 : n;
+	if(A->Length == 0)
+		A->Sign = ZERO;
+	return out;
+}
+
+/**
+ * @brief BIGNUM n-bit Left Shift (in-place)
+ * @details
+ * - A = (A << s_bit) mod 2^(BIT_LEN * Top), 재할당 X (현재 배열 크기 안에서 shift), 밀려난 bit 리턴 \n
+ * - 리턴 값은 배열 밖으로 밀려난 bit 중 하위 BIT_LEN bit (0 이면 값 손실 없음, s_bit <= BIT_LEN 이면 밀려난 bit 전부) \n
+ * - 손실 없는 shift 는 미리 배열 크기 확보 (BN_Result_Size) 또는 BN_LShift_Bit 사용 \n
+ * @param[in,out] BIGNUM *A
+ * @param[in] UNWORD s_bit (const)
+ * @return UNWORD 밀려난 bit
+ * @date 2026. 10. 17. \n
+ */
+UNWORD BN_LShift_Bit_Inplace(BIGNUM *A, const UNWORD s_bit)
+{
+	UNWORD i, n, out;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);
+
+	if(A->Length == 0)
+		return 0;
+
+	if(tmp_word >= A->Top)
 	{
-		BN_Result_Size(R, (A->Length + tmp_word));		
-		for(i = R->Length ; i > tmp_word ; i--)
-			R->Num[i - 1] = A->Num[i - 1 - tmp_word]; // Range : [(R->Length - 2), tmp_word]
-		for( ; i > 0 ; i--)							  
-			R->Num[i - 1] = 0;						  // Range : [(tmp_word - 1), 0]
+		// 값 전체가 밀려남 : Top WORD 위치의 bit = A << (s_bit - BIT_LEN * Top)
+		out = (tmp_word == A->Top) ? (A->Num[0] << tmp_bit) : 0;
+		for(i = 0 ; i < A->Length ; i++)
+			A->Num[i] = 0;
+		A->Length = 0;
+		A->Sign = ZERO;
+		return out;
 	}
 
-	if(tmp_bit != 0) // tmp_bit == 0 인 경우 WORD 이동만 필요
+	// 배열에 남는 A 의 WORD 개수 n, Top WORD 위치로 밀려나는 bit
+	n = A->Top - tmp_word;
+	if(n >= A->Length)
 	{
-		// s_bit < zero_cnt 인 상태 
-		for(i = R->Length - 1 ; i > 0 ; i--) 
-			R->Num[i] = (R->Num[i] << tmp_bit) ^ (R->Num[i - 1] >> (BIT_LEN - tmp_bit));
-		// 최하위 WORD 처리 (i = A->Num[0] 일 때)
-		R->Num[i] <<= tmp_bit;
+		n = A->Length;
+		out = 0;
 	}
-		
-	// 연산 후 길이
-	R->Length = R->Top;	
-	// R 설정 동일하게
-	R->Sign = A->Sign;
-	R->Flag = A->Flag;
-	BN_Optimize(R);
+	else
+		out = (A->Num[n] << tmp_bit) | ((tmp_bit == 0) ? 0 : (A->Num[n - 1] >> (BIT_LEN - tmp_bit)));
+
+	i = UW_LShift_n(A->Num + tmp_word, A->Num, n, tmp_bit);
+	if(n + tmp_word < A->Top)
+		A->Num[n + tmp_word] = i;
+	else if(n == A->Length)
+		out = i;
+	for(i = 0 ; i < tmp_word ; i++)
+		A->Num[i] = 0;
+
+	A->Length = n + tmp_word + 1;
+	if(A->Length > A->Top)
+		A->Length = A->Top;
+	BN_Optimize(A);
+	return out;
+}
+
+/**
+ * @brief Trailing zero bits of BIGNUM *A
+ * @details
+ * - 최하위 bit 부터 연속된 0 bit 개수 (2 로 나누어 떨어지는 횟수), A = 0 이면 0 \n
+ * - 0 WORD 는 WORD 단위로 건너뛰고 마지막 WORD 만 UW_Ctz \n
+ * @param[in] BIGNUM *A (const)
+ * @return UNWORD 0 bit 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD BN_Trailing_Zeros(const BIGNUM *A)
+{
+	UNWORD i;
+
+	for(i = 0 ; i < A->Length ; i++)
+	{
+		if(A->Num[i] != 0)
+			return (i << WORD_SHIFT) + UW_Ctz(A->Num[i]);
+	}
+	return 0;
+}
+
+/**
+ * @brief Right shift BIGNUM *A by its trailing zero bits (in-place)
+ * @details
+ * - A = A / 2^k (A 를 홀수로), k = BN_Trailing_Zeros(A) 리턴 \n
+ * - Binary GCD 반복문의 1 bit shift 반복을 한 번의 shift 로 처리 \n
+ * @param[in,out] BIGNUM *A
+ * @return UNWORD k
+ * @date 2026. 10. 17. \n
+ */
+UNWORD BN_RShift_Zeros(BIGNUM *A)
+{
+	UNWORD k = BN_Trailing_Zeros(A);
+
+	if(k != 0)
+		BN_RShift_Bit_Inplace(A, k);
+	return k;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -500,24 +681,15 @@ void BN_LShift_Bit(BIGNUM *R, BIGNUM *A, const UNWORD s_bit)
  * @brief BIGNUM *A is Zero ?
  * @details 
  * - BIGNUM *A 가 Zero 인지 아닌지 판단 \n
+ * - 연산 결과는 BN_Optimize 로 Length 정규화 상태 (최상위 WORD != 0) -> Length 만 확인 O(1) \n
  * @param[in] BIGNUM *A (const)
  * @return SNWORD TRUE/FALSE
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. WORD 탐색 제거 (Length == 0) \n
  */
 SNWORD BN_IsZero(const BIGNUM *A)
-{	
-	UNWORD tmp = A->Length;	
-	while(tmp != 0)
-	{
-		if(A->Num[tmp - 1] == 0)
-			tmp--;
-		else
-			break;
-	}
-	if(tmp == 0)
-		return TRUE;
-	else
-		return FALSE;	
+{
+	return (A->Length == 0) ? TRUE : FALSE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -586,16 +758,20 @@ SNWORD BN_Cmp(const BIGNUM *A, const BIGNUM *B)
  * @details
  * - BIGNUM *A 를 콘솔창 출력
  * - "0x1234...cdef" -> Hex form
+ * - 값 WORD (Length) 만 출력 (A = 0 이면 "0x0") \n
  * @param[in] BIGNUM *A (const)
  * @date 2017. 04. 15. v1.00 \n
+ * @date 2026. 10. 17. Top -> Length 출력 \n
  */
 void BN_Print_hex(const BIGNUM *A)
 {
 	SNWORD i;
 	
 	printf("%s0x", (A->Sign == -1) ? "-" : "+");
-	for(i = A->Top ; i > 0 ; i--)
-		printf("%08X", A->Num[i - 1]);
+	if(A->Length == 0)
+		printf("0");
+	for(i = A->Length ; i > 0 ; i--)
+		printf(WORD_HEX_FMT, A->Num[i - 1]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -604,261 +780,625 @@ void BN_Print_hex(const BIGNUM *A)
  * @details
  * - BIGNUM *A 를 파일 출력 \n
  * - "0x1234...cdef" -> Hex form \n
+ * - 값 WORD (Length) 만 출력 (A = 0 이면 "0x0") \n
  * @param[in] FILE *fp
  * @param[in] BIGNUM *A (const)
  * @date 2017. 04. 15. v1.00 \n
+ * @date 2026. 10. 17. Top -> Length 출력 \n
  */
 void BN_FPrint_hex(FILE *fp, const BIGNUM *A)
 {
 	SNWORD i;
 	fprintf(fp, "%s0x", (A->Sign == -1) ? "-" : "+");
-	for(i = A->Top ; i > 0 ; i--)
-		fprintf(fp, "%08X", A->Num[i - 1]);
+	if(A->Length == 0)
+		fprintf(fp, "0");
+	for(i = A->Length ; i > 0 ; i--)
+		fprintf(fp, WORD_HEX_FMT, A->Num[i - 1]);
 }
 
 /**
- * @brief Euclidean algorithm of BIGNUM (GCD)
+ * @brief Byte length of BIGNUM *A
  * @details
- * - BIGNUM *A, *B : Positive Integer
- * - BIGNUM *A 와 *B 의 최대공약수 BIGNUM *R 계산
- * - Lecture Note 참고
+ * - 값 |A| 를 나타내는 최소 byte 개수 (A = 0 이면 0) \n
+ * - BN_To_Bytes 의 최소 출력 길이 \n
  * @param[in] BIGNUM *A (const)
- * @param[in] BIGNUM *B (const)
- * @param[out] BIGNUM *R 
- * @date 2017. 04. 17. \n
- * @todo 보류 (Division 필요)
+ * @return UNWORD byte 개수
+ * @date 2026. 10. 17. \n
  */
-/*
-void BN_Euclidean_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B)
-{	
-	// division 필요.. 추후 구현
+UNWORD BN_Num_Bytes(const BIGNUM *A)
+{
+	if(A->Length == 0)
+		return 0;
+	return ((A->Length << WORD_SHIFT) - UW_Clz(A->Num[A->Length - 1]) + 7) >> 3;
 }
-*/
+
 /**
- * @brief Extended Euclidean algorithm of BIGNUM (GCD)
+ * @brief Big endian bytes to BIGNUM *R
  * @details
- * - Lecture Note 참고
- * @param[out] BIGNUM *R 
- * @param[out] BIGNUM *X 
- * @param[out] BIGNUM *Y 
- * @param[in] BIGNUM *A (const)
- * @param[in] BIGNUM *B (const)
- * @date 2017. 04. 17. \n
- * @todo 보류 (Division 필요)
+ * - R = buf[0..len-1] (buf[0] 이 최상위 byte, 0 이면 ZERO, 부호 X) \n
+ * - R 배열 크기가 충분하면 재할당 X (미리 BN_Result_Size 로 크기 확보 시 Num 에 바로 변환) \n
+ * - WORD 단위 한 번에 읽기 (UW_From_Bytes : bswap / movbe) \n
+ * @param[out] BIGNUM *R
+ * @param[in] UCHAR *buf (const)
+ * @param[in] UNWORD len (const) byte 개수
+ * @date 2026. 10. 17. \n
  */
- /*
-void BN_Ext_Euclidean_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B)
-{	
-	// division 필요.. 추후 구현
+void BN_From_Bytes(BIGNUM *R, const UCHAR *buf, const UNWORD len)
+{
+	UNWORD n = UW_WORDS(len << 3);
+
+	BN_Result_Size(R, n);
+	UW_From_Bytes(R->Num, n, buf, len);
+	R->Length = n;
+	R->Sign = PLUS;
+	BN_Optimize(R);
 }
-*/
+
 /**
- * @brief BIGNUM Binary GCD algorithm 
+ * @brief Little endian bytes to BIGNUM *R
  * @details
- * - BIGNUM *A, *B : Positive Integer
- * - BIGNUM *A 와 *B 의 최대공약수 BIGNUM *R 계산
- * - Lecture Note 참고
- * @param[out] BIGNUM *R 
- * @param[in] BIGNUM *A (const)
- * @param[in] BIGNUM *B (const)
- * @date 2017. 04. 19. \n
- * @todo 검증 X
+ * - R = buf[0..len-1] (buf[0] 이 최하위 byte), BN_From_Bytes 와 동일 \n
+ * @param[out] BIGNUM *R
+ * @param[in] UCHAR *buf (const)
+ * @param[in] UNWORD len (const) byte 개수
+ * @date 2026. 10. 17. \n
  */
-void BN_Binary_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B)
-{	
-	BIGNUM t0, t1, t2;
-	BN_Init_Copy(&t0, A);
-	BN_Init_Copy(&t1, B);
-	BN_Init_One(&t2);
+void BN_From_Bytes_LE(BIGNUM *R, const UCHAR *buf, const UNWORD len)
+{
+	UNWORD n = UW_WORDS(len << 3);
 
-	while(((t0.Num[0] & 1) == 0) && ((t1.Num[0] & 1) == 0))
-	{
-		BN_RShift_Bit(&t0, &t0, 1);
-		BN_RShift_Bit(&t1, &t1, 1);
-		BN_LShift_Bit(&t2, &t2, 1);
-	}
-	while(BN_IsZero(&t1) == FALSE)
-	{
-		while((t0.Num[0] & 1) == 0)
-			BN_RShift_Bit(&t0, &t0, 1);
-		while((t1.Num[0] & 1) == 0)
-			BN_RShift_Bit(&t1, &t1, 1);
-		if(!(BN_Cmp(&t1, &t0) == SMALL)) // (t1 >= t0) == !(t1 < t0) 
-			BN_Abs_Sub(&t1, &t1, &t0);
-		else // (t0 > t1)
-			BN_Abs_Sub(&t0, &t0, &t1);
-	}
-	BN_Mul(R, &t0, &t2);
+	BN_Result_Size(R, n);
+	UW_From_Bytes_LE(R->Num, n, buf, len);
+	R->Length = n;
+	R->Sign = PLUS;
+	BN_Optimize(R);
+}
 
-	BN_Zero_Free(&t0);
-	BN_Zero_Free(&t1);
-	BN_Zero_Free(&t2);
+/**
+ * @brief BIGNUM *A to big endian bytes (fixed width)
+ * @details
+ * - buf[0..len-1] = |A| (buf[0] 이 최상위 byte), 길이 len 고정 (상위 byte 0 채우기) \n
+ * - len < BN_Num_Bytes(A) 이면 FALSE (buf 변경 X) \n
+ * @param[out] UCHAR *buf
+ * @param[in] UNWORD len (const) byte 개수
+ * @param[in] BIGNUM *A (const)
+ * @return SNWORD TRUE/FALSE
+ * @date 2026. 10. 17. \n
+ */
+SNWORD BN_To_Bytes(UCHAR *buf, const UNWORD len, const BIGNUM *A)
+{
+	if(BN_Num_Bytes(A) > len)
+		return FALSE;
+	UW_To_Bytes(buf, len, A->Num, A->Length);
+	return TRUE;
 }
 
 /**
- * @brief BIGNUM Extended Binary GCD algorithm 
+ * @brief BIGNUM *A to little endian bytes (fixed width)
  * @details
- * - BIGNUM *R = gcd(A, B), BIGNUM *X and *Y s.t. AX + BY = gcd(A, B) \n
- * - BIGNUM *A, *B : Positive Integer \n
- * - Lecture Note 참고 \n
- * @param[out] BIGNUM *R 
- * @param[out] BIGNUM *X 
- * @param[out] BIGNUM *Y 
+ * - buf[0..len-1] = |A| (buf[0] 이 최하위 byte), BN_To_Bytes 와 동일 \n
+ * @param[out] UCHAR *buf
+ * @param[in] UNWORD len (const) byte 개수
+ * @param[in] BIGNUM *A (const)
+ * @return SNWORD TRUE/FALSE
+ * @date 2026. 10. 17. \n
+ */
+SNWORD BN_To_Bytes_LE(UCHAR *buf, const UNWORD len, const BIGNUM *A)
+{
+	if(BN_Num_Bytes(A) > len)
+		return FALSE;
+	UW_To_Bytes_LE(buf, len, A->Num, A->Length);
+	return TRUE;
+}
+
+/**
+ * @brief Division of BIGNUM (quotient and remainder)
+ * @details
+ * - A = Q * B + R, |R| < |B| (몫은 0 방향 버림, R 의 부호 = A 의 부호) \n
+ * - WORD 단위 long division (UW_Div_n : Knuth Algorithm D, 2-by-1 역수 몫 추정) \n
+ * - Q, R 은 NULL 가능 (한 쪽만 계산), Q 와 R 은 다른 BIGNUM, A / B 와는 같아도 됨 \n
+ * - 임시 배열 (몫, 나머지, 정규화된 A / B) 한 번 할당 \n
+ * @param[out] BIGNUM *Q
+ * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A (const)
  * @param[in] BIGNUM *B (const)
- * @date 2017. 04. 19. \n
- * @todo 검증 X
+ * @return TRUE (성공) / FALSE (B == 0 or 할당 실패)
+ * @date 2026. 10. 17. \n
  */
-void BN_Ext_Binary_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B)
-{	
-	BIGNUM t0, t1, t2;
-	BIGNUM a, b, u0, u1, v0, v1;
+SNWORD BN_Div(BIGNUM *Q, BIGNUM *R, const BIGNUM *A, const BIGNUM *B)
+{
+	UNWORD i, nq, len;
+	UNWORD na = A->Length, nb = B->Length;
+	SNWORD sa = A->Sign, sb = B->Sign;
+	UNWORD *t;
+	const UW_ALLOC *alloc;
 
-	BN_Init_Copy(&t0, A);
-	BN_Init_Copy(&t1, B);
-	BN_Init_One(&t2);
+	if(nb == 0)
+		return FALSE;
 
-	while(((t0.Num[0] & 1) == 0) && ((t1.Num[0] & 1) == 0))
+	// |A| < |B| -> Q = 0, R = A (R 먼저 : Q == A 인 경우)
+	if(BN_Abs_Cmp(A, B) == SMALL)
 	{
-		BN_RShift_Bit(&t0, &t0, 1);
-		BN_RShift_Bit(&t1, &t1, 1);
-		BN_LShift_Bit(&t2, &t2, 1);
+		if(R != NULL)
+			BN_Copy(R, A);
+		if(Q != NULL)
+			BN_Zero(Q);
+		return TRUE;
 	}
 
-	BN_Init_Copy(&a, &t0);
-	BN_Init_Copy(&b, &t1);
-	BN_Init_One(&u0);
-	BN_Init_Zero(&v0);
-	BN_Init_Zero(&u1);
-	BN_Init_One(&v1);
+	// [q (nq) | r (nb) | UW_Div_n 임시 배열]
+	nq = na - nb + 1;
+	len = nq + nb + UW_DIV_SCRATCH(na, nb);
+	alloc = UW_Alloc_Get();
+	t = UW_Mem_Alloc(alloc, len);
+	if(t == NULL)
+		return FALSE;
+	UW_Div_n(t, t + nq, A->Num, na, B->Num, nb, t + nq + nb);
 
-	while(BN_IsZero(&t0) == FALSE)
+	if(Q != NULL)
 	{
-		while((t0.Num[0] & 1) == 0)
-		{
-			BN_RShift_Bit(&t0, &t0, 1);
-			if(((u0.Num[0] & 1) == 0) && ((v0.Num[0] & 1) == 0))
-			{
-				BN_RShift_Bit(&u0, &u0, 1);
-				BN_RShift_Bit(&v0, &v0, 1);
-			}
-			else
-			{
-				BN_Add(&u0, &u0, &b);
-				BN_RShift_Bit(&u0, &u0, 1);
-				BN_Sub(&v0, &v0, &a);
-				BN_RShift_Bit(&v0, &v0, 1);
-			}
-		}
-		while((t1.Num[0] & 1) == 0)
-		{
-			BN_RShift_Bit(&t1, &t1, 1);
-			if(((u1.Num[0] & 1) == 0) && ((v1.Num[0] & 1) == 0))
-			{
-				BN_RShift_Bit(&u1, &u1, 1);
-				BN_RShift_Bit(&v1, &v1, 1);
-			}
-			else
-			{
-				BN_Add(&u1, &u1, &b);
-				BN_RShift_Bit(&u1, &u1, 1);
-				BN_Sub(&v1, &v1, &a);
-				BN_RShift_Bit(&v1, &v1, 1);
-			}
-		}
-		if(!(BN_Cmp(&t0, &t1) == SMALL)) // (t0 >= t1) == !(t0 < t1) 
-		{
-			BN_Sub(&t0, &t0, &t1);
-			BN_Sub(&u0, &u0, &u1);
-			BN_Sub(&v0, &v0, &v1);
-		}
-		else // (t1 > t0)
-		{
-			BN_Sub(&t1, &t1, &t0);
-			BN_Sub(&u1, &u1, &u0);
-			BN_Sub(&v1, &v1, &v0);
-		}
+		BN_Result_Size(Q, nq);
+		for(i = 0 ; i < nq ; i++)
+			Q->Num[i] = t[i];
+		Q->Length = nq;
+		Q->Sign = (sa == sb) ? PLUS : MINUS;
+		BN_Optimize(Q);
+	}
+	if(R != NULL)
+	{
+		BN_Result_Size(R, nb);
+		for(i = 0 ; i < nb ; i++)
+			R->Num[i] = t[nq + i];
+		R->Length = nb;
+		R->Sign = sa;
+		BN_Optimize(R);
 	}
 
-	BN_Mul(R, &t1, &t2);
-	BN_Copy(X, &u1);
-	BN_Copy(Y, &v1);
+	for(i = 0 ; i < nq + nb ; i++)
+		t[i] = 0;
+	UW_Mem_Free(alloc, t, len);
 
-	BN_Zero_Free(&t0);
-	BN_Zero_Free(&t1);
-	BN_Zero_Free(&t2);
-	BN_Zero_Free(&a);
-	BN_Zero_Free(&b);
-	BN_Zero_Free(&u0);
-	BN_Zero_Free(&v0);
-	BN_Zero_Free(&u1);
-	BN_Zero_Free(&v1);
+	return TRUE;
 }
 
 /**
- * @brief A^(-1) by Extended Binary GCD algorithm 
+ * @brief Modulus of BIGNUM
  * @details
- * - BIGNUM *R = A^(-1) mod p \n
- * - BIGNUM *A : Positive Integer, *P : Prime \n
- * - Lecture Note(틀림?) & Guide to ECC p.41 참고 \n
- * @param[out] BIGNUM *R 
+ * - R = A mod |N|, 0 <= R < |N| (음수 A 는 |N| - (|A| mod |N|)) \n
+ * - BN_Div 의 나머지 \n
+ * - R 은 A 와 같아도 됨, N 과는 다른 BIGNUM \n
+ * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A (const)
- * @param[in] BIGNUM *P (const)
- * @date 2017. 04. 19. \n
- * @todo 검증 X
+ * @param[in] BIGNUM *N (const)
+ * @return TRUE (성공) / FALSE (N == 0 or 할당 실패)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD BN_Mod(BIGNUM *R, const BIGNUM *A, const BIGNUM *N)
+{
+	SNWORD neg = (A->Sign == MINUS);
+	UNWORD n = N->Length;
+
+	if(BN_Div(NULL, R, A, N) != TRUE)
+		return FALSE;
+
+	// 음수 나머지 -> |N| - |R| (Length 이상 WORD 는 0)
+	if(neg && (R->Length != 0))
+	{
+		BN_Result_Size(R, n);
+		UW_Sub_n(R->Num, N->Num, R->Num, n);
+		R->Length = n;
+		R->Sign = PLUS;
+		BN_Optimize(R);
+	}
+
+	return TRUE;
+}
+
+/**
+ * @brief Get temporary BIGNUM 1 from BN_CTX
+ * @details
+ * - BN_Init_One 대신 사용 (BN_CTX_End 에서 반환) \n
+ * @param[in,out] BN_CTX *ctx
+ * @return BIGNUM * 값이 1 인 임시 값
+ * @date 2026. 10. 17. \n
+ */
+static BIGNUM *BN_CTX_Get_One(BN_CTX *ctx)
+{
+	BIGNUM *A = BN_CTX_Get(ctx, 1);
+
+	A->Num[0] = 1;
+	A->Length = 1;
+	A->Sign = PLUS;
+	return A;
+}
+
+/**
+ * @brief Get temporary copy of BIGNUM *A from BN_CTX
+ * @details
+ * - BN_Init_Copy 대신 사용 (BN_CTX_End 에서 반환) \n
+ * @param[in,out] BN_CTX *ctx
+ * @param[in] BIGNUM *A (const)
+ * @return BIGNUM * A 를 복사한 임시 값
+ * @date 2026. 10. 17. \n
+ */
+static BIGNUM *BN_CTX_Get_Copy(BN_CTX *ctx, const BIGNUM *A)
+{
+	BIGNUM *R = BN_CTX_Get(ctx, A->Length);
+
+	BN_Copy(R, A);
+	return R;
+}
+
+/**
+ * @brief Euclidean algorithm of BIGNUM (GCD)
+ * @details
+ * - BIGNUM *A, *B : Positive Integer \n
+ * - BIGNUM *A 와 *B 의 최대공약수 BIGNUM *R 계산 \n
+ * - Lecture Note 참고 \n
+ * - (r0, r1) <- (r1, r0 mod r1) 반복 (BN_Div), 임시 값은 BN_CTX \n
+ * @param[out] BIGNUM *R 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. 나눗셈 (BN_Div) 으로 구현 \n
+ */
+void BN_Euclidean_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{	
+	BN_CTX ctx;
+	BIGNUM *r0, *r1, *t;
+
+	BN_CTX_Init(&ctx);
+	BN_CTX_Start(&ctx);
+	r0 = BN_CTX_Get_Copy(&ctx, A);
+	r1 = BN_CTX_Get_Copy(&ctx, B);
+
+	while(BN_IsZero(r1) == FALSE)
+	{
+		BN_Div(NULL, r0, r0, r1);
+		t = r0;
+		r0 = r1;
+		r1 = t;
+	}
+	BN_Copy(R, r0);
+
+	BN_CTX_End(&ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief Extended Euclidean algorithm of BIGNUM (GCD)
+ * @details
+ * - BIGNUM *R = gcd(A, B), BIGNUM *X and *Y s.t. AX + BY = gcd(A, B) \n
+ * - BIGNUM *A, *B : Positive Integer \n
+ * - Lecture Note 참고 \n
+ * - q = r0 / r1 (BN_Div) 마다 (r0, r1) <- (r1, r0 - q r1), (x0, x1) <- (x1, x0 - q x1), (y0, y1) <- (y1, y0 - q y1) \n
+ * @param[out] BIGNUM *R 
+ * @param[out] BIGNUM *X 
+ * @param[out] BIGNUM *Y 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. 나눗셈 (BN_Div) 으로 구현 \n
+ */
+void BN_Ext_Euclidean_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B)
+{	
+	BN_CTX ctx;
+	BIGNUM *r0, *r1, *x0, *x1, *y0, *y1, *q, *t, *s;
+
+	BN_CTX_Init(&ctx);
+	BN_CTX_Start(&ctx);
+	r0 = BN_CTX_Get_Copy(&ctx, A);
+	r1 = BN_CTX_Get_Copy(&ctx, B);
+	x0 = BN_CTX_Get_One(&ctx);
+	x1 = BN_CTX_Get(&ctx, 1);
+	y0 = BN_CTX_Get(&ctx, 1);
+	y1 = BN_CTX_Get_One(&ctx);
+	q = BN_CTX_Get(&ctx, A->Length);
+	t = BN_CTX_Get(&ctx, (A->Length + B->Length));
+
+	while(BN_IsZero(r1) == FALSE)
+	{
+		// q = r0 / r1, r0 = r0 mod r1 -> (r0, r1) 교환
+		BN_Div(q, r0, r0, r1);
+		s = r0;
+		r0 = r1;
+		r1 = s;
+
+		// x0 = x0 - q x1 -> (x0, x1) 교환
+		BN_Mul(t, q, x1);
+		BN_Sub(x0, x0, t);
+		s = x0;
+		x0 = x1;
+		x1 = s;
+
+		BN_Mul(t, q, y1);
+		BN_Sub(y0, y0, t);
+		s = y0;
+		y0 = y1;
+		y1 = s;
+	}
+	BN_Copy(R, r0);
+	BN_Copy(X, x0);
+	BN_Copy(Y, y0);
+
+	BN_CTX_End(&ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief BIGNUM Binary GCD algorithm 
+ * @details
+ * - BIGNUM *A, *B : Positive Integer
+ * - BIGNUM *A 와 *B 의 최대공약수 BIGNUM *R 계산
+ * - Lecture Note 참고
+ * - 임시 BN_CTX 사용 (반복 호출 시 BN_Binary_GCD_Ctx 사용)
+ * @param[out] BIGNUM *R 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @date 2017. 04. 19. \n
+ * @todo 검증 X
+ */
+void BN_Binary_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{	
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	BN_Binary_GCD_Ctx(R, A, B, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief BIGNUM Binary GCD algorithm (BN_CTX)
+ * @details
+ * - BN_Binary_GCD 와 동일, 임시 값은 BN_CTX *ctx 에서 재사용 \n
+ * - 0 bit 는 BN_RShift_Zeros 로 한 번에 제거, 공통 인수 2^k 는 마지막에 shift \n
+ * @param[out] BIGNUM *R 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Binary_GCD_Ctx(BIGNUM *R, BIGNUM *A, BIGNUM *B, BN_CTX *ctx)
+{	
+	BIGNUM *t0, *t1;
+	UNWORD k, k1;
+
+	// gcd(0, B) = B, gcd(A, 0) = A
+	if(BN_IsZero(A) == TRUE)
+	{
+		BN_Copy(R, B);
+		return;
+	}
+	if(BN_IsZero(B) == TRUE)
+	{
+		BN_Copy(R, A);
+		return;
+	}
+
+	BN_CTX_Start(ctx);
+	t0 = BN_CTX_Get_Copy(ctx, A);
+	t1 = BN_CTX_Get_Copy(ctx, B);
+
+	// 공통 인수 2^k (t2 = 2^k 곱셈 대신 마지막에 k bit shift)
+	k = BN_RShift_Zeros(t0);
+	k1 = BN_RShift_Zeros(t1);
+	if(k1 < k)
+		k = k1;
+	while(BN_IsZero(t1) == FALSE)
+	{
+		// 0 bit 를 한 번에 제거 (t0, t1 홀수)
+		BN_RShift_Zeros(t0);
+		BN_RShift_Zeros(t1);
+		if(!(BN_Cmp(t1, t0) == SMALL)) // (t1 >= t0) == !(t1 < t0) 
+			BN_Abs_Sub(t1, t1, t0);
+		else // (t0 > t1)
+			BN_Abs_Sub(t0, t0, t1);
+	}
+	BN_LShift_Bit(R, t0, k);
+
+	BN_CTX_End(ctx);
+}
+
+/**
+ * @brief BIGNUM Extended Binary GCD algorithm 
+ * @details
+ * - BIGNUM *R = gcd(A, B), BIGNUM *X and *Y s.t. AX + BY = gcd(A, B) \n
+ * - BIGNUM *A, *B : Positive Integer \n
+ * - Lecture Note 참고 \n
+ * - 임시 BN_CTX 사용 (반복 호출 시 BN_Ext_Binary_GCD_Ctx 사용) \n
+ * @param[out] BIGNUM *R 
+ * @param[out] BIGNUM *X 
+ * @param[out] BIGNUM *Y 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @date 2017. 04. 19. \n
+ * @todo 검증 X
+ */
+void BN_Ext_Binary_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B)
+{	
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	BN_Ext_Binary_GCD_Ctx(R, X, Y, A, B, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief BIGNUM Extended Binary GCD algorithm (BN_CTX)
+ * @details
+ * - BN_Ext_Binary_GCD 와 동일, 임시 값은 BN_CTX *ctx 에서 재사용 \n
+ * - 1 bit shift 는 재할당 없는 BN_RShift_Bit_Inplace \n
+ * @param[out] BIGNUM *R 
+ * @param[out] BIGNUM *X 
+ * @param[out] BIGNUM *Y 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Ext_Binary_GCD_Ctx(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B, BN_CTX *ctx)
+{	
+	BIGNUM *t0, *t1;
+	BIGNUM *a, *b, *u0, *u1, *v0, *v1;
+	UNWORD k, k1;
+
+	BN_CTX_Start(ctx);
+	t0 = BN_CTX_Get_Copy(ctx, A);
+	t1 = BN_CTX_Get_Copy(ctx, B);
+
+	// 공통 인수 2^k 제거 (t2 = 2^k 곱셈 대신 마지막에 k bit shift)
+	k = BN_Trailing_Zeros(t0);
+	k1 = BN_Trailing_Zeros(t1);
+	if(k1 < k)
+		k = k1;
+	BN_RShift_Bit_Inplace(t0, k);
+	BN_RShift_Bit_Inplace(t1, k);
+
+	a = BN_CTX_Get_Copy(ctx, t0);
+	b = BN_CTX_Get_Copy(ctx, t1);
+	u0 = BN_CTX_Get_One(ctx);
+	v0 = BN_CTX_Get(ctx, 1);
+	u1 = BN_CTX_Get(ctx, 1);
+	v1 = BN_CTX_Get_One(ctx);
+
+	while(BN_IsZero(t0) == FALSE)
+	{
+		while((t0->Num[0] & 1) == 0)
+		{
+			BN_RShift_Bit_Inplace(t0, 1);
+			if(((u0->Num[0] & 1) == 0) && ((v0->Num[0] & 1) == 0))
+			{
+				BN_RShift_Bit_Inplace(u0, 1);
+				BN_RShift_Bit_Inplace(v0, 1);
+			}
+			else
+			{
+				BN_Add(u0, u0, b);
+				BN_RShift_Bit_Inplace(u0, 1);
+				BN_Sub(v0, v0, a);
+				BN_RShift_Bit_Inplace(v0, 1);
+			}
+		}
+		while((t1->Num[0] & 1) == 0)
+		{
+			BN_RShift_Bit_Inplace(t1, 1);
+			if(((u1->Num[0] & 1) == 0) && ((v1->Num[0] & 1) == 0))
+			{
+				BN_RShift_Bit_Inplace(u1, 1);
+				BN_RShift_Bit_Inplace(v1, 1);
+			}
+			else
+			{
+				BN_Add(u1, u1, b);
+				BN_RShift_Bit_Inplace(u1, 1);
+				BN_Sub(v1, v1, a);
+				BN_RShift_Bit_Inplace(v1, 1);
+			}
+		}
+		if(!(BN_Cmp(t0, t1) == SMALL)) // (t0 >= t1) == !(t0 < t1) 
+		{
+			BN_Sub(t0, t0, t1);
+			BN_Sub(u0, u0, u1);
+			BN_Sub(v0, v0, v1);
+		}
+		else // (t1 > t0)
+		{
+			BN_Sub(t1, t1, t0);
+			BN_Sub(u1, u1, u0);
+			BN_Sub(v1, v1, v0);
+		}
+	}
+
+	BN_LShift_Bit(R, t1, k);
+	BN_Copy(X, u1);
+	BN_Copy(Y, v1);
+
+	BN_CTX_End(ctx);
+}
+
+/**
+ * @brief A^(-1) by Extended Binary GCD algorithm 
+ * @details
+ * - BIGNUM *R = A^(-1) mod p \n
+ * - BIGNUM *A : Positive Integer, *P : Prime \n
+ * - Lecture Note(틀림?) & Guide to ECC p.41 참고 \n
+ * - 임시 BN_CTX 사용 (반복 호출 시 BN_Ext_Binary_Inv_Ctx 사용) \n
+ * @param[out] BIGNUM *R 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *P (const)
+ * @date 2017. 04. 19. \n
+ * @todo 검증 X
  */
 void BN_Ext_Binary_Inv(BIGNUM *R, BIGNUM *A, BIGNUM *P)
 {	
-	BIGNUM t0, t1;
-	BIGNUM u0, u1;
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	BN_Ext_Binary_Inv_Ctx(R, A, P, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief A^(-1) by Extended Binary GCD algorithm (BN_CTX)
+ * @details
+ * - BN_Ext_Binary_Inv 와 동일, 임시 값은 BN_CTX *ctx 에서 재사용 \n
+ * - 1 bit shift 는 재할당 없는 BN_RShift_Bit_Inplace \n
+ * @param[out] BIGNUM *R 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *P (const)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Ext_Binary_Inv_Ctx(BIGNUM *R, BIGNUM *A, BIGNUM *P, BN_CTX *ctx)
+{	
+	BIGNUM *t0, *t1;
+	BIGNUM *u0, *u1;
 
-	BN_Init_Copy(&t0, A);
-	BN_Init_Copy(&t1, P);
-	BN_Init_One(&u0);
-	BN_Init_Zero(&u1);
+	BN_CTX_Start(ctx);
+	t0 = BN_CTX_Get_Copy(ctx, A);
+	t1 = BN_CTX_Get_Copy(ctx, P);
+	u0 = BN_CTX_Get_One(ctx);
+	u1 = BN_CTX_Get(ctx, 1);
 
-	while(BN_IsZero(&t0) == FALSE)
+	while(BN_IsZero(t0) == FALSE)
 	{
-		while((t0.Num[0] & 1) == 0)
+		while((t0->Num[0] & 1) == 0)
 		{
-			BN_RShift_Bit(&t0, &t0, 1);
-			if((u0.Num[0] & 1) == 0)
-				BN_RShift_Bit(&u0, &u0, 1);
+			BN_RShift_Bit_Inplace(t0, 1);
+			if((u0->Num[0] & 1) == 0)
+				BN_RShift_Bit_Inplace(u0, 1);
 			else
 			{
-				BN_Add(&u0, &u0, P);
-				BN_RShift_Bit(&u0, &u0, 1);
+				BN_Add(u0, u0, P);
+				BN_RShift_Bit_Inplace(u0, 1);
 			}
 		}
-		while((t1.Num[0] & 1) == 0)
+		while((t1->Num[0] & 1) == 0)
 		{
-			BN_RShift_Bit(&t1, &t1, 1);
-			if((u1.Num[0] & 1) == 0)
-				BN_RShift_Bit(&u1, &u1, 1);
+			BN_RShift_Bit_Inplace(t1, 1);
+			if((u1->Num[0] & 1) == 0)
+				BN_RShift_Bit_Inplace(u1, 1);
 			else
 			{
-				BN_Add(&u1, &u1, P);
-				BN_RShift_Bit(&u1, &u1, 1);
+				BN_Add(u1, u1, P);
+				BN_RShift_Bit_Inplace(u1, 1);
 			}
 		}
-		if(!(BN_Cmp(&t0, &t1) == SMALL)) // (t0 >= t1) == !(t0 < t1) 
+		if(!(BN_Cmp(t0, t1) == SMALL)) // (t0 >= t1) == !(t0 < t1) 
 		{
-			BN_Sub(&t0, &t0, &t1);
-			BN_Sub(&u0, &u0, &u1);
+			BN_Sub(t0, t0, t1);
+			BN_Sub(u0, u0, u1);
 		}
 		else // (t1 > t0)
 		{
-			BN_Sub(&t1, &t1, &t0);
-			BN_Sub(&u1, &u1, &u0);
+			BN_Sub(t1, t1, t0);
+			BN_Sub(u1, u1, u0);
 		}
 	}
 	
-	BN_Copy(R, &u1);
+	BN_Copy(R, u1);
 
-	BN_Zero_Free(&t0);
-	BN_Zero_Free(&t1);
-	BN_Zero_Free(&u0);
-	BN_Zero_Free(&u1);	
+	BN_CTX_End(ctx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -869,49 +1409,39 @@ void BN_Ext_Binary_Inv(BIGNUM *R, BIGNUM *A, BIGNUM *P)
  * - BN_Abs_Add() 함수 조건(Length) : A >= B  
  * - Sign 구분 없이 WORD 덧셈 -> R = |A| + |B|
  * - *R 의 최대 크기 : A.Length + 1
+ * - R = A or R = B 가능 (같은 index 읽은 후 저장)
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A 
  * @param[in] BIGNUM *B 
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. carry 계산 UW_Addc \n
  */
 void BN_Abs_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 {	
 	UNWORD i;
 	UNWORD carry = 0;		// 초기 Carry = 0
-	UNWORD tmp1, tmp2;
 		
-	// R 크기가 |A| + |B| 결과보다 작으면 재할당 
-	BN_Result_Size(R, A->Top + 1);
+	// R 크기가 |A| + |B| 결과보다 작으면 재할당
+	BN_Result_Size(R, A->Length + 1);
 	
+	// carry 는 UW_Addc (adc)
 	for(i = 0 ; i < B->Length ; i++) 
-	{
-		tmp1 = (A->Num[i] + carry) & WORD_MASK;
-		carry = (tmp1 < carry); // A + c < c 인 경우 carry 발생 
-		tmp2 = (tmp1 + B->Num[i]) & WORD_MASK;
-		carry += (tmp2 < tmp1); // A + B + c < A + c 인 경우 carry 발생
-		R->Num[i] = tmp2;					
-	}
+		carry = UW_Addc(&R->Num[i], A->Num[i], B->Num[i], carry);
 
 	// A > B 인 경우 나머지 A 부분 연산
 	if(carry)
 	{
 		for( ; i < A->Length ; i++)
-		{
-			tmp1 = (A->Num[i] + carry) & WORD_MASK;
-			carry = (tmp1 < carry);
-			R->Num[i] = tmp1;
-		}
-
-		if(carry)
-		{
-			R->Num[i] = carry;
-			R->Length = A->Length + 1;
-		}
+			carry = UW_Addc(&R->Num[i], A->Num[i], 0, carry);
 	}
 	else // carry = 0 이면 나머지 부분 그냥 덧셈
 		for( ; i < A->Length ; i++)
 			R->Num[i] = A->Num[i];
-	
+
+	// 최상위 carry (0 인 경우 Optimize 에서 제거)
+	R->Num[i] = carry;
+	R->Length = A->Length + 1;
+
 	R->Sign = PLUS;
 	// BIGNUM 최적화
 	BN_Optimize(R);	
@@ -925,45 +1455,35 @@ void BN_Abs_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B)
  * - BN_Abs_Sub() 함수 조건(Length) : A > B  
  * - Sign 구분 없이 WORD 덧셈 -> R = |A| - |B|
  * - *R 의 최대 크기 : A.Length
+ * - R = A or R = B 가능 (같은 index 읽은 후 저장)
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A 
  * @param[in] BIGNUM *B 
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. borrow 계산 UW_Subb \n
  */
 void BN_Abs_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 {	
 	UNWORD i;
 	UNWORD borrow = 0;	// 초기 borrow = 0
-	UNWORD tmp1, tmp2;	
 	
-	//// R 크기가 |A| - |B| 결과보다 작으면 재할당
-	//if(R->Length < A->Length)
-	//	BN_Realloc_Mem(R, (A->Length));	
+	// R 크기가 |A| - |B| 결과보다 작으면 재할당
+	BN_Result_Size(R, A->Length);
 
+	// borrow 는 UW_Subb (sbb)
 	for(i = 0 ; i < B->Length ; i++) 
-	{
-		tmp1 = (A->Num[i] - borrow) & WORD_MASK;
-		borrow = (tmp1 > A->Num[i]); // A - b > A 인 경우 borrow 발생
-		tmp2 = (tmp1 - B->Num[i]) & WORD_MASK;
-		borrow += (tmp1 < B->Num[i]); // A - b < B 인 경우 borrow 발생
-		R->Num[i] = tmp2;					
-	}
+		borrow = UW_Subb(&R->Num[i], A->Num[i], B->Num[i], borrow);
 	// A > B 인 경우 나머지 A 부분 연산
 	if(borrow)
 	{
 		for( ; i < A->Length ; i++)
-		{
-			tmp1 = (A->Num[i] - borrow) & WORD_MASK;
-			if(A->Num[i] > 0) // A->Num[i] > 0 이면 이후 borrow 발생 X
-				borrow = 0;
-			
-			R->Num[i] = tmp1;	
-		}
+			borrow = UW_Subb(&R->Num[i], A->Num[i], 0, borrow);
 	}
 	else // borrow = 0 이면 나머지 부분 그냥 
 		for( ; i < A->Length ; i++)
-			R->Num[i] = A->Num[i];	
+			R->Num[i] = A->Num[i];
 
+	R->Length = A->Length;
 	R->Sign = PLUS;
 	// BIGNUM 최적화
 	BN_Optimize(R);	
@@ -975,14 +1495,20 @@ void BN_Abs_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
  * @details
  * - BIGNUM *A 와 BIGNUM *B 를 더해서 BIGNUM *R 출력
  * - 부호 구분 가능
+ * - R = A or R = B 가능 (A + A 포함)
  * - WORD 덧셈 -> R = A + B
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A 
  * @param[in] BIGNUM *B 
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. R = A or R = B 허용 (입력 부호 먼저 저장) \n
  */
 void BN_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B)
-{		
+{
+	// R = A or R = B 인 경우 연산 중 부호 변경 -> 입력 부호 먼저 저장
+	SNWORD sa = A->Sign;
+	SNWORD sb = B->Sign;
+
 	// A or B 가 0 인 경우 단순 배열 복사
 	if(A->Length == 0)
 		BN_Copy(R, B);
@@ -990,16 +1516,15 @@ void BN_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 		BN_Copy(R, A);
 	else // A, B 모두 0 이 아닌 경우
 	{
-		if(A->Sign == B->Sign) 
+		if(sa == sb) 
 		{
 			//  a +  b =  (a + b)
 			// -a + -b = -(a + b)
-			R->Sign = A->Sign; // 결과 값 R 부호는 A, B 부호와 동일
-
 			if(A->Length >= B->Length)
 				BN_Abs_Add(R, A, B);
 			else // (A->Length < B->Length)
 				BN_Abs_Add(R, B, A);
+			R->Sign = sa; // 결과 값 R 부호는 A, B 부호와 동일
 		}
 		else // A->Sign != B->Sign 인 경우
 		{
@@ -1007,15 +1532,18 @@ void BN_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 			{
 				//  a + -b =  (a - b)
 				BN_Abs_Sub(R, A, B);
-				R->Sign = A->Sign; // 결과가 더 큰 수 부호 따라감
+				R->Sign = sa; // 결과가 더 큰 수 부호 따라감
 			}
 			else // // A <= B 인 경우 
 			{
 				// -a +  b =  (b - a)
 				BN_Abs_Sub(R, B, A);
-				R->Sign = B->Sign; // 결과가 더 큰 수 부호 따라감
+				R->Sign = sb; // 결과가 더 큰 수 부호 따라감
 			}
-		}		
+		}
+		// |A| = |B| 인 경우 결과 0
+		if(R->Length == 0)
+			R->Sign = ZERO;
 	}
 }
 
@@ -1025,15 +1553,29 @@ void BN_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B)
  * @details
  * - BIGNUM *A 에서 BIGNUM *B 를 빼서 BIGNUM *R 출력
  * - 부호 구분 가능
+ * - R = A or R = B 가능 (A - A 포함)
  * - WORD 뺄셈 -> R = A - B
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A 
  * @param[in] BIGNUM *B 
  * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. R = A or R = B 허용, A = 0 인 경우 부호 수정 \n
  */
 void BN_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 {	
-	if(A->Sign != B->Sign) 
+	// R = A or R = B 인 경우 연산 중 부호 변경 -> 입력 부호 먼저 저장
+	SNWORD sa = A->Sign;
+	SNWORD sb = B->Sign;
+
+	// B 가 0 인 경우 단순 배열 복사, A 가 0 인 경우 -B
+	if(B->Length == 0)
+		BN_Copy(R, A);
+	else if(A->Length == 0)
+	{
+		BN_Copy(R, B);
+		R->Sign = -sb;
+	}
+	else if(sa != sb) 
 	{	
 		if(BN_Abs_Cmp(A, B) == LARGE) // A > B 인 경우
 			BN_Abs_Add(R, A, B);
@@ -1042,7 +1584,7 @@ void BN_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 	
 		// ( a) - (-b) =  (a + b)
 		// (-a) - ( b) = -(a + b)
-		R->Sign = A->Sign; // 결과가 크기 상관 없이 A 부호 따라감
+		R->Sign = sa; // 결과가 크기 상관 없이 A 부호 따라감
 	}
 	else // A->Sign == B->Sign 인 경우
 	{
@@ -1051,22 +1593,69 @@ void BN_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 		if(BN_Abs_Cmp(A, B) == LARGE)
 		{
 			BN_Abs_Sub(R, A, B);
-			R->Sign = A->Sign; // 결과가 더 큰 수 부호 따라감
+			R->Sign = sa; // 결과가 더 큰 수 부호 따라감
 		}
 		else // (A->Length < B->Length)
 		{
 			BN_Abs_Sub(R, B, A);
-			R->Sign = -(B->Sign); // - 때문에 결과가 더 큰 수 반대 부호 따라감
+			R->Sign = -sb; // - 때문에 결과가 더 큰 수 반대 부호 따라감
 		}
+		// A = B 인 경우 결과 0
+		if(R->Length == 0)
+			R->Sign = ZERO;
 	}	
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Multiply with aliased output
+ * @details
+ * - R 이 A or B 와 같은 경우 곱셈 함수 mul 결과를 임시 값에 계산 후 R 로 복사 \n
+ * - 임시 값은 BN_SBO (작은 입력은 heap 할당 X) \n
+ * @param[in] mul 곱셈 함수 (R 과 A, B 는 다른 BIGNUM)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @date 2026. 10. 17. \n
+ */
+static void BN_Alias_Mul(void (*mul)(BIGNUM *, BIGNUM *, BIGNUM *), BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	BN_SBO t;
+
+	BN_SBO_Init(&t);
+	mul(&t.BN, A, B);
+	BN_Copy(R, &t.BN);
+	BN_Zero_Free(&t.BN);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Square with aliased output
+ * @details
+ * - R 이 A 와 같은 경우 제곱 함수 sqr 결과를 임시 값에 계산 후 R 로 복사 \n
+ * - 임시 값은 BN_SBO (작은 입력은 heap 할당 X) \n
+ * @param[in] sqr 제곱 함수 (R 과 A 는 다른 BIGNUM)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @date 2026. 10. 17. \n
+ */
+static void BN_Alias_Sqr(void (*sqr)(BIGNUM *, BIGNUM *), BIGNUM *R, BIGNUM *A)
+{
+	BN_SBO t;
+
+	BN_SBO_Init(&t);
+	sqr(&t.BN, A);
+	BN_Copy(R, &t.BN);
+	BN_Zero_Free(&t.BN);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /**
  * @brief Multiply BIGNUM *A and BIGNUM *B
  * @details
  * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력
- * - 기본 곱셈 방법 적용
+ * - 기본 곱셈 방법 적용 (row kernel : UW_Mul_1, UW_AddMul_1)
+ * - R = A or R = B 가능 (임시 값에 계산 후 복사)
  * - 부호 구분 가능
  * - WORD 곱셈 -> R = A * B
  * @param[out] BIGNUM *R
@@ -1076,10 +1665,13 @@ void BN_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
  */
 void BN_Basic_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 {	
-	UNWORD i, j, n;
-	UNWORD carry = 0;
-	UNWORD tmp[2];
-		
+	// R = A or R = B -> 임시 값에 계산 후 복사
+	if((R == A) || (R == B))
+	{
+		BN_Alias_Mul(BN_Basic_Mul, R, A, B);
+		return;
+	}
+
 	if((A->Length == 0) || (B->Length == 0)) // A or B 가 0 인 경우
 		BN_Zeroize(R); 
 	else if((A->Length == 1) && (A->Num[0] == 1)) // A = 1 or -1 인 경우
@@ -1088,36 +1680,10 @@ void BN_Basic_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 		BN_Copy(R, A);
 	else // 실제 곱셈 연산
 	{
-		for(i = 0 ; i < A->Length ; i++)
-		{
-			for(j = 0 ; j < B->Length ; j++)
-			{
-				// WORD * WORD 곱셈 , tmp[1]|tmp[0] 출력
-				UW_Mul(tmp, A->Num[i], B->Num[j]);
-				
-				// 결과 배열에 tmp[0] 추가
-				R->Num[i + j] += tmp[0];
-				carry = (R->Num[i + j] < tmp[0]); // carry 
-				tmp[1] = (tmp[1] + carry);
-				
-				// carry 고려한 덧셈
-				carry = (tmp[1] < carry); // tmp[1] + c < c 인 경우 carry 
-				R->Num[i + j + 1] += tmp[1];
-				carry += (R->Num[i + j + 1] < tmp[1]); // A + B + c < A + c 인 경우 carry 발생
-				
-				// 이후 상위 배열에 대한 carry 고려, 최대 배열 : R->Num[A->Length + B->Length - 1]
-				if((carry == 1) && ((i + j + 1) < (A->Length + B->Length)))
-				{
-					n = (i + j + 1);
-					while (carry) // 상위 배열로 올라가면서 carry 계산
-					{
-						n++;
-						R->Num[n] += carry;
-						carry = (R->Num[n] < carry);
-					}
-				}
-			}
-		}
+		BN_Result_Size(R, (A->Length + B->Length));
+		// row kernel (UW_Mul_1, UW_AddMul_1) 곱셈
+		UW_Row_Mul(R->Num, A->Num, A->Length, B->Num, B->Length);
+		R->Length = A->Length + B->Length;
 	}
 	
 	// 부호 결정
@@ -1128,126 +1694,232 @@ void BN_Basic_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 }
 
 /**
- * @brief Multiply BIGNUM *A and BIGNUM *B by Karatsuba Multiplication
+ * @brief Multiply BIGNUM *A and BIGNUM *B by Comba Multiplication
  * @details
  * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력
- * - 기본 곱셈 방법 적용
+ * - Comba (product-scanning) 곱셈, 결과 WORD 는 한 번만 저장
  * - 부호 구분 가능
+ * - R = A or R = B 가능 (임시 값에 계산 후 복사)
  * - WORD 곱셈 -> R = A * B
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A 
  * @param[in] BIGNUM *B 
- * @date 2017. 04. 17. \n
- * @todo TEST Vector 맞춰야 함 / input optimize 조건
+ * @date 2026. 10. 17. \n
  */
-void BN_Kara_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+void BN_Comba_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 {
-	BIGNUM u0, v0, u1, v1;					// 구조체만 이용 (A 의 Num 사용)
-	BIGNUM us, vs, u0v0, u1v1, usvs, tmp1, tmp2;	// BIGNUM 생성해서 이용
-	
-	UNWORD d, q, p;
-	UNWORD d0 = 1;
+	// R = A or R = B -> 임시 값에 계산 후 복사
+	if((R == A) || (R == B))
+	{
+		BN_Alias_Mul(BN_Comba_Mul, R, A, B);
+		return;
+	}
+
+	if((A->Length == 0) || (B->Length == 0)) // A or B 가 0 인 경우
+		BN_Zeroize(R); 
+	else if((A->Length == 1) && (A->Num[0] == 1)) // A = 1 or -1 인 경우
+		BN_Copy(R, B);
+	else if((B->Length == 1) && (B->Num[0] == 1)) // B = 1 or -1 인 경우 
+		BN_Copy(R, A);
+	else
+	{
+		BN_Result_Size(R, (A->Length + B->Length));
+		UW_Comba_Mul(R->Num, A->Num, A->Length, B->Num, B->Length);
+		R->Length = A->Length + B->Length;
+	}
 	
-	// d = max(a,b) 
-	d = (A->Length > B->Length) ? A->Length : B->Length;
-	// Floor, Ceil 과정 (p <= q)
-	// d = p + q
-	p = (d >> 1);
-	q = (d & 1) ? (p + 1) : (p);	
-		
-	if(p > d0) // d > KARA_THRESHOLD(d0) 인 경우 카라츄바 곱셈 
-	{		
-		// u0, u1, v0, v1 설정
-		u0.Num = A->Num;		// u0 = (q-1, q-2, ..., 0)		// u0.Length = q
-		u1.Num = A->Num + q;	// u1 = (p+q-1, p+q-2, ..., q)	// u1.Length = p = (A->Length - q)
-		v0.Num = B->Num;		// v0 = (q-1, q-2, ..., 0)		// v0.Length = q
-		v1.Num = B->Num + q;	// v1 = (p+q-1, p+q-2, ..., q)	// v1.Length = p = (B->Length - q)
-				
-		// Positive Multiprecision Integers
-		u0.Sign = u1.Sign = PLUS;
-		v0.Sign = v1.Sign = PLUS;
-				
-		// p, q 범위 정하기 (중요)
-		if(q > A->Length) // u1.Length = (A->Length - q) < 0
-		{
-			u0.Length = A->Length;
-			u1.Length = 0;
-		}
-		else
-		{
-			u0.Length = q;
-			u1.Length = (p > A->Length - q) ? (A->Length - q) : p;
-		}
-		if(q > B->Length)
-		{
-			v0.Length = B->Length;
-			v1.Length = 0;
-		}
-		else
-		{
-			v0.Length = q;
-			v1.Length = (p > B->Length - q) ? (B->Length - q) : p;
-		}
-		// 연산 결과 BIGNUM 생성
-		BN_Init(&us, (u0.Length + 1), PLUS, DEFAULT);
-		BN_Init(&vs, (v0.Length + 1), PLUS, DEFAULT);
-		BN_Init(&u0v0, (u0.Length + v0.Length), PLUS, DEFAULT);
-		BN_Init(&u1v1, (u1.Length + v1.Length), PLUS, DEFAULT);
-		BN_Init(&usvs, (us.Length + vs.Length), PLUS, DEFAULT);
-		BN_Init(&tmp1, (us.Length + vs.Length), PLUS, DEFAULT);
-		
-		// u0 + u1
-		BN_Abs_Add(&us, &u0, &u1);
-		// v0 + v1
-		BN_Abs_Add(&vs, &v0, &v1);
-		// u0v0
-		BN_Kara_Mul(&u0v0, &u0, &v0);
-		// u1v1
-		BN_Kara_Mul(&u1v1, &u1, &v1);
-		// ((usvs - u1v1) - u0v0) = usvs > 0
-		BN_Kara_Mul(&usvs, &us, &vs);
-		BN_Abs_Sub(&tmp1, &usvs, &u1v1);
-		BN_Zeroize(&usvs);
-		BN_Abs_Sub(&usvs, &tmp1, &u0v0);
-
-		// R = (u1v1)^2q + (usvs)^q + u0v0
-		// R += u0v0
-		BN_Zero_Realloc_Mem(&tmp1, u0v0.Length + 1);
-		BN_Init_Zero(&tmp2); 
-		R->Length = u0v0.Length + 1; // carry 고려하여 길이 + 1
-		BN_Abs_Add(R, &tmp2, &u0v0);
-		// R += (usvs)^q
-		R->Num += q;
-		R->Length = usvs.Length + 1; 
-		BN_Abs_Add(R, R, &usvs);
-		// R += (u1v1)^2q
-		R->Num += q;
-		R->Length = u1v1.Length + 1; 
-		BN_Abs_Add(R, R, &u1v1);
-		
-		// R 길이 수정
-		R->Length = A->Length + B->Length; 
-		R->Num -= (q << 1);
-
-		// BIGNUM 할당 해제 
-		BN_Zero_Free(&us);
-		BN_Zero_Free(&vs);
-		BN_Zero_Free(&u0v0);
-		BN_Zero_Free(&u1v1);
-		BN_Zero_Free(&usvs);
-		BN_Zero_Free(&tmp1);
-		BN_Zero_Free(&tmp2);
-	}
-	else // d <= KARA_THRESHOLD(d0) 인 경우 기본 Mul 수행
-		BN_Basic_Mul(R, A, B);
-		
+	// 부호 결정
+	R->Sign = (A->Sign * B->Sign);
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
 }
 
 /**
- * @brief Multiplication (Basic or Karatsuba)
+ * @brief Multiply BIGNUM *A and BIGNUM *B by Karatsuba Multiplication
  * @details
  * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력
- * - 기본 곱셈 방법 적용
+ * - WORD 배열 Karatsuba (UW_Kara_Mul), 임시 배열은 한 번만 할당 (UW_Alloc_Get 할당자, 실패 시 기본 곱셈)
+ * - 불균형 입력은 작은 쪽 길이 단위로 나누어 곱셈
+ * - 작은 쪽 길이 < KARA_THRESHOLD 이면 기본 곱셈
+ * - 부호 구분 가능
+ * - WORD 곱셈 -> R = A * B
+ * - R = A or R = B 가능 (임시 값에 계산 후 복사)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @date 2017. 04. 17. \n
+ * @date 2026. 10. 17. WORD 배열 Karatsuba 로 변경 (재귀 중 메모리 할당 없음) \n
+ * @date 2026. 10. 18. 임시 배열 UW_Mem_Alloc 할당, 실패 확인 \n
+ */
+void BN_Kara_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	UNWORD *t;
+	UNWORD n, len;
+	const UW_ALLOC *alloc;
+
+	// R = A or R = B -> 임시 값에 계산 후 복사
+	if((R == A) || (R == B))
+	{
+		BN_Alias_Mul(BN_Kara_Mul, R, A, B);
+		return;
+	}
+
+	if((A->Length == 0) || (B->Length == 0)) // A 또는 B 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	n = (A->Length > B->Length) ? A->Length : B->Length;
+	BN_Result_Size(R, (A->Length + B->Length));
+
+	// 임시 배열 할당 (전체 재귀에서 공유), 할당 실패 시 기본 곱셈
+	len = UW_Kara_Scratch_Size(n) + 1;
+	alloc = UW_Alloc_Get();
+	t = UW_Mem_Alloc(alloc, len);
+	if(t != NULL)
+	{
+		UW_Kara_Mul(R->Num, A->Num, A->Length, B->Num, B->Length, t);
+		UW_Mem_Free(alloc, t, len);
+	}
+	else
+		UW_Base_Mul(R->Num, A->Num, A->Length, B->Num, B->Length);
+
+	R->Length = A->Length + B->Length;
+
+	// 부호 결정
+	R->Sign = (A->Sign * B->Sign);
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+/**
+ * @brief Multiply BIGNUM *A and BIGNUM *B by Toom-Cook Multiplication
+ * @details
+ * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력
+ * - WORD 배열 Toom-3 / Toom-4 (UW_Toom_Mul), 임시 배열은 한 번만 할당 (UW_Alloc_Get 할당자, 실패 시 기본 곱셈)
+ * - 작은 쪽 길이 < TOOM3_THRESHOLD 이면 Karatsuba
+ * - 부호 구분 가능
+ * - WORD 곱셈 -> R = A * B
+ * - R = A or R = B 가능 (임시 값에 계산 후 복사)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 임시 배열 UW_Mem_Alloc 할당, 실패 확인 \n
+ */
+void BN_Toom_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	UNWORD *t;
+	UNWORD n, len;
+	const UW_ALLOC *alloc;
+
+	// R = A or R = B -> 임시 값에 계산 후 복사
+	if((R == A) || (R == B))
+	{
+		BN_Alias_Mul(BN_Toom_Mul, R, A, B);
+		return;
+	}
+
+	if((A->Length == 0) || (B->Length == 0)) // A 또는 B 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	n = (A->Length > B->Length) ? A->Length : B->Length;
+	BN_Result_Size(R, (A->Length + B->Length));
+
+	// 임시 배열 할당 (전체 재귀에서 공유), 할당 실패 시 기본 곱셈
+	len = UW_Toom_Scratch_Size(n) + 1;
+	alloc = UW_Alloc_Get();
+	t = UW_Mem_Alloc(alloc, len);
+	if(t != NULL)
+	{
+		UW_Toom_Mul(R->Num, A->Num, A->Length, B->Num, B->Length, t);
+		UW_Mem_Free(alloc, t, len);
+	}
+	else
+		UW_Base_Mul(R->Num, A->Num, A->Length, B->Num, B->Length);
+
+	R->Length = A->Length + B->Length;
+
+	// 부호 결정
+	R->Sign = (A->Sign * B->Sign);
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+#if defined(UW_NTT)
+/**
+ * @brief Multiply BIGNUM *A and BIGNUM *B by NTT Multiplication
+ * @details
+ * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력
+ * - 3-prime NTT 합성곱 + CRT (UW_NTT_Mul), 임시 배열은 한 번만 할당 (UW_Alloc_Get 할당자, 실패 시 기본 곱셈)
+ * - 수백만 bit 이상 입력용 (NTT_THRESHOLD)
+ * - 부호 구분 가능
+ * - WORD 곱셈 -> R = A * B
+ * - R = A or R = B 가능 (임시 값에 계산 후 복사)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 임시 배열 UW_Mem_Alloc 할당, 실패 확인 \n
+ */
+void BN_NTT_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	UNLONG *t;
+	UNWORD len;
+	const UW_ALLOC *alloc;
+
+	// R = A or R = B -> 임시 값에 계산 후 복사
+	if((R == A) || (R == B))
+	{
+		BN_Alias_Mul(BN_NTT_Mul, R, A, B);
+		return;
+	}
+
+	if((A->Length == 0) || (B->Length == 0)) // A 또는 B 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	BN_Result_Size(R, (A->Length + B->Length));
+
+	// 임시 배열 할당 (소수별 변환 결과 + twiddle, UNLONG -> WORD 개수), 할당 실패 시 기본 곱셈
+	len = UW_NTT_Scratch_Size(A->Length + B->Length) * (sizeof(UNLONG) / sizeof(UNWORD));
+	alloc = UW_Alloc_Get();
+	t = (UNLONG *)UW_Mem_Alloc(alloc, len);
+	if(t != NULL)
+	{
+		UW_NTT_Mul(R->Num, A->Num, A->Length, B->Num, B->Length, t);
+		UW_Mem_Free(alloc, (UNWORD *)t, len);
+	}
+	else
+		UW_Base_Mul(R->Num, A->Num, A->Length, B->Num, B->Length);
+
+	R->Length = A->Length + B->Length;
+
+	// 부호 결정
+	R->Sign = (A->Sign * B->Sign);
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+#endif
+
+/**
+ * @brief Multiplication (Basic, Karatsuba, Toom-Cook or NTT)
+ * @details
+ * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력
+ * - 입력 길이에 따라 Comba / Karatsuba / Toom-Cook / NTT 선택 (KARA_THRESHOLD, TOOM3_THRESHOLD, NTT_THRESHOLD)
+ * - 같은 길이의 고정 길이 입력 (256, 384, 521, 2048, 4096-bit) 은 UW_Fixed_Mul 사용
+ * - A 와 B 가 같은 BIGNUM 이면 BN_Sqr 사용
+ * - R = A or R = B 가능 (임시 값에 계산 후 복사)
  * - 부호 구분 가능
  * - WORD 곱셈 -> R = A * B
  * @param[out] BIGNUM *R
@@ -1258,8 +1930,52 @@ void BN_Kara_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
  */
 void BN_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
 {
-	BN_Kara_Mul(R, A, B);
-	//BN_Basic_Mul(R, A, B);
+	UNWORD n = A->Length;
+
+	// A * A -> 제곱
+	if(A == B)
+	{
+		BN_Sqr(R, A);
+		return;
+	}
+
+	// R = A or R = B -> 임시 값에 계산 후 복사
+	if((R == A) || (R == B))
+	{
+		BN_Alias_Mul(BN_Mul, R, A, B);
+		return;
+	}
+
+	// 고정 길이 (256, 384, 521, 2048, 4096-bit) 입력 -> unroll 된 고정 길이 곱셈
+	if((n == B->Length) && (n != 0))
+	{
+		BN_Result_Size(R, (n << 1));
+		if(UW_Fixed_Mul(R->Num, A->Num, B->Num, n) == TRUE)
+		{
+			R->Length = (n << 1);
+			R->Sign = A->Sign * B->Sign;
+			BN_Optimize(R);
+			return;
+		}
+	}
+
+	// KARA_THRESHOLD 보다 작은 입력 -> 기본 곱셈 (Comba, MULX / ADX 사용 가능하면 row kernel)
+	if((A->Length < KARA_THRESHOLD) || (B->Length < KARA_THRESHOLD))
+	{
+#if defined(UW_ASM_MULX_ADX)
+		BN_Basic_Mul(R, A, B);
+#else
+		BN_Comba_Mul(R, A, B);
+#endif
+	}
+	else if((A->Length < TOOM3_THRESHOLD) || (B->Length < TOOM3_THRESHOLD))
+		BN_Kara_Mul(R, A, B);
+#if defined(UW_NTT)
+	else if((A->Length >= NTT_THRESHOLD) && (B->Length >= NTT_THRESHOLD))
+		BN_NTT_Mul(R, A, B);
+#endif
+	else // TOOM3_THRESHOLD 이상 -> Toom-3 / Toom-4
+		BN_Toom_Mul(R, A, B);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1268,81 +1984,60 @@ void BN_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
  * @details
  * - BIGNUM *A 의 제곱 결과 BIGNUM *R 출력
  * - 곱셈 보다 UNWORD 곱의 수 적음
+ * - R = A 가능 (임시 값에 계산 후 복사)
  * - 부호 구분 가능
  * - WORD 곱셈 -> R = (A)^2
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A 
  * @date 2017. 03. 28. v1.00 \n
+ * @date 2026. 10. 17. R = A 허용 \n
  */
 void BN_Sqr(BIGNUM *R, BIGNUM *A)
 {
-	UNWORD i, j, n;
-	UNWORD carry = 0;
-	UNWORD tmp[3];
-	UNWORD m0, m1;
+	UNWORD n;
 			
+	// R = A -> 임시 값에 계산 후 복사
+	if(R == A)
+	{
+		BN_Alias_Sqr(BN_Sqr, R, A);
+		return;
+	}
+
 	if((A->Length == 1 && A->Num[0] == 0) || (A->Length == 0)) // A 가 0 인 경우
 		BN_Zeroize(R); 
 	else if((A->Length == 1) && (A->Num[0] == 1)) // A = 1 or -1 인 경우
 		BN_Copy(R, A);
 	else // 실제 제곱 연산
 	{
-		for(i = 0 ; i < A->Length ; i++)
+		n = A->Length;
+		BN_Result_Size(R, (n << 1));
+		// 고정 길이 입력은 unroll 된 고정 길이 제곱
+		if(UW_Fixed_Sqr(R->Num, A->Num, n) == FALSE)
 		{
-			m0 = i << 1; // (2 * i)
-			m1 = m0 + 1; // (2 * i) + 1
-
-			// (WORD)^2 제곱 , tmp[1]|tmp[0] 출력
-			UW_Sqr(tmp, A->Num[i]);
-
-			// 결과 배열에 tmp[0] 추가
-			R->Num[m0] += tmp[0];
-			carry = (R->Num[m0] < tmp[0]); // carry 
-
-			// carry 고려한 덧셈
-			tmp[1] = (tmp[1] + carry);
-			carry = (tmp[1] < carry); // tmp[1] + c < c 인 경우 carry 
-			R->Num[m1] += tmp[1];
-			if(R->Num[m1] < tmp[1]) // A + B + c < A + c 인 경우 carry 발생
-				carry += 1;
-						
-			// 이후 상위 배열에 대한 carry 고려, 최대 배열 : R->Num[(2 * A->Length) - 1]
-			if((carry == 1) && (m1 < (A->Length << 1)))
+			// NTT_SQR_THRESHOLD 이상 -> NTT 제곱
+			// TOOM3_SQR_THRESHOLD 이상 -> Toom-3 / Toom-4 제곱
+			// KARA_SQR_THRESHOLD 이상 -> Karatsuba 제곱
+			// 나머지 -> Comba 제곱 (MULX / ADX 사용 가능하면 row kernel 제곱)
+#if defined(UW_NTT)
+			if(n >= NTT_SQR_THRESHOLD)
 			{
-				while (carry) // 상위 배열로 올라가면서 carry 계산
-				{
-					m1++;
-					R->Num[m1] += carry;
-					carry = (R->Num[m1] < carry);
-				}
+				BN_NTT_Sqr(R, A);
+				return;
 			}
-			
-			for(j = i + 1 ; j < A->Length ; j++)
+#endif
+			if(n >= TOOM3_SQR_THRESHOLD)
 			{
-				// (WORD * WORD) * 2 , tmp[2]|tmp[1]|tmp[0] 출력 (최대 3 배열)
-				UW_Mul2(tmp, A->Num[i], A->Num[j]);
-				
-				// 결과 배열에 tmp[0] 추가
-				R->Num[i + j] += tmp[0];
-				carry = (R->Num[i + j] < tmp[0]); // carry 
-				tmp[1] = (tmp[1] + carry);
-				carry = (tmp[1] < carry); // tmp[1] + c < c 인 경우 carry 
-				R->Num[i + j + 1] += tmp[1];
-				carry += (R->Num[i + j + 1] < tmp[1]) + tmp[2]; // A + B + c < A + c 인 경우 carry 발생
-				
-				// 이후 상위 배열에 대한 carry 고려, 최대 배열 : (2 * R->Num[A->Length]) - 1]
-				if((carry > 0) && ((i + j + 1) < (A->Length << 1)))
-				{
-					n = (i + j + 1);
-					while (carry) // 상위 배열로 올라가면서 carry 계산
-					{
-						n++;
-						R->Num[n] += carry;
-						carry = (R->Num[n] < carry);
-					}
-				}
+				BN_Toom_Sqr(R, A);
+				return;
 			}
+			if(n >= KARA_SQR_THRESHOLD)
+			{
+				BN_Kara_Sqr(R, A);
+				return;
+			}
+			UW_Base_Sqr(R->Num, A->Num, n);
 		}
+		R->Length = (n << 1);
 	}
 	
 	// 부호 무조건 양수
@@ -1352,109 +2047,944 @@ void BN_Sqr(BIGNUM *R, BIGNUM *A)
 	BN_Optimize(R);	
 }
 
+/**
+ * @brief Square BIGNUM *A by Comba Square
+ * @details
+ * - BIGNUM *A 의 제곱 결과 BIGNUM *R 출력
+ * - Comba (product-scanning) 제곱, 결과 WORD 는 한 번만 저장
+ * - R = A 가능 (임시 값에 계산 후 복사)
+ * - WORD 곱셈 -> R = (A)^2
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @date 2026. 10. 17. \n
+ */
+void BN_Comba_Sqr(BIGNUM *R, BIGNUM *A)
+{
+	// R = A -> 임시 값에 계산 후 복사
+	if(R == A)
+	{
+		BN_Alias_Sqr(BN_Comba_Sqr, R, A);
+		return;
+	}
+
+	if(A->Length == 0) // A 가 0 인 경우
+		BN_Zeroize(R); 
+	else
+	{
+		BN_Result_Size(R, (A->Length << 1));
+		UW_Comba_Sqr(R->Num, A->Num, A->Length);
+		R->Length = (A->Length << 1);
+	}
+
+	// 부호 무조건 양수
+	R->Sign = PLUS;
+	
+	// BIGNUM 최적화
+	BN_Optimize(R);	
+}
+
+/**
+ * @brief Square BIGNUM *A by Karatsuba Square
+ * @details
+ * - BIGNUM *A 의 제곱 결과 BIGNUM *R 출력
+ * - WORD 배열 Karatsuba 제곱 (UW_Kara_Sqr), 임시 배열은 한 번만 할당 (UW_Alloc_Get 할당자, 실패 시 기본 제곱)
+ * - 길이 < KARA_SQR_THRESHOLD 이면 기본 제곱
+ * - WORD 곱셈 -> R = (A)^2
+ * - R = A 가능 (임시 값에 계산 후 복사)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 임시 배열 UW_Mem_Alloc 할당, 실패 확인 \n
+ */
+void BN_Kara_Sqr(BIGNUM *R, BIGNUM *A)
+{
+	UNWORD *t;
+	UNWORD n = A->Length, len;
+	const UW_ALLOC *alloc;
+
+	// R = A -> 임시 값에 계산 후 복사
+	if(R == A)
+	{
+		BN_Alias_Sqr(BN_Kara_Sqr, R, A);
+		return;
+	}
+
+	if(n == 0) // A 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	BN_Result_Size(R, (n << 1));
+
+	// 임시 배열 할당 (전체 재귀에서 공유), 할당 실패 시 기본 제곱
+	len = UW_Kara_Sqr_Scratch_Size(n) + 1;
+	alloc = UW_Alloc_Get();
+	t = UW_Mem_Alloc(alloc, len);
+	if(t != NULL)
+	{
+		UW_Kara_Sqr(R->Num, A->Num, n, t);
+		UW_Mem_Free(alloc, t, len);
+	}
+	else
+		UW_Base_Sqr(R->Num, A->Num, n);
+
+	R->Length = (n << 1);
+
+	// 부호 무조건 양수
+	R->Sign = PLUS;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+/**
+ * @brief Square BIGNUM *A by Toom-Cook Square
+ * @details
+ * - BIGNUM *A 의 제곱 결과 BIGNUM *R 출력
+ * - WORD 배열 Toom-3 / Toom-4 제곱 (UW_Toom_Sqr), 임시 배열은 한 번만 할당 (UW_Alloc_Get 할당자, 실패 시 기본 제곱)
+ * - 길이 < TOOM3_SQR_THRESHOLD 이면 Karatsuba 제곱
+ * - WORD 곱셈 -> R = (A)^2
+ * - R = A 가능 (임시 값에 계산 후 복사)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 임시 배열 UW_Mem_Alloc 할당, 실패 확인 \n
+ */
+void BN_Toom_Sqr(BIGNUM *R, BIGNUM *A)
+{
+	UNWORD *t;
+	UNWORD n = A->Length, len;
+	const UW_ALLOC *alloc;
+
+	// R = A -> 임시 값에 계산 후 복사
+	if(R == A)
+	{
+		BN_Alias_Sqr(BN_Toom_Sqr, R, A);
+		return;
+	}
+
+	if(n == 0) // A 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	BN_Result_Size(R, (n << 1));
+
+	// 임시 배열 할당 (전체 재귀에서 공유), 할당 실패 시 기본 제곱
+	len = UW_Toom_Sqr_Scratch_Size(n) + 1;
+	alloc = UW_Alloc_Get();
+	t = UW_Mem_Alloc(alloc, len);
+	if(t != NULL)
+	{
+		UW_Toom_Sqr(R->Num, A->Num, n, t);
+		UW_Mem_Free(alloc, t, len);
+	}
+	else
+		UW_Base_Sqr(R->Num, A->Num, n);
+
+	R->Length = (n << 1);
+
+	// 부호 무조건 양수
+	R->Sign = PLUS;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+#if defined(UW_NTT)
+/**
+ * @brief Square BIGNUM *A by NTT Square
+ * @details
+ * - BIGNUM *A 의 제곱 결과 BIGNUM *R 출력
+ * - 3-prime NTT 제곱 (UW_NTT_Sqr, 소수마다 변환 한 번), 임시 배열은 한 번만 할당 (UW_Alloc_Get 할당자, 실패 시 기본 제곱)
+ * - WORD 곱셈 -> R = (A)^2
+ * - R = A 가능 (임시 값에 계산 후 복사)
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 임시 배열 UW_Mem_Alloc 할당, 실패 확인 \n
+ */
+void BN_NTT_Sqr(BIGNUM *R, BIGNUM *A)
+{
+	UNLONG *t;
+	UNWORD n = A->Length, len;
+	const UW_ALLOC *alloc;
+
+	// R = A -> 임시 값에 계산 후 복사
+	if(R == A)
+	{
+		BN_Alias_Sqr(BN_NTT_Sqr, R, A);
+		return;
+	}
+
+	if(n == 0) // A 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	BN_Result_Size(R, (n << 1));
+
+	// 임시 배열 할당 (소수별 변환 결과 + twiddle, UNLONG -> WORD 개수), 할당 실패 시 기본 제곱
+	len = UW_NTT_Scratch_Size(n << 1) * (sizeof(UNLONG) / sizeof(UNWORD));
+	alloc = UW_Alloc_Get();
+	t = (UNLONG *)UW_Mem_Alloc(alloc, len);
+	if(t != NULL)
+	{
+		UW_NTT_Sqr(R->Num, A->Num, n, t);
+		UW_Mem_Free(alloc, (UNWORD *)t, len);
+	}
+	else
+		UW_Base_Sqr(R->Num, A->Num, n);
+
+	R->Length = (n << 1);
+
+	// 부호 무조건 양수
+	R->Sign = PLUS;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Multiply BIGNUM *A and UNWORD w
+ * @details
+ * - BIGNUM *A 와 UNWORD w 를 곱한 결과 BIGNUM *R 출력 (word.c 의 BN_UW_Mul 대체) \n
+ * - row kernel UW_Mul_1 사용, R 의 최대 크기 : A.Length + 1 \n
+ * - R = A 가능 (같은 index 읽은 후 저장) \n
+ * - WORD 곱셈 -> R = A * w
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] UNWORD w (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Mul_Word(BIGNUM *R, BIGNUM *A, const UNWORD w)
+{
+	UNWORD n = A->Length;
+	SNWORD sa = A->Sign;
+
+	// A or w 가 0 인 경우
+	if((n == 0) || (w == 0))
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	// R = A 인 경우 n + 1 >= Length -> 값 유지
+	BN_Result_Size(R, n + 1);
+	R->Num[n] = UW_Mul_1(R->Num, A->Num, n, w);
+	R->Length = n + 1;
+	R->Sign = sa;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+/**
+ * @brief Accumulate product of word arrays into BIGNUM *R
+ * @details
+ * - |R| +- |a| * |b| 를 R 에 누적 (sign : 곱 a * b 의 부호) \n
+ * - L = max(R.Length, na + nb) 일 때 |R|, |a * b| < W^L -> 결과는 L + 1 WORD 안에 들어감 \n
+ * - 부호 같음 : row 마다 UW_AddMul_1 + carry 전파 (carry 없으면 바로 종료) \n
+ * - 부호 다름 : row 마다 UW_SubMul_1 + borrow 전파, mod W^(L+1) 로 계산 후 \n
+ *   최상위 WORD 가 0 이 아니면 (음수) 2 의 보수로 부호 반전 \n
+ * - R 과 a, b 는 다른 배열 (na, nb > 0) \n
+ * @param[in,out] BIGNUM *R
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const)
+ * @param[in] SNWORD sign (const) 누적할 곱의 부호 (PLUS or MINUS)
+ * @date 2026. 10. 17. \n
+ */
+static void BN_Acc_Mul(BIGNUM *R, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, const SNWORD sign)
+{
+	UNWORD i, j;
+	UNWORD c, tmp;
+	UNWORD L = (R->Length > (na + nb)) ? R->Length : (na + nb);
+
+	// R 배열 확장 (Num[R->Length ~ L] = 0)
+	BN_Result_Size(R, L + 1);
+
+	if(R->Sign == sign)
+	{
+		// |R| + |a| * |b|
+		for(j = 0 ; j < nb ; j++)
+		{
+			c = UW_AddMul_1(R->Num + j, a, na, b[j]);
+			UW_Add_1(R->Num + j + na, R->Num + j + na, L + 1 - j - na, c);
+		}
+	}
+	else
+	{
+		// |R| - |a| * |b| mod W^(L+1)
+		for(j = 0 ; j < nb ; j++)
+		{
+			c = UW_SubMul_1(R->Num + j, a, na, b[j]);
+			UW_Sub_1(R->Num + j + na, R->Num + j + na, L + 1 - j - na, c);
+		}
+
+		// |R| < |a| * |b| 인 경우 최상위 WORD = 1...1 -> 2 의 보수, 곱의 부호
+		if(R->Num[L] != 0)
+		{
+			c = 1;
+			for(i = 0 ; i <= L ; i++)
+			{
+				tmp = (~R->Num[i] + c) & WORD_MASK;
+				c = (tmp < c);
+				R->Num[i] = tmp;
+			}
+			R->Sign = sign;
+		}
+	}
+	R->Length = L + 1;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Multiply-add BIGNUM *A and UNWORD w to BIGNUM *R
+ * @details
+ * - R 에 A * w 를 더함 (곱셈 결과 임시 값 X) \n
+ * - R = A 가능 (임시 값에 계산 후 덧셈) \n
+ * - 부호 구분 가능
+ * - WORD 곱셈 -> R = R + A * w
+ * @param[in,out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] UNWORD w (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_AddMul_Word(BIGNUM *R, BIGNUM *A, const UNWORD w)
+{
+	BN_SBO t;
+
+	// A or w 가 0 인 경우 R 유지
+	if((A->Length == 0) || (w == 0))
+		return;
+
+	// R = A -> 임시 값에 계산 후 덧셈
+	if(R == A)
+	{
+		BN_SBO_Init(&t);
+		BN_Mul_Word(&t.BN, A, w);
+		BN_Add(R, R, &t.BN);
+		BN_Zero_Free(&t.BN);
+		return;
+	}
+
+	BN_Acc_Mul(R, A->Num, A->Length, &w, 1, A->Sign);
+}
+
+/**
+ * @brief Accumulate product of BIGNUM *A and BIGNUM *B
+ * @details
+ * - R = R + sign * A * B (BN_MulAdd, BN_MulSub 공통) \n
+ * - R = A or R = B, 또는 Karatsuba 이상 크기 입력 -> 곱셈 결과 임시 값 (BN_SBO) 에 계산 후 덧셈 \n
+ * - 나머지 -> BN_Acc_Mul 로 R 에 바로 누적 \n
+ * @param[in,out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @param[in] SNWORD sign (const) PLUS : 덧셈, MINUS : 뺄셈
+ * @date 2026. 10. 17. \n
+ */
+static void BN_MulAcc(BIGNUM *R, BIGNUM *A, BIGNUM *B, const SNWORD sign)
+{
+	BN_SBO t;
+
+	// A or B 가 0 인 경우 R 유지
+	if((A->Length == 0) || (B->Length == 0))
+		return;
+
+	if((R == A) || (R == B) || ((A->Length >= KARA_THRESHOLD) && (B->Length >= KARA_THRESHOLD)))
+	{
+		BN_SBO_Init(&t);
+		BN_Mul(&t.BN, A, B);
+		t.BN.Sign *= sign;
+		BN_Add(R, R, &t.BN);
+		BN_Zero_Free(&t.BN);
+		return;
+	}
+
+	BN_Acc_Mul(R, A->Num, A->Length, B->Num, B->Length, A->Sign * B->Sign * sign);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Multiply-add BIGNUM *A and BIGNUM *B to BIGNUM *R
+ * @details
+ * - R 에 A * B 를 더함 (Karatsuba 보다 작은 입력은 곱셈 결과 임시 값 X) \n
+ * - R = A or R = B 가능 (임시 값에 계산 후 덧셈) \n
+ * - 부호 구분 가능
+ * - WORD 곱셈 -> R = R + A * B
+ * @param[in,out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @date 2026. 10. 17. \n
+ */
+void BN_MulAdd(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	BN_MulAcc(R, A, B, PLUS);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Multiply-subtract BIGNUM *A and BIGNUM *B from BIGNUM *R
+ * @details
+ * - R 에서 A * B 를 뺌 (Karatsuba 보다 작은 입력은 곱셈 결과 임시 값 X) \n
+ * - R = A or R = B 가능 (임시 값에 계산 후 뺄셈) \n
+ * - 부호 구분 가능
+ * - WORD 곱셈 -> R = R - A * B
+ * @param[in,out] BIGNUM *R
+ * @param[in] BIGNUM *A 
+ * @param[in] BIGNUM *B 
+ * @date 2026. 10. 17. \n
+ */
+void BN_MulSub(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	BN_MulAcc(R, A, B, MINUS);
+}
+
+/**
+ * @brief Word slice of BIGNUM *A
+ * @details
+ * - R = |A| mod W^to / W^from (WORD 단위 shift, mod) \n
+ * - R == A 는 from == 0 인 경우만 가능 \n
+ * - 결과 값 상위 0 WORD 제거 (재할당 X) \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in] UNWORD from (const)
+ * @param[in] UNWORD to (const)
+ * @date 2026. 10. 17. \n
+ */
+static void BN_Word_Slice(BIGNUM *R, const BIGNUM *A, const UNWORD from, const UNWORD to)
+{
+	UNWORD i;
+	UNWORD end = (A->Length < to) ? A->Length : to;
+
+	if(end <= from)
+	{
+		R->Length = 0;
+		R->Sign = ZERO;
+		return;
+	}
+
+	BN_Result_Size(R, (end - from));
+	for(i = from ; i < end ; i++)
+		R->Num[i - from] = A->Num[i];
+	R->Length = end - from;
+	while((R->Length != 0) && (R->Num[R->Length - 1] == 0))
+		R->Length--;
+	R->Sign = (R->Length == 0) ? ZERO : PLUS;
+}
+
 /**
  * @brief Barret Reduction of BIGNUM (Modulus)
  * @details
- * - A mod N ,where 0 <= A < W^(2n), W^(n-1) <= N < W^n and T = Ceil((W^2n) / M) \n
+ * - A mod N ,where 0 <= A < W^(2n), W^(n-1) <= N < W^n and T = Floor((W^2n) / N) \n
  * - Lecture Note 참고 \n
+ * - 임시 BN_CTX 사용 (반복 호출 시 BN_Bar_Redc_Ctx 사용) \n
  * @param[out] BIGNUM *R 
  * @param[in] BIGNUM *A (const)
  * @param[in] BIGNUM *N (const)
  * @param[in] BIGNUM *T (const & Precomputation)
  * @date 2017. 03. 29. v1.00 \n
- * @todo 아직 미완성
  */
 void BN_Bar_Redc(BIGNUM *R, BIGNUM *A, BIGNUM *N, BIGNUM *T)
 {	
-	BIGNUM qh, qh_n;				
-	BIGNUM tmp1, tmp2;				
-	//UNWORD W = BIT_LEN;		// W = 2^(w), W : WORD 1개 크기 or 프로세서 단위 
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	BN_Bar_Redc_Ctx(R, A, N, T, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief Barret Reduction of BIGNUM (Modulus, BN_CTX)
+ * @details
+ * - A mod N ,where 0 <= A < W^(2n), W^(n-1) <= N < W^n and T = Floor((W^2n) / N) \n
+ * - Handbook of Applied Cryptography Algorithm 14.42 참고 \n
+ * - 임시 값은 BN_CTX *ctx 에서 재사용 \n
+ * - 같은 모듈러로 반복하는 경우 BN_Bar_Init + BN_Bar_Reduce (부분 곱만 계산, 할당 X) \n
+ * @param[out] BIGNUM *R 
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *N (const)
+ * @param[in] BIGNUM *T (const & Precomputation)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Bar_Redc_Ctx(BIGNUM *R, BIGNUM *A, BIGNUM *N, BIGNUM *T, BN_CTX *ctx)
+{	
+	BIGNUM *q, *r, *t;
+	UNWORD i;
 	UNWORD n = N->Length;	// n = Ceil(log_W(N)) + 1
-	
-	// 확인사항
-	// Input 조건 따져줘야 하나 ? -> P >= 3 
-	// Z == P 인 경우는 ??
-	// R 크기 문제
-	// Reduction 결과 최적화 문제 ?
 
-	// BIGNUM 연산 최대 크기 고려	
-	
 	// A < N 인 경우 -> Reduction 필요 X
 	if(BN_Abs_Cmp(A, N) == SMALL)
+	{
 		BN_Copy(R, A); 
-	else // A > N 인 경우 Reduction 수행
-	{	
-		// tmp1 = Ceil(A / W^(n-1)) 계산 (워드 단위 >> 쉬프트 연산)
-		tmp1.Num = A->Num + (n - 1); // 기준 포인터 위치 변경
-		tmp1.Length = A->Length - (n - 1); 
-		tmp1.Sign = PLUS; 
-		
-		// Ceil(A / W^(n-1)) * T
-		BN_Init(&qh, (tmp1.Length + T->Length), PLUS, DEFAULT); 
-		BN_Mul(&qh, &tmp1, T);
+		return;
+	}
 
-		// Ceil(qh / W^(n+1)) 계산 (워드 단위 >> 쉬프트 연산)
-		qh.Num += (n + 1); 
-		qh.Length -= (n + 1);
+	BN_CTX_Start(ctx);
+	q = BN_CTX_Get(ctx, (A->Length + T->Length));
+	r = BN_CTX_Get(ctx, (n + 2));
+	t = BN_CTX_Get(ctx, (n + 2));
 
-		// A mod W^(n+1) : n + 1 보다 작은 배열만 살림
-		tmp1.Num = A->Num;
-		tmp1.Length = n; // mod
-		
-		// (N * qh) mod W^(n+1)
-		BN_Init(&qh_n, (qh.Length + N->Length), PLUS, DEFAULT);
-		BN_Mul(&qh_n, &qh, N);
-		if(qh_n.Length > n)  
-			qh_n.Length = n; // mod
-
-		// A mod W^(n+1) - (qh * N) mod W^(n+1)
-		BN_Init(&tmp2, n, PLUS, DEFAULT);
-		BN_Sub(&tmp2, &tmp1, &qh_n); // tmp2 = R
-		
-		BN_Init(&tmp1, n + 1, PLUS, DEFAULT);		// n 개 tmp1.Num 배열 -> 0 으로 초기화
-		// R 이 음수 -> A += W^(n+1)
-		if(tmp2.Sign == MINUS)
-		{			
-			tmp1.Num[n - 1] = 1;					// 최상위 워드 = 1 : W^(n+1) ex) 0x10..0 
-			BN_Add(R, &tmp2, &tmp1);
-			if(BN_Abs_Cmp(R, N) != MINUS) // 아래 while문 때문에 추가
-				BN_Copy(&tmp2, R); 
-		}
-		// R >= N 이면 -> R - N 반복 (최대 2번)
-		while(BN_Abs_Cmp(&tmp2, N) != MINUS)
-		{
-			BN_Sub(R, &tmp2, N);
-			if(BN_Abs_Cmp(R, N) != MINUS) // 조건 만족하면 while문 한 번 더 반복
-				BN_Copy(&tmp2, R);
-		}
-		
+	// q = Floor(Floor(A / W^(n-1)) * T / W^(n+1)) (워드 단위 >> 쉬프트 연산)
+	BN_Word_Slice(t, A, (n - 1), A->Length);
+	BN_Mul(q, t, T);
+	BN_Word_Slice(t, q, (n + 1), q->Length);
+
+	// t = (q * N) mod W^(n+1)
+	if(t->Length != 0)
+	{
+		BN_Mul(q, t, N);
+		BN_Word_Slice(t, q, 0, (n + 1));
 	}
 
-	BN_Zero_Free(&qh);
-	BN_Zero_Free(&qh_n);		
-	BN_Zero_Free(&tmp1);
-	BN_Zero_Free(&tmp2);
+	// r = A mod W^(n+1) - (q * N) mod W^(n+1), 음수 -> r += W^(n+1)
+	BN_Word_Slice(r, A, 0, (n + 1));
+	if(BN_Abs_Cmp(r, t) == SMALL)
+	{
+		BN_Result_Size(r, (n + 2));
+		for(i = r->Length ; i < n + 1 ; i++)
+			r->Num[i] = 0;
+		r->Num[n + 1] = 1;				// 최상위 워드 = 1 : W^(n+1) ex) 0x10..0 
+		r->Length = n + 2;
+	}
+	BN_Abs_Sub(r, r, t);				// r >= t
 
-	// output optimize
+	// r >= N 이면 -> r - N 반복 (최대 2번)
+	while(BN_Abs_Cmp(r, N) != SMALL)
+		BN_Abs_Sub(r, r, N);
 
+	BN_Copy(R, r);
+
+	BN_CTX_End(ctx);
 }
 
 /**
- * @brief Montgomery Reduction of BIGNUM (Modulus)
+ * @brief Initialize Barrett reduction context
  * @details
- * - 
- * - Handbook of E&HC p.181 참고 \n
- * @param[out] BIGNUM *T 
+ * - 모듈러 N (> 1, n WORD) 복사, Mu = Floor(W^(2n) / N) 사전 계산, 임시 배열 할당 (한 번에 할당) \n
+ * - Mu : W^(2n) 을 WORD 단위 나눗셈 (UW_Div_n), 모듈러 마다 한 번만 수행 \n
+ * - 할당자는 UW_Alloc_Get() (BIGNUM 생성과 같은 규칙) \n
+ * @param[out] BN_BAR *ctx
  * @param[in] BIGNUM *N (const)
- * @param[in] BIGNUM *R (const)
- * @param[in] UNWORD Np (const)
- * @param[in] BIGNUM *U (const)
+ * @return TRUE (성공) / FALSE (N <= 1 or 할당 실패)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD BN_Bar_Init(BN_BAR *ctx, const BIGNUM *N)
+{
+	UNWORD i, len;
+	UNWORD n = N->Length;
+	UNWORD *x;
+
+	ctx->N = ctx->Mu = ctx->T = NULL;
+	ctx->n = ctx->Mu_Len = 0;
+	ctx->Alloc = UW_Alloc_Get();
+
+	if((N->Sign != PLUS) || (n == 0) || ((n == 1) && (N->Num[0] == 1)))
+		return FALSE;
+
+	// [N (n) | Mu (n + 2) | T] 한 번에 할당 (0 초기화)
+	ctx->N = UW_Mem_Alloc(ctx->Alloc, (2 * n + 2 + BN_BAR_SCRATCH(n)));
+	if(ctx->N == NULL)
+		return FALSE;
+	ctx->Mu = ctx->N + n;
+	ctx->T = ctx->Mu + n + 2;
+	ctx->n = n;
+	for(i = 0 ; i < n ; i++)
+		ctx->N[i] = N->Num[i];
+
+	// Mu = Floor(W^(2n) / N) : W^(2n) (2n + 1 WORD) long division, 몫 n + 2 WORD
+	len = 2 * n + 1 + UW_DIV_SCRATCH(2 * n + 1, n);
+	x = UW_Mem_Alloc(ctx->Alloc, len);
+	if(x == NULL)
+	{
+		BN_Bar_Free(ctx);
+		return FALSE;
+	}
+	x[2 * n] = 1;
+	UW_Div_n(ctx->Mu, NULL, x, (2 * n + 1), ctx->N, n, x + 2 * n + 1);
+	x[2 * n] = 0;
+	UW_Mem_Free(ctx->Alloc, x, len);
+
+	ctx->Mu_Len = n + 2;
+	while(ctx->Mu[ctx->Mu_Len - 1] == 0)
+		ctx->Mu_Len--;
+
+	return TRUE;
+}
+
+/**
+ * @brief Free Barrett reduction context
+ * @details
+ * - 모듈러 / Mu / 임시 배열 0 초기화 후 해제 \n
+ * @param[in,out] BN_BAR *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Bar_Free(BN_BAR *ctx)
+{
+	UNWORD i, len = 2 * ctx->n + 2 + BN_BAR_SCRATCH(ctx->n);
+
+	if(ctx->N != NULL)
+	{
+		for(i = 0 ; i < len ; i++)
+			ctx->N[i] = 0;
+		UW_Mem_Free(ctx->Alloc, ctx->N, len);
+	}
+	ctx->N = ctx->Mu = ctx->T = NULL;
+	ctx->n = ctx->Mu_Len = 0;
+}
+
+/**
+ * @brief Barrett Reduction of BIGNUM (BN_BAR context)
+ * @details
+ * - R = A mod N ,where 0 <= A < W^(2n) (ex. N 미만 두 값의 곱) \n
+ * - Handbook of Applied Cryptography Algorithm 14.42, Note 14.44 참고 \n
+ * - q = Floor(Floor(A / W^(n-1)) * Mu / W^(n+1)) : 부분 곱 중 (n - 1) 번째 WORD 이상만 계산 (q 는 최대 2 ~ 3 작게 근사) \n
+ * - r = (A - q * N) mod W^(n+1) : q * N 의 하위 (n + 1) WORD 만 계산, 뺄셈 borrow 무시 (mod W^(n+1)) \n
+ * - r >= N 이면 r - N 반복 (최대 4 번) \n
+ * - 임시 값은 ctx->T 사용 (할당 X, R 의 배열이 n WORD 보다 작은 경우만 R 재할당) \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] BN_BAR *ctx
+ * @return TRUE (성공) / FALSE (A < 0 or A >= W^(2n))
+ * @date 2026. 10. 17. \n
+ */
+SNWORD BN_Bar_Reduce(BIGNUM *R, const BIGNUM *A, BN_BAR *ctx)
+{
+	UNWORD i, j0, len;
+	UNWORD n = ctx->n, m = ctx->Mu_Len;
+	UNWORD na = A->Length;
+	UNWORD *q = ctx->T;					// q * Mu (2n + 4 WORD, (n - 1) 번째 WORD 부터 사용)
+	UNWORD *u = q + 2 * n + 4;			// q * N mod W^(n+1)
+	UNWORD *r = u + n + 1;				// A mod W^(n+1) -> 결과
+	const UNWORD *a1 = A->Num + (n - 1);	// Floor(A / W^(n-1)) (워드 단위 >> 쉬프트)
+	const UNWORD *q3 = q + (n + 1);		// Floor(q * Mu / W^(n+1))
+
+	if((A->Sign == MINUS) || (na > 2 * n))
+		return FALSE;
+
+	// A < N 인 경우 -> Reduction 필요 X
+	if((na < n) || ((na == n) && (UW_Cmp_n(A->Num, ctx->N, n) == SMALL)))
+	{
+		BN_Copy(R, A);
+		return TRUE;
+	}
+
+	// q * Mu 상위 : 열 (i + j) >= n - 1 인 부분 곱만 누적 (행 단위, 행 끝 carry 는 새 WORD)
+	for(i = n - 1 ; i < 2 * n + 4 ; i++)
+		q[i] = 0;
+	for(i = 0 ; i < na - (n - 1) ; i++)
+	{
+		j0 = (i + 1 < n) ? (n - 1 - i) : 0;
+		q[i + m] = UW_AddMul_1(q + i + j0, ctx->Mu + j0, m - j0, a1[i]);
+	}
+
+	// u = q3 * N mod W^(n+1) : 열 (i + j) <= n 인 부분 곱만 누적 (q3 < W^(n+1))
+	u[n] = UW_Mul_1(u, ctx->N, n, q3[0]);
+	for(i = 1 ; i <= n ; i++)
+	{
+		len = n + 1 - i;
+		if(len > n)
+			len = n;
+		UW_AddMul_1(u + i, ctx->N, len, q3[i]);
+	}
+
+	// r = (A mod W^(n+1)) - u mod W^(n+1)
+	len = (na < n + 1) ? na : (n + 1);
+	for(i = 0 ; i < len ; i++)
+		r[i] = A->Num[i];
+	for( ; i < n + 1 ; i++)
+		r[i] = 0;
+	UW_Sub_n(r, r, u, n + 1);
+
+	// r >= N 이면 -> r - N 반복
+	while((r[n] != 0) || (UW_Cmp_n(r, ctx->N, n) != SMALL))
+		r[n] -= UW_Sub_n(r, r, ctx->N, n);
+
+	// 출력 (A 를 모두 읽은 후 -> R == A 가능)
+	BN_Result_Size(R, n);
+	for(i = 0 ; i < n ; i++)
+		R->Num[i] = r[i];
+	R->Length = n;
+	R->Sign = PLUS;
+	BN_Optimize(R);
+
+	return TRUE;
+}
+
+/**
+ * @brief Initialize Montgomery context
+ * @details
+ * - 홀수 모듈러 N (> 1, n WORD), R = W^n \n
+ * - N0 = -N^(-1) mod W, R^2 mod N : UW_Mont_Setup (R52 / BN_VEC 과 공통), R mod N : UW_Pow2_Mod \n
+ * - R mod N, R^2 mod N 은 W^n, W^(2n) 을 WORD 단위 나눗셈 (UW_Div_n), 모듈러 마다 한 번만 수행 \n
+ * - [N | R mod N | R^2 mod N | 임시 배열 | 지수승 table] 한 번에 할당 (할당자는 UW_Alloc_Get()) \n
+ * @param[out] BN_MONT *ctx
+ * @param[in] BIGNUM *N (const)
+ * @return TRUE (성공) / FALSE (N 짝수 or N <= 1 or 할당 실패)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. BN_Mont_Exp table 도 context 에 할당 \n
+ */
+SNWORD BN_Mont_Init(BN_MONT *ctx, const BIGNUM *N)
+{
+	UNWORD i, len;
+	UNWORD n = N->Length;
+	UNWORD *x;
+
+	ctx->N = ctx->R1 = ctx->RR = ctx->T = ctx->Tb = NULL;
+	ctx->n = ctx->N0 = 0;
+	ctx->Alloc = UW_Alloc_Get();
+
+	if((N->Sign != PLUS) || (n == 0) || ((N->Num[0] & 1) == 0) || ((n == 1) && (N->Num[0] == 1)))
+		return FALSE;
+
+	ctx->N = UW_Mem_Alloc(ctx->Alloc, (3 * n + BN_MONT_SCRATCH(n) + BN_MONT_TABLE(n)));
+	if(ctx->N == NULL)
+		return FALSE;
+	ctx->R1 = ctx->N + n;
+	ctx->RR = ctx->R1 + n;
+	ctx->T = ctx->RR + n;
+	ctx->Tb = ctx->T + BN_MONT_SCRATCH(n);
+	ctx->n = n;
+	for(i = 0 ; i < n ; i++)
+		ctx->N[i] = N->Num[i];
+
+	// N0 = -N^(-1) mod W, R^2 mod N = W^(2n) mod N, R mod N = W^n mod N (long division 나머지)
+	len = UW_MONT_SETUP_SCRATCH(n * BIT_LEN, n);
+	x = UW_Mem_Alloc(ctx->Alloc, len);
+	if(x == NULL)
+	{
+		BN_Mont_Free(ctx);
+		return FALSE;
+	}
+	ctx->N0 = (UNWORD)UW_Mont_Setup(ctx->RR, ctx->N, n, n * BIT_LEN, x);
+	UW_Pow2_Mod(ctx->R1, n * BIT_LEN, ctx->N, n, x);
+	UW_Mem_Free(ctx->Alloc, x, len);
+
+	return TRUE;
+}
+
+/**
+ * @brief Free Montgomery context
+ * @details
+ * - 모듈러 / R mod N / R^2 mod N / 임시 배열 / table 0 초기화 후 해제 \n
+ * @param[in,out] BN_MONT *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Mont_Free(BN_MONT *ctx)
+{
+	UNWORD i, len = 3 * ctx->n + BN_MONT_SCRATCH(ctx->n) + BN_MONT_TABLE(ctx->n);
+
+	if(ctx->N != NULL)
+	{
+		for(i = 0 ; i < len ; i++)
+			ctx->N[i] = 0;
+		UW_Mem_Free(ctx->Alloc, ctx->N, len);
+	}
+	ctx->N = ctx->R1 = ctx->RR = ctx->T = ctx->Tb = NULL;
+	ctx->n = ctx->N0 = 0;
+}
+
+// n WORD 고정 길이 입력 : 배열이 n WORD 이상이면 그대로 (Num[Length ~ Top - 1] = 0), 작으면 buf 에 0 채워서 복사
+static const UNWORD *BN_Mont_Arg(const BIGNUM *A, UNWORD *buf, const UNWORD n)
+{
+	UNWORD i;
+
+	if(A->Top >= n)
+		return A->Num;
+	for(i = 0 ; i < A->Length ; i++)
+		buf[i] = A->Num[i];
+	for( ; i < n ; i++)
+		buf[i] = 0;
+	return buf;
+}
+
+// Montgomery 결과 출력 (R->Num 에 n WORD 쓴 후)
+static void BN_Mont_Out(BIGNUM *R, const UNWORD n)
+{
+	R->Length = n;
+	R->Sign = PLUS;
+	BN_Optimize(R);
+}
+
+/**
+ * @brief Montgomery Multiplication of BIGNUM (BN_MONT context)
+ * @details
+ * - R = A * B * R^(-1) mod N (0 <= A, B < N) \n
+ * - UW_Mont_Mul (CIOS) : n WORD 고정 길이, 마지막 조건부 뺄셈 한 번 \n
+ * - 임시 값은 ctx->T 사용 (할당 X, R 의 배열이 n WORD 보다 작은 경우만 R 재할당) \n
+ * - R 은 A, B 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @param[in,out] BN_MONT *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Mont_Mul(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, BN_MONT *ctx)
+{
+	UNWORD n = ctx->n;
+	const UNWORD *a, *b;
+
+	BN_Result_Size(R, n);	// R == A or B 인 경우 A, B 도 n WORD 이상
+	a = BN_Mont_Arg(A, ctx->T + (2 * n + 1), n);
+	b = BN_Mont_Arg(B, ctx->T + (3 * n + 1), n);
+	UW_Mont_Mul(R->Num, a, b, ctx->N, n, ctx->N0, ctx->T);
+	BN_Mont_Out(R, n);
+}
+
+/**
+ * @brief Montgomery Squaring of BIGNUM (BN_MONT context)
+ * @details
+ * - R = A^2 * R^(-1) mod N (0 <= A < N) \n
+ * - UW_Mont_Sqr : 제곱 (대칭 곱셈 생략) 후 리덕션 \n
+ * - R 은 A 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] BN_MONT *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Mont_Sqr(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx)
+{
+	UNWORD n = ctx->n;
+	const UNWORD *a;
+
+	BN_Result_Size(R, n);
+	a = BN_Mont_Arg(A, ctx->T + (2 * n + 1), n);
+	UW_Mont_Sqr(R->Num, a, ctx->N, n, ctx->N0, ctx->T);
+	BN_Mont_Out(R, n);
+}
+
+/**
+ * @brief Montgomery Reduction of BIGNUM (BN_MONT context)
+ * @details
+ * - R = A * R^(-1) mod N (0 <= A < N * R, 2n WORD 이하) \n
+ * - Handbook of E&HC p.181 참고, UW_Mont_Redc (WORD 단위 리덕션) \n
+ * - R 은 A 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] BN_MONT *ctx
  * @date 2017. 03. 29. v1.00 \n
- * @todo 아직 미완성
+ * @date 2026. 10. 17. BN_MONT context 사용 (미완성 주석 함수 대체) \n
  */
- /*
-void BN_Mont_Redc(BIGNUM *T, const BIGNUM *N, const BIGNUM *R, const UNWORD Np, const BIGNUM *U)
-{	
-	
+void BN_Mont_Redc(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx)
+{
+	UNWORD i, n = ctx->n;
+	UNWORD len = (A->Length < 2 * n) ? A->Length : 2 * n;
+	UNWORD *t = ctx->T;
+
+	for(i = 0 ; i < len ; i++)
+		t[i] = A->Num[i];
+	for( ; i < 2 * n ; i++)
+		t[i] = 0;
+
+	BN_Result_Size(R, n);
+	UW_Mont_Redc(R->Num, t, ctx->N, n, ctx->N0);
+	BN_Mont_Out(R, n);
+}
+
+/**
+ * @brief Convert to Montgomery form
+ * @details
+ * - R = A * R mod N (0 <= A < N, A * R^2 을 Montgomery 곱셈) \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] BN_MONT *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Mont_To(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx)
+{
+	UNWORD n = ctx->n;
+	const UNWORD *a;
+
+	BN_Result_Size(R, n);
+	a = BN_Mont_Arg(A, ctx->T + (2 * n + 1), n);
+	UW_Mont_Mul(R->Num, a, ctx->RR, ctx->N, n, ctx->N0, ctx->T);
+	BN_Mont_Out(R, n);
+}
+
+/**
+ * @brief Convert from Montgomery form
+ * @details
+ * - R = A * R^(-1) mod N (0 <= A < N) \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] BN_MONT *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_Mont_From(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx)
+{
+	BN_Mont_Redc(R, A, ctx);
+}
+
+/**
+ * @brief Modular Exponentiation of BIGNUM (BN_MONT context)
+ * @details
+ * - R = A^E mod N (0 <= A < N, E >= 0) \n
+ * - 고정 4-bit window (table 16 개, window 마다 UW_Mont_Sqr 4 번 + UW_Mont_Mul 1 번) \n
+ * - Montgomery 형식 변환은 처음과 끝에서 한 번씩, 중간 값은 n WORD 고정 길이 배열 \n
+ * - table 은 BN_Mont_Init 에서 할당한 ctx->Tb 사용 (할당 X) \n
+ * - window 값에 따른 table 접근은 UW_Select_n (16 개 전체를 읽고 mask 선택, cache timing 으로 지수 노출 X) \n
+ * - R 은 A, E 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *E (const)
+ * @param[in,out] BN_MONT *ctx
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. table 을 context 로 이동, table 선택 constant-time \n
+ */
+void BN_Mont_Exp(BIGNUM *R, const BIGNUM *A, const BIGNUM *E, BN_MONT *ctx)
+{
+	UNWORD i, j, w = 0;
+	UNWORD n = ctx->n;
+	UNWORD *tb = ctx->Tb, *x, *y, *t = ctx->T;
+	const UNWORD *a;
+
+	x = tb + 16 * n;
+	y = x + n;
+
+	// tb[0] = 1, tb[1] = A, tb[i] = A^i (Montgomery 형식)
+	for(i = 0 ; i < n ; i++)
+		tb[i] = ctx->R1[i];
+	a = BN_Mont_Arg(A, t + (2 * n + 1), n);
+	UW_Mont_Mul(tb + n, a, ctx->RR, ctx->N, n, ctx->N0, t);
+	for(i = 2 ; i < 16 ; i++)
+		UW_Mont_Mul(tb + i * n, tb + (i - 1) * n, tb + n, ctx->N, n, ctx->N0, t);
+
+	// window 개수
+	if(E->Length != 0)
+		w = ((E->Length - 1) * BIT_LEN + UW_Bit_Len(E->Num[E->Length - 1]) + 3) >> 2;
+
+	for(i = 0 ; i < n ; i++)
+		x[i] = tb[i];
+	for(i = w ; i > 0 ; i--)
+	{
+		if(i != w)
+			for(j = 0 ; j < 4 ; j++)
+				UW_Mont_Sqr(x, x, ctx->N, n, ctx->N0, t);
+		UW_Select_n(y, tb, n, 16, UW_Window(E->Num, i - 1));
+		UW_Mont_Mul(x, x, y, ctx->N, n, ctx->N0, t);
+	}
+
+	// Montgomery 형식 -> 일반 형식
+	for(i = 0 ; i < n ; i++)
+	{
+		t[i] = x[i];
+		t[i + n] = 0;
+	}
+	BN_Result_Size(R, n);
+	UW_Mont_Redc(R->Num, t, ctx->N, n, ctx->N0);
+	BN_Mont_Out(R, n);
+
+	for(i = 0 ; i < BN_MONT_TABLE(n) ; i++)
+		tb[i] = 0;
 }
-*/
\ No newline at end of file
@@ -2,17 +2,116 @@
 #define _BIGNUM_H_
 
 #include "config.h"
+#include "word.h"
+#include "alloc.h"
+#include "ntt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 곱셈 알고리즘 전환 기준 (WORD 개수, 작은 쪽 입력 길이 기준, 측정값)
+// - Karatsuba / 기본 곱셈 cycle (최소값) : row kernel 40 -> 1816 / 1770, 48 -> 2538 / 2532, 56 -> 3296 / 3444, 64 -> 4116 / 4580
+//   Comba 32 -> 1972 / 1782, 40 -> 2578 / 2804, 48 -> 3440 / 4336
+// - Karatsuba 제곱 / 기본 제곱 cycle (최소값) : row kernel 80 -> 4334 / 4090, 96 -> 5790 / 5756, 112 -> 7282 / 7536
+//   Comba 64 -> 4344 / 4026, 72 -> 5108 / 5174, 80 -> 5842 / 6090, 96 -> 8164 / 9378
+#if defined(UW_ASM_MULX_ADX)
+#define KARA_THRESHOLD	48		// row kernel -> Karatsuba
+#define KARA_SQR_THRESHOLD	96	// row kernel 제곱 -> Karatsuba 제곱
+#else
+#define KARA_THRESHOLD	40		// Comba -> Karatsuba
+#define KARA_SQR_THRESHOLD	80	// Comba 제곱 -> Karatsuba 제곱
+#endif
+
+// Toom 임시 배열 크기 (UW_Toom_Scratch_Size) 는 TOOM*_THRESHOLD >= 16 가정
+// - Toom-3 / Karatsuba 시간 비 (곱셈, 제곱) : 256 -> 1.06 ~ 1.09, 384 ~ 896 -> 0.95 ~ 1.04 (측정 잡음 수준)
+// - Toom-4 / Karatsuba : 1024 -> 0.93 ~ 0.99, 2048 -> 0.89, 4096 -> 0.78 ~ 0.83
+#define TOOM3_THRESHOLD		384		// Karatsuba -> Toom-3
+#define TOOM4_THRESHOLD		1024	// Toom-3 -> Toom-4
+#define TOOM3_SQR_THRESHOLD	384		// Karatsuba 제곱 -> Toom-3 제곱
+#define TOOM4_SQR_THRESHOLD	1024	// Toom-3 제곱 -> Toom-4 제곱
+
+// NTT 시간은 변환 길이 (2 의 거듭제곱) 단위로 계단형 -> NTT / Toom-4 시간 비 (곱셈, 제곱)
+// - 4096 -> 1.10 ~ 1.16, 6144 -> 1.16 ~ 1.26, 7168 -> 0.94 ~ 1.00, 7680 -> 0.86 ~ 0.94, 8192 -> 0.78 ~ 0.88
+#if defined(UW_NTT)
+#define NTT_THRESHOLD		7680	// Toom-4 -> NTT
+#define NTT_SQR_THRESHOLD	7680	// Toom-4 제곱 -> NTT 제곱
+#endif
 
 // BIGNUM STRUCT (Modified openssl)
 typedef struct _BIGNUM
 {
     UNWORD	*Num;		// BIGNUM Value
-	UNWORD 	Top;		// Allocated Array Size (1 ~ )
+	UNWORD 	Top;		// Allocated Array Size (1 ~ ), 연산 후에도 유지 (Num[Length ~ Top - 1] = 0)
 	UNWORD	Length;		// Value Size (0 ~ )
 	SNWORD	Sign; 		// Sign (PLUS, ZERO, MINUS)
 	SNWORD	Flag;		// Option (DEFAULT, OPTIMIZE)
+	const UW_ALLOC *Alloc;	// Num 할당자 (생성 시점의 할당자, NULL : calloc / realloc / free)
 } BIGNUM;
 
+// 내부 배열 BIGNUM (small buffer) : BN_SBO_WORDS 이하 값은 struct 안의 배열 사용, 커지면 heap 으로 이동
+// - 기본 576-bit (P-521 스칼라 / 좌표 : 64-bit 9 WORD, 32-bit 17 WORD)
+// - BN_* 함수에 &A->BN 전달 (Alloc == &BN_SBO_Alloc 이면 Num = Buf)
+// - Num 이 Buf 를 가리키므로 struct 값 복사 X (BN_Copy 사용)
+#ifndef BN_SBO_BITS
+#define BN_SBO_BITS		576
+#endif
+#define BN_SBO_WORDS	((BN_SBO_BITS + BIT_LEN - 1) / BIT_LEN)
+
+typedef struct _BN_SBO
+{
+	BIGNUM	BN;					// BIGNUM (BN_* 함수 입출력)
+	UNWORD	Buf[BN_SBO_WORDS];	// 내부 배열
+} BN_SBO;
+
+extern const UW_ALLOC BN_SBO_Alloc;	// 내부 배열 표시 (할당자 함수 호출 X)
+
+// 임시 값 context (ctx.c) : BIGNUM / GF2N 임시 값 재사용, BN_CTX_Start / BN_CTX_End frame 단위 반환
+typedef struct _BN_CTX
+{
+	BIGNUM	**BN;			// BIGNUM 임시 값 (개별 할당, 주소 고정)
+	UNWORD	BN_Size;		// 생성된 BIGNUM 임시 값 개수
+	UNWORD	BN_Used;		// 사용 중인 BIGNUM 임시 값 개수
+	struct _GF2N **GF;		// GF2N 임시 값 (개별 할당, 주소 고정)
+	UNWORD	GF_Size;		// 생성된 GF2N 임시 값 개수
+	UNWORD	GF_Used;		// 사용 중인 GF2N 임시 값 개수
+	UNWORD	*Frame;			// BN_CTX_Start 시점의 (BN_Used, GF_Used) 스택
+	UNWORD	Depth;			// 현재 frame 개수
+	UNWORD	Frame_Size;		// frame 스택 크기
+	const UW_ALLOC *Alloc;	// 임시 값 Num 할당자
+} BN_CTX;
+
+// Barrett reduction context : 모듈러 마다 한 번 생성 (Mu 사전 계산 + 임시 배열), BN_Bar_Reduce 는 할당 X
+// - 임시 배열을 context 에 두므로 스레드 마다 context 하나 사용
+typedef struct _BN_BAR
+{
+	UNWORD	*N;			// 모듈러 (n WORD)
+	UNWORD	*Mu;		// Floor(W^(2n) / N) (Mu_Len WORD, n + 2 WORD 배열)
+	UNWORD	*T;			// 임시 배열 (BN_BAR_SCRATCH(n) WORD)
+	UNWORD	n;			// 모듈러 WORD 개수
+	UNWORD	Mu_Len;		// Mu WORD 개수 (n + 1, N = W^(n-1) 인 경우 n + 2)
+	const UW_ALLOC *Alloc;	// N / Mu / T 할당자 (한 번에 할당)
+} BN_BAR;
+
+#define BN_BAR_SCRATCH(n)	(4 * (n) + 6)	// q * Mu 상위 (2n + 4) + q * N 하위 (n + 1) + A 하위 (n + 1)
+
+// Montgomery context : 홀수 모듈러 마다 한 번 생성 (R = W^n), 연산은 n WORD 고정 길이 (CIOS), 할당 X
+// - 임시 배열을 context 에 두므로 스레드 마다 context 하나 사용
+typedef struct _BN_MONT
+{
+	UNWORD	*N;			// 모듈러 (n WORD)
+	UNWORD	*R1;		// R mod N (Montgomery 형식 1)
+	UNWORD	*RR;		// R^2 mod N (Montgomery 형식 변환)
+	UNWORD	*T;			// 임시 배열 (BN_MONT_SCRATCH(n) WORD)
+	UNWORD	*Tb;		// BN_Mont_Exp window table (BN_MONT_TABLE(n) WORD)
+	UNWORD	n;			// 모듈러 WORD 개수
+	UNWORD	N0;			// -N^(-1) mod W
+	const UW_ALLOC *Alloc;	// N / R1 / RR / T / Tb 할당자 (한 번에 할당)
+} BN_MONT;
+
+#define BN_MONT_SCRATCH(n)	(4 * (n) + 1)	// 곱셈 누산 (2n + 1) + 고정 길이 입력 2 개 (n, n)
+#define BN_MONT_TABLE(n)	(18 * (n))		// 4-bit window table 16 개 + 중간 값 + 선택된 table 값
+
 // Define Function 
 void BN_Init(BIGNUM *A, const UNWORD len, const SNWORD sign, const SNWORD flag);	// done
 void BN_Init_Zero(BIGNUM *A);														// done	
@@ -30,12 +129,27 @@ void BN_Zero_Realloc_Mem(BIGNUM *A, const UNWORD size);								// done
 void BN_Top_Check(BIGNUM *A);														// 
 void BN_Result_Size(BIGNUM *A, const UNWORD size);									//
 void BN_Optimize(BIGNUM *A);														// done
+void BN_Shrink(BIGNUM *A);
 
 void BN_Free(BIGNUM *A);															// done
 void BN_Zero_Free(BIGNUM *A);														// done
 
+void BN_SBO_Init(BN_SBO *A);
+void BN_SBO_Init_Copy(BN_SBO *R, const BIGNUM *A);
+
+void BN_CTX_Init(BN_CTX *ctx);
+void BN_CTX_Free(BN_CTX *ctx);
+void BN_CTX_Set_Alloc(BN_CTX *ctx, const UW_ALLOC *alloc);
+void BN_CTX_Start(BN_CTX *ctx);
+void BN_CTX_End(BN_CTX *ctx);
+BIGNUM *BN_CTX_Get(BN_CTX *ctx, const UNWORD len);
+
 void BN_RShift_Bit(BIGNUM *R, BIGNUM *A, const UNWORD s_bit);
 void BN_LShift_Bit(BIGNUM *R, BIGNUM *A, const UNWORD s_bit);
+UNWORD BN_RShift_Bit_Inplace(BIGNUM *A, const UNWORD s_bit);
+UNWORD BN_LShift_Bit_Inplace(BIGNUM *A, const UNWORD s_bit);
+UNWORD BN_Trailing_Zeros(const BIGNUM *A);
+UNWORD BN_RShift_Zeros(BIGNUM *A);
 
 SNWORD BN_IsZero(const BIGNUM *A);
 SNWORD BN_Abs_Cmp(const BIGNUM *A, const BIGNUM *B);
@@ -46,22 +160,67 @@ SNWORD BN_Cmp(const BIGNUM *A, const BIGNUM *B);
 void BN_Print_hex(const BIGNUM *A);									
 void BN_FPrint_hex(FILE *fp, const BIGNUM *A);									
 
+// Byte Conversion (big / little endian, 고정 길이 출력)
+UNWORD BN_Num_Bytes(const BIGNUM *A);
+void BN_From_Bytes(BIGNUM *R, const UCHAR *buf, const UNWORD len);
+void BN_From_Bytes_LE(BIGNUM *R, const UCHAR *buf, const UNWORD len);
+SNWORD BN_To_Bytes(UCHAR *buf, const UNWORD len, const BIGNUM *A);
+SNWORD BN_To_Bytes_LE(UCHAR *buf, const UNWORD len, const BIGNUM *A);
+
+SNWORD BN_Div(BIGNUM *Q, BIGNUM *R, const BIGNUM *A, const BIGNUM *B);
+SNWORD BN_Mod(BIGNUM *R, const BIGNUM *A, const BIGNUM *N);
+
 void BN_Euclidean_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Ext_Euclidean_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B);
 
 void BN_Binary_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Ext_Binary_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B);
+void BN_Ext_Binary_Inv(BIGNUM *R, BIGNUM *A, BIGNUM *P);
+void BN_Binary_GCD_Ctx(BIGNUM *R, BIGNUM *A, BIGNUM *B, BN_CTX *ctx);
+void BN_Ext_Binary_GCD_Ctx(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B, BN_CTX *ctx);
+void BN_Ext_Binary_Inv_Ctx(BIGNUM *R, BIGNUM *A, BIGNUM *P, BN_CTX *ctx);
 
+// 출력 R 과 입력 A, B 는 같은 BIGNUM 가능 (Shift, Copy, Add / Sub, Mul / Sqr, Mul_Word, MulAdd / MulSub, GCD, Bar_Redc)
 void BN_Abs_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Abs_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Add(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Sub(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 
 void BN_Basic_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+void BN_Comba_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Kara_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 void BN_Sqr(BIGNUM *R, BIGNUM *A);
+void BN_Comba_Sqr(BIGNUM *R, BIGNUM *A);
+void BN_Kara_Sqr(BIGNUM *R, BIGNUM *A);
+void BN_Toom_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+void BN_Toom_Sqr(BIGNUM *R, BIGNUM *A);
+#if defined(UW_NTT)
+void BN_NTT_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+void BN_NTT_Sqr(BIGNUM *R, BIGNUM *A);
+#endif
+void BN_Mul_Word(BIGNUM *R, BIGNUM *A, const UNWORD w);
+void BN_AddMul_Word(BIGNUM *R, BIGNUM *A, const UNWORD w);
+void BN_MulAdd(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+void BN_MulSub(BIGNUM *R, BIGNUM *A, BIGNUM *B);
 
 void BN_Bar_Redc(BIGNUM *R, BIGNUM *A, BIGNUM *N, BIGNUM *T);
+void BN_Bar_Redc_Ctx(BIGNUM *R, BIGNUM *A, BIGNUM *N, BIGNUM *T, BN_CTX *ctx);
+SNWORD BN_Bar_Init(BN_BAR *ctx, const BIGNUM *N);
+void BN_Bar_Free(BN_BAR *ctx);
+SNWORD BN_Bar_Reduce(BIGNUM *R, const BIGNUM *A, BN_BAR *ctx);
+
+SNWORD BN_Mont_Init(BN_MONT *ctx, const BIGNUM *N);
+void BN_Mont_Free(BN_MONT *ctx);
+void BN_Mont_Mul(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, BN_MONT *ctx);
+void BN_Mont_Sqr(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx);
+void BN_Mont_Redc(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx);
+void BN_Mont_To(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx);
+void BN_Mont_From(BIGNUM *R, const BIGNUM *A, BN_MONT *ctx);
+void BN_Mont_Exp(BIGNUM *R, const BIGNUM *A, const BIGNUM *E, BN_MONT *ctx);
+
+#ifdef __cplusplus
+}
+#endif
 #else
 #endif
@@ -0,0 +1,348 @@
+#ifndef _BIGNUM_HPP_
+#define _BIGNUM_HPP_
+
+/**
+ * @file bignum.hpp
+ * @brief C++ RAII wrapper of BIGNUM / GF2N (header-only)
+ * @details
+ * - uw::Bn, uw::Gf2n : BIGNUM / GF2N 값 class (생성자 BN_Init_*, 소멸자 BN_Zero_Free) \n
+ * - move 생성 / 대입은 Num 배열 이동 (복사 X), 이동된 값은 BN_Free 상태 (Num = NULL, Top = 0, 값 0) \n
+ * - 곱셈 a * b 는 바로 계산하지 않고 expression 으로 남김 \n
+ *   (a * b + c) % n -> r = c, BN_MulAdd(r, a, b), r mod n (곱셈 결과 임시 값 X) \n
+ * - expression 은 피연산자 참조 저장 -> auto 로 저장 X (같은 문장 안에서 Bn 에 대입) \n
+ * - 결과 Bn 이 피연산자와 같은 경우 (a = (a * b + c) % n) 도 가능 \n
+ * - % 결과는 항상 0 <= r < |n| (n != 0) \n
+ * - 이동된 값은 대입 or 소멸만 가능 \n
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include <utility>
+#include "bignum.h"
+#include "gf2n.h"
+
+namespace uw
+{
+
+class Bn;
+struct BnMul;
+
+namespace detail
+{
+	/**
+	 * @brief Bit length of BIGNUM *A
+	 * @details
+	 * - |A| 의 bit 길이 (A = 0 이면 0) \n
+	 * @param[in] BIGNUM *A (const)
+	 * @return UNWORD bit 길이
+	 * @date 2026. 10. 17. \n
+	 */
+	inline UNWORD bn_bits(const BIGNUM *A)
+	{
+		if(A->Length == 0)
+			return 0;
+		return (A->Length - 1) * BIT_LEN + UW_Bit_Len(A->Num[A->Length - 1]);
+	}
+
+	/**
+	 * @brief Modulus BIGNUM *R by BIGNUM *N (in-place)
+	 * @details
+	 * - R = R mod |N|, 결과 0 <= R < |N| (음수 R 은 |N| 더해서 양수) \n
+	 * - BN_Mod (WORD 단위 long division) \n
+	 * - R 과 N 은 다른 BIGNUM, N != 0 \n
+	 * @param[in,out] BIGNUM *R
+	 * @param[in] BIGNUM *N
+	 * @date 2026. 10. 17. \n
+	 */
+	inline void bn_mod(BIGNUM *R, BIGNUM *N)
+	{
+		BN_Mod(R, R, N);
+	}
+}
+
+/**
+ * @brief Expression base of Bn
+ * @details
+ * - D::eval(Bn &r) : expression 값을 r 에 저장 (r 이 피연산자와 같아도 가능) \n
+ */
+template<class D>
+struct BnExpr
+{
+	const D &self() const { return static_cast<const D &>(*this); }
+};
+
+/**
+ * @brief BIGNUM value class
+ * @details
+ * - 생성 시 BN_Init_*, 소멸 시 BN_Zero_Free \n
+ * - 대입은 배열 크기 유지 (BN_Copy), move 는 배열 이동 \n
+ * - get() 으로 BN_* 함수에 직접 전달 가능 \n
+ */
+class Bn
+{
+public:
+	Bn() { BN_Init_Zero(&bn); }
+	explicit Bn(const UNWORD w)
+	{
+		BN_Init_Zero(&bn);
+		if(w != 0)
+		{
+			bn.Num[0] = w;
+			bn.Length = 1;
+			bn.Sign = PLUS;
+		}
+	}
+	explicit Bn(const BIGNUM *A) { BN_Init_Copy(&bn, A); }
+	Bn(const Bn &A) { BN_Init_Copy(&bn, &A.bn); }
+	Bn(Bn &&A) noexcept : bn(A.bn) { A.release(); }
+	template<class D>
+	Bn(const BnExpr<D> &e) { BN_Init_Zero(&bn); e.self().eval(*this); }
+	~Bn() { if(bn.Top != 0) BN_Zero_Free(&bn); }
+
+	Bn &operator=(const Bn &A) { if(this != &A) BN_Copy(&bn, &A.bn); return *this; }
+	Bn &operator=(Bn &&A) noexcept { std::swap(bn, A.bn); return *this; }
+	template<class D>
+	Bn &operator=(const BnExpr<D> &e) { e.self().eval(*this); return *this; }
+
+	BIGNUM *get() const { return const_cast<BIGNUM *>(&bn); }
+	UNWORD length() const { return bn.Length; }
+	SNWORD sign() const { return bn.Sign; }
+	bool is_zero() const { return bn.Length == 0; }
+	UNWORD bits() const { return detail::bn_bits(&bn); }
+	void shrink() { BN_Shrink(&bn); }
+	void swap(Bn &A) noexcept { std::swap(bn, A.bn); }
+	void print() const { BN_Print_hex(&bn); }
+
+	Bn &operator+=(const Bn &A) { BN_Add(&bn, &bn, A.get()); return *this; }
+	Bn &operator-=(const Bn &A) { BN_Sub(&bn, &bn, A.get()); return *this; }
+	Bn &operator*=(const Bn &A) { BN_Mul(&bn, &bn, A.get()); return *this; }
+	Bn &operator*=(const UNWORD w) { BN_Mul_Word(&bn, &bn, w); return *this; }
+	Bn &operator%=(const Bn &N) { Bn t; if(this == &N) swap(t); else detail::bn_mod(&bn, N.get()); return *this; }
+	Bn &operator<<=(const UNWORD s) { BN_LShift_Bit(&bn, &bn, s); return *this; }
+	Bn &operator>>=(const UNWORD s) { BN_RShift_Bit_Inplace(&bn, s); return *this; }
+
+	// r += a * b, r -= a * b (BN_MulAdd / BN_MulSub, 곱셈 결과 임시 값 X)
+	Bn &operator+=(const BnMul &e);
+	Bn &operator-=(const BnMul &e);
+
+	Bn operator-() const & { Bn r(*this); r.bn.Sign = -r.bn.Sign; return r; }
+	Bn operator-() && { bn.Sign = -bn.Sign; return std::move(*this); }
+
+private:
+	// 이동된 값 : BN_Free 상태 (다음 BN_* 출력에서 다시 할당)
+	void release()
+	{
+		bn.Num = NULL;
+		bn.Top = bn.Length = 0;
+		bn.Sign = ZERO;
+	}
+
+	BIGNUM bn;
+};
+
+/**
+ * @brief Expression a * b
+ */
+struct BnMul : BnExpr<BnMul>
+{
+	const Bn &a, &b;
+
+	BnMul(const Bn &a_, const Bn &b_) : a(a_), b(b_) {}
+	void eval(Bn &r) const { BN_Mul(r.get(), a.get(), b.get()); }
+};
+
+/**
+ * @brief Expression c + s * a * b (neg : 결과 부호 반전)
+ * @details
+ * - a * b + c, c + a * b -> s = PLUS \n
+ * - c - a * b -> s = MINUS, a * b - c -> s = MINUS, neg \n
+ */
+struct BnMulAdd : BnExpr<BnMulAdd>
+{
+	const Bn &a, &b, &c;
+	SNWORD s;
+	bool neg;
+
+	BnMulAdd(const BnMul &m, const Bn &c_, const SNWORD s_, const bool neg_) : a(m.a), b(m.b), c(c_), s(s_), neg(neg_) {}
+	void eval(Bn &r) const
+	{
+		// r = a or r = b (r != c) -> r = c 복사 시 a, b 값 변경 -> 임시 값에 계산
+		if((&r != &c) && ((&r == &a) || (&r == &b)))
+		{
+			Bn t(c);
+			acc(t);
+			r.swap(t);
+			return;
+		}
+		if(&r != &c)
+			r = c;
+		acc(r);
+	}
+
+private:
+	void acc(Bn &r) const
+	{
+		if(s == PLUS)
+			BN_MulAdd(r.get(), a.get(), b.get());
+		else
+			BN_MulSub(r.get(), a.get(), b.get());
+		if(neg)
+			r.get()->Sign = -r.get()->Sign;
+	}
+};
+
+/**
+ * @brief Expression e % n (0 <= 결과 < |n|)
+ */
+template<class E>
+struct BnMod : BnExpr<BnMod<E> >
+{
+	E e;
+	const Bn &n;
+
+	BnMod(const E &e_, const Bn &n_) : e(e_), n(n_) {}
+	void eval(Bn &r) const
+	{
+		// r = n -> n 값 변경 전 임시 값에 계산
+		if(&r == &n)
+		{
+			Bn t(*this);
+			r.swap(t);
+			return;
+		}
+		e.eval(r);
+		detail::bn_mod(r.get(), n.get());
+	}
+};
+
+inline Bn &Bn::operator+=(const BnMul &e) { BN_MulAdd(&bn, e.a.get(), e.b.get()); return *this; }
+inline Bn &Bn::operator-=(const BnMul &e) { BN_MulSub(&bn, e.a.get(), e.b.get()); return *this; }
+
+// 덧셈 / 뺄셈 : 왼쪽 피연산자가 임시 값이면 그 배열에 바로 계산
+inline Bn operator+(const Bn &a, const Bn &b) { Bn r; BN_Add(r.get(), a.get(), b.get()); return r; }
+inline Bn operator+(Bn &&a, const Bn &b) { a += b; return std::move(a); }
+inline Bn operator-(const Bn &a, const Bn &b) { Bn r; BN_Sub(r.get(), a.get(), b.get()); return r; }
+inline Bn operator-(Bn &&a, const Bn &b) { a -= b; return std::move(a); }
+
+inline BnMul operator*(const Bn &a, const Bn &b) { return BnMul(a, b); }
+inline BnMulAdd operator+(const BnMul &m, const Bn &c) { return BnMulAdd(m, c, PLUS, false); }
+inline BnMulAdd operator+(const Bn &c, const BnMul &m) { return BnMulAdd(m, c, PLUS, false); }
+inline BnMulAdd operator-(const Bn &c, const BnMul &m) { return BnMulAdd(m, c, MINUS, false); }
+inline BnMulAdd operator-(const BnMul &m, const Bn &c) { return BnMulAdd(m, c, MINUS, true); }
+inline Bn operator+(const BnMul &m1, const BnMul &m2) { Bn r(m1); r += m2; return r; }
+inline Bn operator-(const BnMul &m1, const BnMul &m2) { Bn r(m1); r -= m2; return r; }
+
+template<class D>
+inline BnMod<D> operator%(const BnExpr<D> &e, const Bn &n) { return BnMod<D>(e.self(), n); }
+inline Bn operator%(const Bn &a, const Bn &n) { Bn r(a); r %= n; return r; }
+inline Bn operator%(Bn &&a, const Bn &n) { a %= n; return std::move(a); }
+
+inline Bn operator<<(Bn a, const UNWORD s) { a <<= s; return a; }
+inline Bn operator>>(Bn a, const UNWORD s) { a >>= s; return a; }
+
+inline bool operator==(const Bn &a, const Bn &b) { return BN_Cmp(a.get(), b.get()) == EQUAL; }
+inline bool operator!=(const Bn &a, const Bn &b) { return BN_Cmp(a.get(), b.get()) != EQUAL; }
+inline bool operator<(const Bn &a, const Bn &b) { return BN_Cmp(a.get(), b.get()) == SMALL; }
+inline bool operator>(const Bn &a, const Bn &b) { return BN_Cmp(a.get(), b.get()) == LARGE; }
+inline bool operator<=(const Bn &a, const Bn &b) { return BN_Cmp(a.get(), b.get()) != LARGE; }
+inline bool operator>=(const Bn &a, const Bn &b) { return BN_Cmp(a.get(), b.get()) != SMALL; }
+
+inline void swap(Bn &a, Bn &b) noexcept { a.swap(b); }
+
+template<class D>
+struct Gf2nExpr
+{
+	const D &self() const { return static_cast<const D &>(*this); }
+};
+
+/**
+ * @brief GF2N value class
+ * @details
+ * - 생성 시 GF2N_Init_*, 소멸 시 GF2N_Zero_Free \n
+ * - + : GF2N_Add (XOR), % irr : GF2N_Redc, (a * b) % irr : GF2N_Mul (reduction 포함 곱셈 한 번) \n
+ */
+class Gf2n
+{
+public:
+	Gf2n() { GF2N_Init_Zero(&gf); }
+	explicit Gf2n(const GF2N *A) { GF2N_Init_Copy(&gf, A); }
+	Gf2n(const Gf2n &A) { GF2N_Init_Copy(&gf, &A.gf); }
+	Gf2n(Gf2n &&A) noexcept : gf(A.gf) { A.release(); }
+	template<class D>
+	Gf2n(const Gf2nExpr<D> &e) { GF2N_Init_Zero(&gf); e.self().eval(*this); }
+	~Gf2n() { if(gf.Top != 0) GF2N_Zero_Free(&gf); }
+
+	Gf2n &operator=(const Gf2n &A) { if(this != &A) GF2N_Copy(&gf, &A.gf); return *this; }
+	Gf2n &operator=(Gf2n &&A) noexcept { std::swap(gf, A.gf); return *this; }
+	template<class D>
+	Gf2n &operator=(const Gf2nExpr<D> &e) { e.self().eval(*this); return *this; }
+
+	GF2N *get() const { return const_cast<GF2N *>(&gf); }
+	UNWORD length() const { return gf.Length; }
+	UNWORD deg() const { return GF2N_Deg(&gf); }
+	bool is_zero() const { return gf.Length == 0; }
+	void shrink() { GF2N_Shrink(&gf); }
+	void swap(Gf2n &A) noexcept { std::swap(gf, A.gf); }
+	void print() const { GF2N_Print_poly(&gf); }
+
+	Gf2n &operator+=(const Gf2n &A) { GF2N_Add(&gf, &gf, A.get()); return *this; }
+	Gf2n &operator%=(const Gf2n &Irr) { if(gf.Length != 0) GF2N_Redc(&gf, &gf, Irr.get()); return *this; }
+
+private:
+	void release()
+	{
+		gf.Num = NULL;
+		gf.Top = gf.Length = 0;
+		gf.Sign = ZERO;
+	}
+
+	GF2N gf;
+};
+
+/**
+ * @brief Expression a * b (Gf2n, % irr 와 함께 사용)
+ */
+struct Gf2nMul
+{
+	const Gf2n &a, &b;
+
+	Gf2nMul(const Gf2n &a_, const Gf2n &b_) : a(a_), b(b_) {}
+};
+
+/**
+ * @brief Expression (a * b) % irr
+ */
+struct Gf2nMulMod : Gf2nExpr<Gf2nMulMod>
+{
+	const Gf2n &a, &b, &irr;
+
+	Gf2nMulMod(const Gf2nMul &m, const Gf2n &irr_) : a(m.a), b(m.b), irr(irr_) {}
+	void eval(Gf2n &r) const
+	{
+		// r = irr -> 임시 값에 계산 (GF2N_Mul 은 Out = In1 or In2 가능)
+		if(&r == &irr)
+		{
+			Gf2n t(*this);
+			r.swap(t);
+			return;
+		}
+		GF2N_Mul(r.get(), a.get(), b.get(), irr.get());
+	}
+};
+
+inline Gf2n operator+(const Gf2n &a, const Gf2n &b) { Gf2n r; GF2N_Add(r.get(), a.get(), b.get()); return r; }
+inline Gf2n operator+(Gf2n &&a, const Gf2n &b) { a += b; return std::move(a); }
+inline Gf2nMul operator*(const Gf2n &a, const Gf2n &b) { return Gf2nMul(a, b); }
+inline Gf2nMulMod operator%(const Gf2nMul &m, const Gf2n &irr) { return Gf2nMulMod(m, irr); }
+inline Gf2n operator%(const Gf2n &a, const Gf2n &irr) { Gf2n r(a); r %= irr; return r; }
+
+inline bool operator==(const Gf2n &a, const Gf2n &b) { return GF2N_Cmp(a.get(), b.get()) == EQUAL; }
+inline bool operator!=(const Gf2n &a, const Gf2n &b) { return GF2N_Cmp(a.get(), b.get()) != EQUAL; }
+
+inline void swap(Gf2n &a, Gf2n &b) noexcept { a.swap(b); }
+
+}
+
+#else
+#endif
@@ -12,6 +12,8 @@ typedef	unsigned	char	UCHAR;
 typedef				char	SCHAR;
 typedef	unsigned	int		UNINT;
 typedef				int		SNINT;
+typedef	unsigned	long long	UNLONG;
+typedef				long long	SNLONG;
 
 /*
 typedef				__int64 INT64;
@@ -22,12 +24,22 @@ typedef				float	FLOAT;
 */
 
 // CONFIG
+// BIT_LEN 미지정 시 128-bit 곱셈 지원 (x86-64 등) 하면 64-bit WORD 사용
+#ifndef BIT_LEN
+#if defined(__SIZEOF_INT128__)
+#define BIT_LEN 64
+#else
 #define BIT_LEN 32
+#endif
+#endif
 #define NAME_SIZE 1000
 
 #if (BIT_LEN == 8)
 #define UNWORD		    UCHAR
 #define SNWORD		    SCHAR
+#define UDWORD			unsigned short	// 2 WORD (곱셈 결과)
+#define WORD_SHIFT		3				// log2(BIT_LEN)
+#define WORD_HEX_FMT	"%02X"
 #define WORD_MASK		0xFF
 #define WORD_MASK_H		0xF0
 #define WORD_MASK_L		0x0F
@@ -37,6 +49,9 @@ typedef				float	FLOAT;
 #elif (BIT_LEN == 32)
 #define UNWORD		    UNINT
 #define SNWORD		    SNINT
+#define UDWORD			UNLONG			// 2 WORD (곱셈 결과)
+#define WORD_SHIFT		5				// log2(BIT_LEN)
+#define WORD_HEX_FMT	"%08X"
 #define WORD_MASK		0xFFFFFFFF
 #define WORD_MASK_H		0xFFFF0000
 #define WORD_MASK_L		0x0000FFFF
@@ -46,6 +61,21 @@ typedef				float	FLOAT;
 #define WORD_MASK_L_L	0x000000FF
 #define WORD_MASK_MSB	0x80000000
 #define WORD_MASK_LSB	0x00000001
+
+#elif (BIT_LEN == 64)
+#if !defined(__SIZEOF_INT128__)
+#error "BIT_LEN 64 requires unsigned __int128 support"
+#endif
+#define UNWORD		    UNLONG
+#define SNWORD		    SNLONG
+#define UDWORD			unsigned __int128	// 2 WORD (곱셈 결과)
+#define WORD_SHIFT		6					// log2(BIT_LEN)
+#define WORD_HEX_FMT	"%016llX"
+#define WORD_MASK		0xFFFFFFFFFFFFFFFFULL
+#define WORD_MASK_H		0xFFFFFFFF00000000ULL
+#define WORD_MASK_L		0x00000000FFFFFFFFULL
+#define WORD_MASK_MSB	0x8000000000000000ULL
+#define WORD_MASK_LSB	0x0000000000000001ULL
 #endif
 
 #define SUCCESS		1
@@ -0,0 +1,243 @@
+/**
+ * @file ctx.c
+ * @brief BIGNUM / GF2N 임시 값 context (BN_CTX)
+ * @details
+ * - 함수 내부 임시 BIGNUM / GF2N 를 매번 calloc / free 하지 않고 재사용
+ * - BN_CTX_Start / BN_CTX_End 로 frame 구분 (스택 구조), End 시 frame 안에서 받은 임시 값 모두 반환
+ * - 반환된 임시 값의 배열은 해제하지 않고 다음 BN_CTX_Get 에서 재사용 (BN_CTX_Free 에서 해제)
+ * - 임시 값 struct 는 개별 할당 (context 가 커져도 받은 포인터 유지)
+ * - 임시 값 배열은 BN_CTX 의 할당자 사용 (BN_CTX_Set_Alloc, 기본값은 BN_CTX_Init 시점의 할당자)
+ * - 스레드 간 공유 X (스레드마다 BN_CTX 생성)
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include "bignum.h"
+#include "gf2n.h"
+
+// 임시 값 포인터 배열 / frame 스택 최소 크기
+#define CTX_MIN_SIZE		16
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Initialize BN_CTX
+ * @details
+ * - 빈 context 생성 (임시 값은 BN_CTX_Get 호출 시 할당) \n
+ * @param[out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_CTX_Init(BN_CTX *ctx)
+{
+	ctx->BN = NULL;
+	ctx->BN_Size = ctx->BN_Used = 0;
+	ctx->GF = NULL;
+	ctx->GF_Size = ctx->GF_Used = 0;
+	ctx->Frame = NULL;
+	ctx->Depth = ctx->Frame_Size = 0;
+	ctx->Alloc = UW_Alloc_Get();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Free BN_CTX
+ * @details
+ * - 모든 임시 값 0 초기화 후 메모리 해제 (BN_Zero_Free / GF2N_Zero_Free) \n
+ * - 해제 후 BN_CTX_Init 상태 (재사용 가능, 할당자 유지) \n
+ * - arena 할당자 사용 시 UW_Arena_Reset 보다 먼저 호출 \n
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_CTX_Free(BN_CTX *ctx)
+{
+	UNWORD i;
+	const UW_ALLOC *alloc = ctx->Alloc;
+
+	for(i = 0 ; i < ctx->BN_Size ; i++)
+	{
+		BN_Zero_Free(ctx->BN[i]);
+		free(ctx->BN[i]);
+	}
+	for(i = 0 ; i < ctx->GF_Size ; i++)
+	{
+		GF2N_Zero_Free(ctx->GF[i]);
+		free(ctx->GF[i]);
+	}
+	free(ctx->BN);
+	free(ctx->GF);
+	free(ctx->Frame);
+
+	BN_CTX_Init(ctx);
+	ctx->Alloc = alloc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Set allocator of BN_CTX
+ * @details
+ * - 이후 BN_CTX_Get / GF2N_CTX_Get 으로 받는 임시 값의 배열 할당자 (NULL : calloc / realloc / free) \n
+ * - 다른 할당자로 만들어진 임시 값은 다음 Get 에서 해제 후 다시 할당 \n
+ * @param[in,out] BN_CTX *ctx
+ * @param[in] UW_ALLOC *alloc (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_CTX_Set_Alloc(BN_CTX *ctx, const UW_ALLOC *alloc)
+{
+	ctx->Alloc = alloc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Start frame of BN_CTX
+ * @details
+ * - 이후 BN_CTX_Get 으로 받은 임시 값은 짝이 되는 BN_CTX_End 에서 반환 \n
+ * - 중첩 가능 (Start / End 짝 맞춰서 호출) \n
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_CTX_Start(BN_CTX *ctx)
+{
+	// frame 하나 = (BN_Used, GF_Used)
+	if(ctx->Depth == ctx->Frame_Size)
+	{
+		ctx->Frame_Size = (ctx->Frame_Size == 0) ? CTX_MIN_SIZE : (ctx->Frame_Size << 1);
+		ctx->Frame = (UNWORD *)realloc(ctx->Frame, (ctx->Frame_Size << 1) * sizeof(UNWORD));
+	}
+	ctx->Frame[(ctx->Depth << 1)] = ctx->BN_Used;
+	ctx->Frame[(ctx->Depth << 1) + 1] = ctx->GF_Used;
+	ctx->Depth++;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief End frame of BN_CTX
+ * @details
+ * - 짝이 되는 BN_CTX_Start 이후 받은 임시 값 모두 반환 (메모리 유지, 재사용) \n
+ * - 반환된 임시 값 사용 X \n
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void BN_CTX_End(BN_CTX *ctx)
+{
+	// Start 없이 호출된 경우 무시
+	if(ctx->Depth == 0)
+		return;
+
+	ctx->Depth--;
+	ctx->BN_Used = ctx->Frame[(ctx->Depth << 1)];
+	ctx->GF_Used = ctx->Frame[(ctx->Depth << 1) + 1];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Get temporary BIGNUM from BN_CTX
+ * @details
+ * - 값이 0 인 BIGNUM 리턴 (Length = 0, Sign = ZERO, Flag = DEFAULT) \n
+ * - 배열 크기 Top >= len (최소 1), 배열 전체 0 초기화 \n
+ * - 이전에 사용된 배열이 충분히 크면 재할당 X \n
+ * - BN_Free 호출 X (BN_CTX_End 에서 반환) \n
+ * @param[in,out] BN_CTX *ctx
+ * @param[in] UNWORD len (const) 필요한 배열 크기
+ * @return BIGNUM * 임시 값
+ * @date 2026. 10. 17. \n
+ */
+BIGNUM *BN_CTX_Get(BN_CTX *ctx, const UNWORD len)
+{
+	UNWORD i;
+	UNWORD size = (len == 0) ? 1 : len;
+	BIGNUM *A;
+
+	if(ctx->BN_Used == ctx->BN_Size)
+	{
+		ctx->BN_Size = (ctx->BN_Size == 0) ? CTX_MIN_SIZE : (ctx->BN_Size << 1);
+		ctx->BN = (BIGNUM **)realloc(ctx->BN, ctx->BN_Size * sizeof(BIGNUM *));
+		for(i = ctx->BN_Used ; i < ctx->BN_Size ; i++)
+		{
+			ctx->BN[i] = (BIGNUM *)malloc(sizeof(BIGNUM));
+			ctx->BN[i]->Num = NULL;
+			ctx->BN[i]->Top = 0;
+			ctx->BN[i]->Alloc = ctx->Alloc;
+		}
+	}
+	A = ctx->BN[ctx->BN_Used++];
+
+	// 할당자 변경된 경우 기존 배열 해제
+	if(A->Alloc != ctx->Alloc)
+	{
+		UW_Mem_Free(A->Alloc, A->Num, A->Top);
+		A->Num = NULL;
+		A->Top = 0;
+		A->Alloc = ctx->Alloc;
+	}
+
+	// BIGNUM 의 Top 은 배열 크기 -> 큰 배열 유지
+	if(A->Top < size)
+	{
+		A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, size);
+		A->Top = size;
+	}
+	for(i = 0 ; i < A->Top ; i++)
+		A->Num[i] = 0;
+	A->Length = 0;
+	A->Sign = ZERO;
+	A->Flag = DEFAULT;
+
+	return A;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Get temporary GF2N from BN_CTX
+ * @details
+ * - GF2N_Init(A, len, DEFAULT) 와 같은 값의 GF2N 리턴 (Length = len, 값 0, Sign = PLUS) \n
+ * - 배열 크기 Top >= len (최소 1), 배열 전체 0 초기화 \n
+ * - 이전에 사용된 배열이 충분히 크면 재할당 X \n
+ * - GF2N_Free 호출 X (BN_CTX_End 에서 반환) \n
+ * @param[in,out] BN_CTX *ctx
+ * @param[in] UNWORD len (const) 필요한 배열 크기
+ * @return GF2N * 임시 값
+ * @date 2026. 10. 17. \n
+ */
+GF2N *GF2N_CTX_Get(BN_CTX *ctx, const UNWORD len)
+{
+	UNWORD i;
+	UNWORD size = (len == 0) ? 1 : len;
+	GF2N *A;
+
+	if(ctx->GF_Used == ctx->GF_Size)
+	{
+		ctx->GF_Size = (ctx->GF_Size == 0) ? CTX_MIN_SIZE : (ctx->GF_Size << 1);
+		ctx->GF = (GF2N **)realloc(ctx->GF, ctx->GF_Size * sizeof(GF2N *));
+		for(i = ctx->GF_Used ; i < ctx->GF_Size ; i++)
+		{
+			ctx->GF[i] = (GF2N *)malloc(sizeof(GF2N));
+			ctx->GF[i]->Num = NULL;
+			ctx->GF[i]->Top = 0;
+			ctx->GF[i]->Alloc = ctx->Alloc;
+		}
+	}
+	A = ctx->GF[ctx->GF_Used++];
+
+	// 할당자 변경된 경우 기존 배열 해제
+	if(A->Alloc != ctx->Alloc)
+	{
+		UW_Mem_Free(A->Alloc, A->Num, A->Top);
+		A->Num = NULL;
+		A->Top = 0;
+		A->Alloc = ctx->Alloc;
+	}
+
+	// GF2N 의 Top 은 배열 크기 -> 큰 배열 유지
+	if(A->Top < size)
+	{
+		A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, size);
+		A->Top = size;
+	}
+	for(i = 0 ; i < A->Top ; i++)
+		A->Num[i] = 0;
+	A->Length = len;
+	A->Sign = PLUS;
+	A->Flag = DEFAULT;
+
+	return A;
+}
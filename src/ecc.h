@@ -2,13 +2,16 @@
 #define _ECC_H_
 
 #include "config.h"
+#include "bignum.h"
+#include "gf2n.h"
 
 // Prime Field (BIGNUM) ECC Points Structure
+// - 좌표는 내부 배열 BIGNUM (BN_SBO) : 점 하나가 연속 메모리 (BN_* 함수에 &P->X.BN 전달)
 typedef struct ec_bn_point 
 {
-	BIGNUM X;
-	BIGNUM Y;
-	BIGNUM Z; 
+	BN_SBO X;
+	BN_SBO Y;
+	BN_SBO Z; 
    
 } EC_BN_PNT;
 
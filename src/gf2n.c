@@ -34,7 +34,8 @@
  */
 void GF2N_Init(GF2N *A, const UNWORD len, const SNWORD flag)
 {
-	A->Num = (UNWORD *)calloc(len, sizeof(UNWORD)); 
+	A->Alloc = UW_Alloc_Get();
+	A->Num = UW_Mem_Alloc(A->Alloc, len); 
 	A->Top = A->Length = len; 
 	A->Sign = PLUS;	// Default (PLUS)
 	A->Flag = flag;
@@ -52,7 +53,8 @@ void GF2N_Init(GF2N *A, const UNWORD len, const SNWORD flag)
  */
 void GF2N_Init_Zero(GF2N *A)
 {	
-    A->Num = (UNWORD *)calloc(1, sizeof(UNWORD));
+	A->Alloc = UW_Alloc_Get();
+	A->Num = UW_Mem_Alloc(A->Alloc, 1);
 	A->Top = 1;			// 실제 할당된 배열 크기
 	A->Length = 0; 		// 값이 들어있는 배열 크기
 	A->Sign = ZERO;
@@ -71,7 +73,8 @@ void GF2N_Init_Zero(GF2N *A)
  */
 void GF2N_Init_One(GF2N *A)
 {	
-	A->Num = (UNWORD *)calloc(1, sizeof(UNWORD));
+	A->Alloc = UW_Alloc_Get();
+	A->Num = UW_Mem_Alloc(A->Alloc, 1);
 	A->Num[0] = 1;
 	A->Top = A->Length = 1; 
 	A->Sign = PLUS;
@@ -109,8 +112,8 @@ void GF2N_Init_Rand(GF2N *A, const UNWORD maxsize)
  */
 void GF2N_Init_Copy(GF2N *R, const GF2N *A)
 {
-	// A 와 크기 같은 BIGNUM 생성
-	GF2N_Init(R, A->Length, A->Flag);
+	// A 의 값 크기 (Length, 최소 1) 만큼 GF2N 생성
+	GF2N_Init(R, (A->Length == 0) ? 1 : A->Length, A->Flag);
 	GF2N_Copy(R, A); // 값 복사
 }
 
@@ -148,7 +151,7 @@ void GF2N_Randomize(GF2N *A)
 void GF2N_Zero(GF2N *A)
 {	
 	GF2N_Zeroize(A);
-	A->Num = (UNWORD *)realloc(A->Num, sizeof(UNWORD)); 
+	A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, 1); 
     A->Top = 1;
 }
 
@@ -172,20 +175,20 @@ void GF2N_Zeroize(GF2N *A)
 /**
  * @brief GF2N Copy A to R
  * @details
- * - GF2N *A 값을 GF2N *R 로 복사 (*A 와 동일 크기 *R 출력) \n
- * - 내부에서 GF2N *A 와 동일한 크기 GF2N *R 재할당 \n
+ * - GF2N *A 값을 GF2N *R 로 복사 (A->Length 개 WORD 복사) \n
+ * - *R 배열 크기가 A->Length 보다 작은 경우만 재할당 (배열 크기 유지) \n
  * @param[in,out] GF2N *R
  * @param[in] GF2N *A (const)
  * @date 2017. 04. 06. v1.00 \n
+ * @date 2026. 10. 17. 배열 크기 유지 (A->Length 크기로 재할당 X) \n
  */
 void GF2N_Copy(GF2N *R, const GF2N *A)
 {
-	SNWORD i;
-	// *R 크기와 *A 가 다르면 동일한 크기인 0 배열로 재할당
-	if(R->Top != A->Top)
-		GF2N_Zero_Realloc_Mem(R, A->Length);
-	// 값 복사 (R->Top = A->Top 상태)
-	for(i = R->Top ; i > 0 ; i--) 
+	UNWORD i;
+	// *R 배열 크기가 작으면 재할당, 크면 A->Length 이상 이전 값 0 초기화
+	GF2N_Result_Size(R, A->Length);
+	// 값 복사
+	for(i = A->Length ; i > 0 ; i--)
 		R->Num[i - 1] = A->Num[i - 1];
 	// 나머지 복사
 	R->Length = A->Length;
@@ -214,16 +217,18 @@ void GF2N_Realloc_Mem(GF2N *A, const UNWORD size)
 		// 입력받은 size 크기 보다 큰 값들을 0 으로 세팅 후
 		for(i = A->Top ; i > size ; i--)
 			A->Num[i - 1] = 0;
-		A->Top = A->Length = size;
-		A->Num = (UNWORD *)realloc(A->Num, (A->Top * sizeof(UNWORD)));
+		A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, size);
+		A->Top = size;
+		if(A->Length > size)
+			A->Length = size;
 	}
 	else if(A->Top < size)
 	{
 		// 메모리만 재할당 (항상 size > 0)
-		A->Num = (UNWORD *)realloc(A->Num, (size * sizeof(UNWORD)));
+		A->Num = UW_Mem_Realloc(A->Alloc, A->Num, A->Top, size);
 		// 재할당 받은 배열 값 0 으로 세팅
 		for(i = A->Top ; i < size ; i++)
-			A->Num[i - 1] = 0;
+			A->Num[i] = 0;
 		A->Top = size; // A->Length = 기존 값 유지
 	}	
 }
@@ -252,24 +257,17 @@ void GF2N_Zero_Realloc_Mem(GF2N *A, const UNWORD size)
 /**
  * @brief Top Check of GF2N *A
  * @details
- * - GF2N *A 입력 값의 배열 크기 최적화 \n
- * - A->Top != A->Length 인 경우 메모리 재할당 (A->Top == A->Length) \n
- * - BIGNUM *A 가 빈 배열이면 메모리 할당 \n
+ * - GF2N *A 가 빈 배열이면 메모리 할당 \n
+ * - 배열 크기 (Top) 는 줄이지 않음 (배열 크기 줄이기 : GF2N_Shrink) \n
  * @param[in, out] GF2N *A
  * @date 2017. 04. 20. \n
- * @todo 경우 더 생각해보기
+ * @date 2026. 10. 17. Top = Length 재할당 제거 \n
  */
 void GF2N_Top_Check(GF2N *A)
 {
-	// TODO 
-
-	// BIGNUM *A 의 메모리가 할당되지 않은 경우
+	// GF2N *A 의 메모리가 할당되지 않은 경우
 	if(A->Top == 0)
 		GF2N_Init_Zero(A);
-	
-	// 실제 할당된 배열 크기와 값이 들어있는 배열 크기 다르면 재할당
-	if((A->Top != A->Length) && (A->Length != 0))
-		GF2N_Realloc_Mem(A, A->Length);	
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,51 +275,70 @@ void GF2N_Top_Check(GF2N *A)
  * @brief Result size check of GF2N *A
  * @details
  * - 연산의 결과 값의 배열 크기 체크 \n
- * - A->Top 크기가 입력된 연산의 출력 크기 보다 작으면 메모리 재할당 \n
- * - GF2N *A 가 빈 배열이면 메모리 할당
+ * - A->Top 크기가 입력된 연산의 출력 크기 보다 작으면 메모리 재할당 (배열 크기 줄이지 않음) \n
+ * - 재할당 X 인 경우 이전 값의 size 이상 WORD 0 초기화 (Length 이상 WORD 는 항상 0) \n
+ * - GF2N *A 가 빈 배열이면 메모리 할당 \n
+ * - 호출 후 연산에서 [0, size) WORD 를 모두 쓰고 Length 설정 \n
  * @param[in, out] GF2N *A
+ * @param[in] UNWORD size (const) 연산 결과 최대 WORD 개수
  * @date 2017. 04. 20. \n
- * @todo 경우 더 생각해보기
+ * @date 2026. 10. 17. 빈 배열도 size 만큼 할당, 이전 값 0 초기화 \n
  */
 void GF2N_Result_Size(GF2N *A, const UNWORD size)
-{	
-	// TODO 
+{
+	UNWORD i;
 
 	// GF2N *A 의 메모리가 할당되지 않은 경우
 	if(A->Top == 0)
 		GF2N_Init_Zero(A);
-	else if(A->Top < size) // (A->Top >= size) 인 경우 재할당 X
-		GF2N_Realloc_Mem(A, size); // 
+
+	if(A->Top < size) // 재할당 (늘어난 배열 0 초기화)
+		GF2N_Realloc_Mem(A, size);
+	else if(A->Length > size) // (A->Top >= size) 인 경우 재할당 X, 결과보다 긴 이전 값만 0 초기화
+	{
+		for(i = size ; i < A->Length ; i++)
+			A->Num[i] = 0;
+		A->Length = size;
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /**
  * @brief Optimize Output of GF2N *A
  * @details
- * - GF2N *A 값의 크기 최적화 출력 (Memory, Length)
+ * - GF2N *A 값의 크기 최적화 출력 (Length)
  * - GF2N *A 가 0 인 경우 *A 의 Sign = ZERO
  * - 최상위 WORD 부터 값이 0 인지 체크
+ * - 배열 크기 (Top) 유지, 재할당 X (다음 연산에서 재사용, 배열 크기 줄이기 : GF2N_Shrink)
  * @param[in, out] GF2N *A
  * @date 2017. 04. 20. \n
+ * @date 2026. 10. 17. Length 만 정규화 (Top = Length 재할당 제거) \n
  */
 void GF2N_Optimize(GF2N *A)
 {
-	// TODO
-	
-	// 빈 배열 체크
-	while(A->Num[A->Length - 1] == 0)
+	// 빈 배열 체크 (Length == 0 인 경우 Num[-1] 접근 X)
+	while((A->Length != 0) && (A->Num[A->Length - 1] == 0))
 		A->Length--;
 
-	// 실제 할당된 배열 크기와 값이 들어있는 배열 크기 다르면 재할당
-	if((A->Top != A->Length) && (A->Top != 0))
-		GF2N_Realloc_Mem(A, A->Length); // A->Top = A->Length 세팅
-	
-	//실제 *A 에 저장된 값이 0 인 경우  
-	if((A->Length == 1) && (A->Num[0] == 0))
-	{	
-		A->Length = 0;
-		A->Sign = ZERO; 
-	}
+	if(A->Length == 0)
+		A->Sign = ZERO;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Shrink to fit GF2N *A
+ * @details
+ * - GF2N *A 배열 크기 (Top) 를 값 크기 (Length, 최소 1) 로 재할당 \n
+ * - 연산 결과는 배열 크기 유지 (GF2N_Optimize) -> 오래 보관하는 값의 메모리 줄일 때 호출 \n
+ * @param[in, out] GF2N *A
+ * @date 2026. 10. 17. \n
+ */
+void GF2N_Shrink(GF2N *A)
+{
+	UNWORD size = (A->Length == 0) ? 1 : A->Length;
+
+	if(A->Top > size)
+		GF2N_Realloc_Mem(A, size);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -336,7 +353,7 @@ void GF2N_Optimize(GF2N *A)
  */
 void GF2N_Free(GF2N *A)
 {
-	free(A->Num);
+	UW_Mem_Free(A->Alloc, A->Num, A->Top);
 	A->Num = NULL;
 	A->Top = 0;
 	A->Length = 0;
@@ -356,12 +373,12 @@ void GF2N_Free(GF2N *A)
  */
 void GF2N_Zero_Free(GF2N *A)
 {
-	while(A->Top > 0)
-	{
-		A->Num[(A->Top - 1)] = 0;
-		A->Top--;
-	}	
-	free(A->Num);
+	UNWORD i;
+	// Top 유지 (할당자에 배열 크기 전달)
+	for(i = A->Top ; i > 0 ; i--)
+		A->Num[i - 1] = 0;
+	UW_Mem_Free(A->Alloc, A->Num, A->Top);
+	A->Top = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,58 +388,40 @@ void GF2N_Zero_Free(GF2N *A)
  * - GF2N *A 오른쪽으로 n 비트 시프트 \n
  * - 외부에서 결과 값 저장 할 GF2N *R 생성해서 입력 \n
  * - GF2N_RShift_Bit(R, R, s_bit) 가능
+ * - WORD 이동과 bit shift 를 한 번에 처리 (UW_RShift_n) \n
  * @param[out] GF2N *R 
  * @param[in] GF2N *A 
  * @param[in] s_bit (const) // shift bit
  * @date 2017. 04. 13. v1.00 \n
+ * @date 2026. 10. 17. 한 번에 이동 (UW_RShift_n), A 빈 배열 할당 X \n
  */
 void GF2N_RShift_Bit(GF2N *R, GF2N *A, const UNWORD s_bit)
 {
-	UNWORD i;
-	UNWORD tmp_word;
-	UNWORD tmp_bit = s_bit;
+	UNWORD i, n;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;			// Move word
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);			// New shift bits
 
-	GF2N_Top_Check(A);
-	// R = A 인 경우 재할당 X , Ex) GF2N_RShift_Bit(R, R, shift);
-	GF2N_Result_Size(R, A->Top);
-	
-	// Right Shift 값이 현재 할당된 배열 보다 크면 결과는 0
-	if(s_bit > (A->Length * BIT_LEN))
-		GF2N_Zero(R);
-	else
+	// 결과가 0 인 경우 (A = 0 포함, 배열 크기 유지)
+	if(tmp_word >= A->Length)
 	{
-		if(s_bit >= BIT_LEN) // s_bit >= BIT_LEN (워드 이동)
-		{
-			tmp_word = UW_Div(s_bit, BIT_LEN);		// Move word
-			tmp_bit = UW_Mod(s_bit, BIT_LEN);		// New shift bits
-			// WORD 이동
-			for(i = 0 ; i < A->Length - tmp_word ; i++)
-				R->Num[i] = A->Num[i + tmp_word];
-			// 이동된 나머지 WORD = 0 채우기
-			for( ; i < A->Length ; i++)
-				R->Num[i] = 0;
-			// 연산 후 길이
-			R->Length = A->Length - tmp_word;
-		}
-		else
-		{
-			for(i = 0 ; i < A->Length ; i++)
-				R->Num[i] = A->Num[i];
-			// 연산 후 길이
-			R->Length = A->Length;
-		}		
-		if(tmp_bit != 0) // tmp_bit == 0 인 경우 WORD 이동만
-		{
-			// s_bit < BIT_LEN 인 상태 
-			for(i = 0 ; i < (R->Length - 1) ; i++) 
-				R->Num[i] = (R->Num[i + 1] << (BIT_LEN - tmp_bit)) ^ (R->Num[i] >> tmp_bit);
-			// 최상위 WORD 처리 (i = A->Num[A->Top - 1] 일 때)
-			R->Num[i] >>= tmp_bit;
-		}
-		R->Top = A->Top;
-		R->Sign = A->Sign;
-		R->Flag = A->Flag;
+		for(i = 0 ; i < R->Length ; i++)
+			R->Num[i] = 0;
+		R->Length = 0;
+		R->Sign = ZERO;
+		return;
 	}
+
+	n = A->Length - tmp_word;
+	// R = A 인 경우 재할당 X , Ex) GF2N_RShift_Bit(R, R, shift);
+	GF2N_Result_Size(R, A->Length);
+	UW_RShift_n(R->Num, A->Num + tmp_word, n, tmp_bit);
+	// 이동된 나머지 WORD = 0 채우기 (Length 이상 WORD 는 항상 0)
+	for(i = n ; i < A->Length ; i++)
+		R->Num[i] = 0;
+
+	R->Length = n;
+	R->Sign = A->Sign;
+	R->Flag = A->Flag;
 	GF2N_Optimize(R);
 }
 
@@ -432,62 +431,146 @@ void GF2N_RShift_Bit(GF2N *R, GF2N *A, const UNWORD s_bit)
  * @details
  * - GF2N *A 왼쪽으로 n 비트 시프트 \n
  * - 외부에서 결과 값 저장 할 GF2N *R 생성해서 입력 \n
+ * - GF2N_LShift_Bit(R, R, s_bit) 가능
+ * - 최상위 WORD 의 0 bit 개수 (UW_Clz) 로 결과 길이 계산, WORD 이동과 bit shift 를 한 번에 처리 (UW_LShift_n) \n
  * @param[out] GF2N *R 
  * @param[in] GF2N *A 
  * @param[in] s_bit (const) // shift bit
  * @date 2017. 04. 20. \n
+ * @date 2026. 10. 17. A = 0 인 경우 Num[-1] 읽기 수정, UW_Clz / UW_LShift_n 사용 \n
  */
 void GF2N_LShift_Bit(GF2N *R, GF2N *A, const UNWORD s_bit)
 {
-	SNWORD i;
-	UNWORD tmp_word = UW_Div(s_bit, BIT_LEN);	// 실제 추가되는 WORD;
-	UNWORD tmp_bit = UW_Mod(s_bit, BIT_LEN);	// 실제 Shift bit;
-	UNWORD word_len = A->Length;
-	UNWORD zero_cnt = 0;
-	
-	for(i = BIT_LEN - 1 ; i >= 0 ; i--)
+	UNWORD i, len;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;			// 실제 추가되는 WORD
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);			// 실제 Shift bit
+
+	// A = 0 인 경우 결과 0 (최상위 WORD 없음)
+	if(A->Length == 0)
 	{
-		// 상위 WORD 부터 shift 하면서 0 인 bit 체크
-		if((A->Num[word_len - 1] >> i) == 0)
-			zero_cnt++;
-		else
-			break;		
-	}	
-	
-	if(zero_cnt < tmp_bit) // 최상위 WORD 1개 추가
-	{			
-		GF2N_Result_Size(R, (A->Length + tmp_word + 1));		
-		R->Num[R->Length - 1] = 0;					  // 최상위 배열 빈 상태 유지 (Shift carry 고려)
-		for(i = R->Length - 1 ; i > tmp_word ; i--)
-			R->Num[i - 1] = A->Num[i - 1 - tmp_word]; // Range : [(R->Length - 2), tmp_word]
-		for( ; i > 0 ; i--)							  
-			R->Num[i - 1] = 0;						  // Range : [(tmp_word - 1), 0]
+		for(i = 0 ; i < R->Length ; i++)
+			R->Num[i] = 0;
+		R->Length = 0;
+		R->Sign = ZERO;
+		return;
 	}
-	else // zero_cnt >= tmp_bit(조정)
+
+	// 최상위 WORD 의 0 bit 가 shift bit 보다 적으면 WORD 1개 추가
+	len = A->Length + tmp_word;
+	if(UW_Clz(A->Num[A->Length - 1]) < tmp_bit)
+		len++;
+
+	GF2N_Result_Size(R, len);
+	// 상위 WORD 부터 이동 (R = A 인 경우 덮어쓰기 전에 읽음)
+	if(len > A->Length + tmp_word)
+		R->Num[len - 1] = UW_LShift_n(R->Num + tmp_word, A->Num, A->Length, tmp_bit);
+	else
+		UW_LShift_n(R->Num + tmp_word, A->Num, A->Length, tmp_bit);
+	for(i = 0 ; i < tmp_word ; i++)
+		R->Num[i] = 0;
+
+	// R 설정 동일하게
+	R->Length = len;
+	R->Sign = A->Sign;
+	R->Flag = A->Flag;
+}
+
+/**
+ * @brief GF2N n-bit Right Shift (in-place)
+ * @details
+ * - A = A >> s_bit, 재할당 X (Top 유지), 밀려난 bit 리턴 \n
+ * - 리턴 값은 밀려난 bit 중 하위 min(s_bit, BIT_LEN) bit (s_bit <= BIT_LEN 이면 밀려난 bit 전부) \n
+ * @param[in,out] GF2N *A
+ * @param[in] UNWORD s_bit (const)
+ * @return UNWORD 밀려난 bit (A mod 2^min(s_bit, BIT_LEN))
+ * @date 2026. 10. 17. \n
+ */
+UNWORD GF2N_RShift_Bit_Inplace(GF2N *A, const UNWORD s_bit)
+{
+	UNWORD i, n, out;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);
+
+	if(A->Length == 0)
+		return 0;
+	out = A->Num[0];
+	if(s_bit < BIT_LEN)
+		out &= ((UNWORD)1 << s_bit) - 1;
+
+	if(tmp_word >= A->Length)
 	{
-		GF2N_Result_Size(R, (A->Length + tmp_word));		
-		for(i = R->Length ; i > tmp_word ; i--)
-			R->Num[i - 1] = A->Num[i - 1 - tmp_word]; // Range : [(R->Length - 2), tmp_word]
-		for( ; i > 0 ; i--)							  
-			R->Num[i - 1] = 0;						  // Range : [(tmp_word - 1), 0]
+		for(i = 0 ; i < A->Length ; i++)
+			A->Num[i] = 0;
+		A->Length = 0;
+		A->Sign = ZERO;
+		return out;
 	}
 
-	if(tmp_bit != 0) // tmp_bit == 0 인 경우 WORD 이동만 필요
+	n = A->Length - tmp_word;
+	UW_RShift_n(A->Num, A->Num + tmp_word, n, tmp_bit);
+	for(i = n ; i < A->Length ; i++)
+		A->Num[i] = 0;
+	// 최상위 WORD 만 0 이 될 수 있음
+	A->Length = (A->Num[n - 1] == 0) ? n - 1 : n;
+	if(A->Length == 0)
+		A->Sign = ZERO;
+	return out;
+}
+
+/**
+ * @brief GF2N n-bit Left Shift (in-place)
+ * @details
+ * - A = (A << s_bit) mod 2^(BIT_LEN * Top), 재할당 X (현재 배열 크기 안에서 shift), 밀려난 bit 리턴 \n
+ * - 리턴 값은 배열 밖으로 밀려난 bit 중 하위 BIT_LEN bit (0 이면 값 손실 없음, s_bit <= BIT_LEN 이면 밀려난 bit 전부) \n
+ * - 기약 다항식으로 줄인 값의 x 곱 (GF2N_Mul) 처럼 배열 크기가 정해진 곳에서 사용 \n
+ * @param[in,out] GF2N *A
+ * @param[in] UNWORD s_bit (const)
+ * @return UNWORD 밀려난 bit
+ * @date 2026. 10. 17. \n
+ */
+UNWORD GF2N_LShift_Bit_Inplace(GF2N *A, const UNWORD s_bit)
+{
+	UNWORD i, n, out;
+	UNWORD tmp_word = s_bit >> WORD_SHIFT;
+	UNWORD tmp_bit = s_bit & (BIT_LEN - 1);
+
+	if(A->Length == 0)
+		return 0;
+
+	if(tmp_word >= A->Top)
 	{
-		// s_bit < zero_cnt 인 상태 
-		for(i = R->Length - 1 ; i > 0 ; i--) 
-			R->Num[i] = (R->Num[i] << tmp_bit) ^ (R->Num[i - 1] >> (BIT_LEN - tmp_bit));
-		// 최하위 WORD 처리 (i = A->Num[0] 일 때)
-		R->Num[i] <<= tmp_bit;
+		// 값 전체가 밀려남 : Top WORD 위치의 bit = A << (s_bit - BIT_LEN * Top)
+		out = (tmp_word == A->Top) ? (A->Num[0] << tmp_bit) : 0;
+		for(i = 0 ; i < A->Length ; i++)
+			A->Num[i] = 0;
+		A->Length = 0;
+		A->Sign = ZERO;
+		return out;
 	}
-		
-	// 연산 후 길이
-	R->Length = R->Top;	
-	// R 설정 동일하게
-	R->Sign = A->Sign;
-	R->Flag = A->Flag;
-	GF2N_Optimize(R);
 
+	// 배열에 남는 A 의 WORD 개수 n, Top WORD 위치로 밀려나는 bit
+	n = A->Top - tmp_word;
+	if(n >= A->Length)
+	{
+		n = A->Length;
+		out = 0;
+	}
+	else
+		out = (A->Num[n] << tmp_bit) | ((tmp_bit == 0) ? 0 : (A->Num[n - 1] >> (BIT_LEN - tmp_bit)));
+
+	i = UW_LShift_n(A->Num + tmp_word, A->Num, n, tmp_bit);
+	if(n + tmp_word < A->Top)
+		A->Num[n + tmp_word] = i;
+	else if(n == A->Length)
+		out = i;
+	for(i = 0 ; i < tmp_word ; i++)
+		A->Num[i] = 0;
+
+	A->Length = n + tmp_word + 1;
+	if(A->Length > A->Top)
+		A->Length = A->Top;
+	GF2N_Optimize(A);
+	return out;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -558,11 +641,11 @@ SNWORD GF2N_Cmp(GF2N *A, GF2N *B)
  * - 다항식의 차수인 최상위 bit 출력 \n
  * @param[in] GF2N *A (const)
  * @date 2017. 04. 05. v1.00 \n
+ * @date 2026. 10. 17. bit 단위 반복 -> UW_Bit_Len \n
  */
 UNWORD GF2N_Deg(const GF2N *A)
 {
 	UNWORD degree;
-	UNWORD mask;
 
 	// A->Length 가 0 이면 degree 0 리턴
 	if(!A->Length)
@@ -570,16 +653,8 @@ UNWORD GF2N_Deg(const GF2N *A)
 		degree = 0;
 		return degree;
 	}
-	// 최상위 - 1 배열만큼은 degree 보장
-	degree = (A->Length - 1) * BIT_LEN;
-	
-	// 최상위 배열의 1 위치 판단
-	mask = A->Num[A->Length - 1]; 
-	while(mask)
-	{
-		mask = (mask >> 1); // 하위 bit 부터 탐색
-		degree++;
-	}
+	// 최상위 - 1 배열만큼은 degree 보장, 최상위 배열의 1 위치는 UW_Bit_Len (clz)
+	degree = (A->Length - 1) * BIT_LEN + UW_Bit_Len(A->Num[A->Length - 1]);
 	if(degree)
 		return (degree - 1);
 	else // A->Length 는 1 이지만 degree 는 0 인 경우 
@@ -678,7 +753,7 @@ void GF2N_Print_poly(const GF2N *A)
 				if(n != 0) // 맨 처음 다항식 앞엔 + 안붙음
 					printf("+");
 				// 다항식 차수 계산
-				printf("x^%d", (BIT_LEN * i) + j);
+				printf("x^%d", (SNINT)((BIT_LEN * i) + j));
 				n = 1;
 			}	
 			mask >>= 1;
@@ -715,7 +790,7 @@ void GF2N_FPrint_poly(FILE *fp, const GF2N *A)
 				if(n != 0) // 맨 처음 다항식 앞엔 + 안붙음
 					fprintf(fp, "+");
 				// 다항식 차수 계산
-				fprintf(fp, "x^%d", (BIT_LEN * i) + j); 
+				fprintf(fp, "x^%d", (SNINT)((BIT_LEN * i) + j)); 
 				n = 1;
 			}	
 			mask >>= 1;
@@ -724,6 +799,101 @@ void GF2N_FPrint_poly(FILE *fp, const GF2N *A)
 	}
 }
 
+/**
+ * @brief Byte length of GF2N *A
+ * @details
+ * - 값 A 를 나타내는 최소 byte 개수 (A = 0 이면 0) \n
+ * - GF2N_To_Bytes 의 최소 출력 길이 \n
+ * @param[in] GF2N *A (const)
+ * @return UNWORD byte 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD GF2N_Num_Bytes(const GF2N *A)
+{
+	if(A->Length == 0)
+		return 0;
+	return ((A->Length << WORD_SHIFT) - UW_Clz(A->Num[A->Length - 1]) + 7) >> 3;
+}
+
+/**
+ * @brief Big endian bytes to GF2N *R
+ * @details
+ * - R = buf[0..len-1] (buf[0] 이 최상위 byte, 다항식 계수 bit) \n
+ * - R 배열 크기가 충분하면 재할당 X (미리 GF2N_Result_Size 로 크기 확보 시 Num 에 바로 변환) \n
+ * - WORD 단위 한 번에 읽기 (UW_From_Bytes : bswap / movbe) \n
+ * @param[out] GF2N *R
+ * @param[in] UCHAR *buf (const)
+ * @param[in] UNWORD len (const) byte 개수
+ * @date 2026. 10. 17. \n
+ */
+void GF2N_From_Bytes(GF2N *R, const UCHAR *buf, const UNWORD len)
+{
+	UNWORD n = UW_WORDS(len << 3);
+
+	GF2N_Result_Size(R, n);
+	UW_From_Bytes(R->Num, n, buf, len);
+	R->Length = n;
+	R->Sign = PLUS;
+	GF2N_Optimize(R);
+}
+
+/**
+ * @brief Little endian bytes to GF2N *R
+ * @details
+ * - R = buf[0..len-1] (buf[0] 이 최하위 byte), GF2N_From_Bytes 와 동일 \n
+ * @param[out] GF2N *R
+ * @param[in] UCHAR *buf (const)
+ * @param[in] UNWORD len (const) byte 개수
+ * @date 2026. 10. 17. \n
+ */
+void GF2N_From_Bytes_LE(GF2N *R, const UCHAR *buf, const UNWORD len)
+{
+	UNWORD n = UW_WORDS(len << 3);
+
+	GF2N_Result_Size(R, n);
+	UW_From_Bytes_LE(R->Num, n, buf, len);
+	R->Length = n;
+	R->Sign = PLUS;
+	GF2N_Optimize(R);
+}
+
+/**
+ * @brief GF2N *A to big endian bytes (fixed width)
+ * @details
+ * - buf[0..len-1] = A (buf[0] 이 최상위 byte), 길이 len 고정 (상위 byte 0 채우기) \n
+ * - len < GF2N_Num_Bytes(A) 이면 FALSE (buf 변경 X) \n
+ * @param[out] UCHAR *buf
+ * @param[in] UNWORD len (const) byte 개수
+ * @param[in] GF2N *A (const)
+ * @return SNWORD TRUE/FALSE
+ * @date 2026. 10. 17. \n
+ */
+SNWORD GF2N_To_Bytes(UCHAR *buf, const UNWORD len, const GF2N *A)
+{
+	if(GF2N_Num_Bytes(A) > len)
+		return FALSE;
+	UW_To_Bytes(buf, len, A->Num, A->Length);
+	return TRUE;
+}
+
+/**
+ * @brief GF2N *A to little endian bytes (fixed width)
+ * @details
+ * - buf[0..len-1] = A (buf[0] 이 최하위 byte), GF2N_To_Bytes 와 동일 \n
+ * @param[out] UCHAR *buf
+ * @param[in] UNWORD len (const) byte 개수
+ * @param[in] GF2N *A (const)
+ * @return SNWORD TRUE/FALSE
+ * @date 2026. 10. 17. \n
+ */
+SNWORD GF2N_To_Bytes_LE(UCHAR *buf, const UNWORD len, const GF2N *A)
+{
+	if(GF2N_Num_Bytes(A) > len)
+		return FALSE;
+	UW_To_Bytes_LE(buf, len, A->Num, A->Length);
+	return TRUE;
+}
+
 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -734,6 +904,7 @@ void GF2N_FPrint_poly(FILE *fp, const GF2N *A)
  * - GF2N *A 와 GF2N *B 를 더해서 GF2N *R 출력
  * - GF(2) 에서는 +, - 동일 연산 부호 구분 X
  * - *R 의 최대 크기 = A.Length or B.Length
+ * - R = A or R = B 가능 (같은 index 읽은 후 저장)
  * @param[out] GF2N *R
  * @param[in] GF2N *A (const)
  * @param[in] GF2N *B (const)
@@ -743,6 +914,9 @@ void GF2N_Add(GF2N *R, GF2N *A, GF2N *B)
 {
 	UNWORD i, tmp_len;
 
+	// R 크기가 결과보다 작으면 재할당 (R = A or B 인 경우 재할당 X)
+	GF2N_Result_Size(R, (A->Length > B->Length) ? A->Length : B->Length);
+
     // 더 큰 수 기준으로 덧셈
 	if(A->Length > B->Length)
 	{
@@ -778,6 +952,7 @@ void GF2N_Add(GF2N *R, GF2N *A, GF2N *B)
  * - GF2N *A 를 *IRR 로 나눈 몫과 나머지
  * - *R 의 최대 크기 = IRR 길이
  * - Lecture Note 참고
+ * - 임시 BN_CTX 사용 (반복 호출 시 GF2N_Div_Ctx 사용)
  * @param[out] GF2N *R
  * @param[in] GF2N *A 
  * @param[in] GF2N *IRR (const)
@@ -785,32 +960,60 @@ void GF2N_Add(GF2N *R, GF2N *A, GF2N *B)
 
  */
 void GF2N_Div(GF2N *Q, GF2N *R, GF2N *A, GF2N *IRR)
+{
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	GF2N_Div_Ctx(Q, R, A, IRR, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief Divide GF2N *A by GF2N *IRR (Division, BN_CTX)
+ * @details
+ * - GF2N_Div 와 동일, 임시 값은 BN_CTX *ctx 에서 재사용 \n
+ * - R = A 가능, Q 는 A, R 과 다른 GF2N (A 를 R 에 복사 후 Q 초기화) \n
+ * - 매 단계 x^(deg(R) - deg(IRR)) * IRR 은 IRR 의 bit shift (GF2N_LShift_Bit) \n
+ * @param[out] GF2N *Q
+ * @param[out] GF2N *R
+ * @param[in] GF2N *A 
+ * @param[in] GF2N *IRR (const)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. deg(A) >= deg(IRR) 에서 무한 루프 수정 (차수 차이 값이 아닌 단항식 사용) \n
+ */
+void GF2N_Div_Ctx(GF2N *Q, GF2N *R, GF2N *A, GF2N *IRR, BN_CTX *ctx)
 {
 	UNWORD deg_m, deg_r;
-	GF2N ft, deg_tmp;
+	GF2N *ft, *one, *mono;
 	
-	GF2N_Result_Size(Q, A->Top);
-	GF2N_Result_Size(R, A->Top);
-	
-	GF2N_Init_One(&deg_tmp);		// 임시 deg 저장
-	GF2N_Init(&ft, IRR->Length, DEFAULT);	// 임시 GF2N
+	// R = A 인 경우 값 유지 (R 에 A 복사 후 Q 초기화)
 	GF2N_Copy(R, A);
+	GF2N_Optimize(R);
+	GF2N_Zeroize(Q);
+	
+	BN_CTX_Start(ctx);
+	one = GF2N_CTX_Get(ctx, 1);				// 1 (x^0)
+	one->Num[0] = 1;
+	mono = GF2N_CTX_Get(ctx, 1);			// 몫의 단항식 x^(deg_r - deg_m)
+	ft = GF2N_CTX_Get(ctx, R->Length);		// x^(deg_r - deg_m) * IRR
 	
 	deg_m = GF2N_Deg(IRR);	// 기약 다항식(IRR) 최고차항 m (고정)
 	deg_r = GF2N_Deg(R);	// 초기 Deg(R(x))
-	while(deg_r >= deg_m)
+	while((R->Length != 0) && (deg_r >= deg_m))
 	{			
-		deg_tmp.Num[0] = (deg_r - deg_m);
-
-		GF2N_Mul(&ft, IRR, &deg_tmp, IRR);
-		GF2N_Add(R, R, &ft);
-		GF2N_Add(Q, Q, &deg_tmp);
+		// 단항식 곱은 bit shift : ft = IRR << (deg_r - deg_m), Q 에 같은 bit 추가
+		GF2N_LShift_Bit(ft, IRR, (deg_r - deg_m));
+		GF2N_LShift_Bit(mono, one, (deg_r - deg_m));
+		GF2N_Add(R, R, ft);
+		GF2N_Add(Q, Q, mono);
 		
+		// 최상위 bit 제거 후 상위 0 WORD 정리 (GF2N_Deg 는 최상위 WORD 기준)
+		GF2N_Optimize(R);
 		deg_r = GF2N_Deg(R);		
 	}
 
-	GF2N_Zero_Free(&ft);
-	GF2N_Zero_Free(&deg_tmp);
+	BN_CTX_End(ctx);
 	
 	GF2N_Optimize(R);
 	GF2N_Optimize(Q);
@@ -820,58 +1023,86 @@ void GF2N_Div(GF2N *Q, GF2N *R, GF2N *A, GF2N *IRR)
  * @details
  * - GF2N *A 를 *IRR 로 나눈 나머지
  * - *R 의 최대 크기 = IRR 길이
+ * - 임시 BN_CTX 사용 (반복 호출 시 GF2N_Redc_Ctx 사용)
  * @param[out] GF2N *R
  * @param[in] GF2N *A (const)
  * @param[in] GF2N *IRR (const)
  * @date 2017. 04. 16. \n
  */
 void GF2N_Redc(GF2N *Out, GF2N *In, GF2N *Irr)
+{
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	GF2N_Redc_Ctx(Out, In, Irr, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief GF2N *A Modulus GF2N *IRR (Reduction, BN_CTX)
+ * @details
+ * - GF2N_Redc 와 동일, 임시 값 (입력 복사본, BIT_LEN 개 중간값) 은 BN_CTX *ctx 에서 재사용 \n
+ * - Out = In 가능 (입력 복사본에 계산 후 복사) \n
+ * - 중간값 x^i * IRR 은 재할당 없는 1 bit shift (GF2N_LShift_Bit_Inplace) \n
+ * - 입력 차수가 IRR 차수보다 작으면 (입력 0 포함) 복사 후 종료 \n
+ * @param[out] GF2N *R
+ * @param[in] GF2N *A (const)
+ * @param[in] GF2N *IRR (const)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void GF2N_Redc_Ctx(GF2N *Out, GF2N *In, GF2N *Irr, BN_CTX *ctx)
 {
 	SNWORD i, j;
-	UNWORD m1, m2, m, n, CurPos, msb=0, msbMASK=1, msbIn=0, msbIrr=0;
-	GF2N tmp, r[32];
+	UNWORD m1, m2, m, n, CurPos, msb=0, msbMASK=1;
+	GF2N *tmp, *r[BIT_LEN];
 
-	if(In->Length == Irr->Length)
+	// 입력 차수 < 기약다항식 차수 (입력 0 포함) 이면 나머지 = 입력
+	if((In->Length == 0) || (GF2N_Deg(In) < GF2N_Deg(Irr)))
 	{
-		UW_BitSearch(&msbIn,  In->Num[In->Length-1]);
-		UW_BitSearch(&msbIrr, Irr->Num[Irr->Length-1]);
-
-		if(msbIn < msbIrr)
-		{
-			GF2N_Copy(Out, In);
-		}
+		GF2N_Copy(Out, In);
+		return;
 	}
 
+	BN_CTX_Start(ctx);
+
 	// 입력값 복사
-	GF2N_Init(&tmp, In->Length, DEFAULT);
-	GF2N_Copy(&tmp, In);
+	tmp = GF2N_CTX_Get(ctx, In->Length);
+	GF2N_Copy(tmp, In);
 
 	// 중간값 배열 할당
-	for(i=0; i<32; i++)
-		GF2N_Init(&r[i], Irr->Length+1, DEFAULT);
+	for(i=0; i<BIT_LEN; i++)
+		r[i] = GF2N_CTX_Get(ctx, Irr->Length+1);
 
-	// 기약다항식 복사
-	GF2N_Copy(&r[0], Irr);
+	// 기약다항식 복사 (r[0] 배열 크기 유지 -> 재할당 X)
+	for(j=0; j<(SNWORD)Irr->Length; j++)
+		r[0]->Num[j] = Irr->Num[j];
+	r[0]->Length = Irr->Length;
+	r[0]->Sign = Irr->Sign;
+	r[0]->Flag = Irr->Flag;
 
 	// 기약다항식의 최상위 비트 위치 계산
 	UW_BitSearch(&msb, Irr->Num[Irr->Length-1]);
-	m2 = msb + ((Irr->Length-1) * 32);	
+	m2 = msb + ((Irr->Length-1) * BIT_LEN);	
 	
 	// 최고차항을 제거
 	msbMASK = msbMASK << msb;
-	r[0].Num[Irr->Length-1] ^= msbMASK;
+	r[0]->Num[Irr->Length-1] ^= msbMASK;
 
-	while(!r[0].Num[r[0].Length-1])
-		r[0].Length--;
+	while(!r[0]->Num[r[0]->Length-1])
+		r[0]->Length--;
 	
-	// 32개의 중간값 생성
-	for(i=1; i<32; i++)
-		GF2N_LShift_Bit(&r[i], &r[i-1], 1);
+	// BIT_LEN 개의 중간값 생성
+	for(i=1; i<BIT_LEN; i++)
+	{
+		GF2N_Copy(r[i], r[i-1]);
+		GF2N_LShift_Bit_Inplace(r[i], 1);
+	}
 
 	// 입력의 최상위 비트 위치 계산
 	msb = 0;
 	UW_BitSearch(&msb, In->Num[In->Length-1]);
-	m1 = msb + ((In->Length-1) * 32);
+	m1 = msb + ((In->Length-1) * BIT_LEN);
 		
 	// 최초 소거 위치 계산
 	CurPos = (UNWORD)1 << msb;
@@ -879,35 +1110,29 @@ void GF2N_Redc(GF2N *Out, GF2N *In, GF2N *Irr)
 	// 계산
 	for(i=(SNWORD)m1; i>=(SNWORD)m2; i--)
 	{
-		if(tmp.Num[i>>5] & CurPos)
+		if(tmp->Num[i>>WORD_SHIFT] & CurPos)
 		{
-			tmp.Num[i>>5] ^= CurPos;
+			tmp->Num[i>>WORD_SHIFT] ^= CurPos;
 
-			n = (i-m2) / 32;
-			m = (i-m2) & 31;
+			n = (i-m2) >> WORD_SHIFT;
+			m = (i-m2) & (BIT_LEN-1);
 
-			for(j=0; j<r[m].Length; j++)
-				tmp.Num[n+j] ^= r[m].Num[j];
+			for(j=0; j<r[m]->Length; j++)
+				tmp->Num[n+j] ^= r[m]->Num[j];
 		}
 
 		CurPos = CurPos >> 1;
 
 		if(!CurPos)
-			CurPos = 0x80000000;
+			CurPos = WORD_MASK_MSB;
 	}
 
-	GF2N_Copy(Out, &tmp);
-
-	while(!Out->Num[Out->Length-1])
-		Out->Length--;
-
-	if(Out->Length == -1)
-		Out->Length = 0;
+	GF2N_Copy(Out, tmp);
 
-	free(tmp.Num);
+	// 나머지 0 인 경우 Num[-1] 접근 X
+	GF2N_Optimize(Out);
 
-	for(i=0; i<32; i++)
-		free(r[i].Num);
+	BN_CTX_End(ctx);
 }
 
 /**
@@ -917,6 +1142,7 @@ void GF2N_Redc(GF2N *Out, GF2N *In, GF2N *Irr)
  * - Right-to-left : Shift-and-add \n
  * - Lecture Note 참고
  * - WORD 곱셈 -> R = A * B
+ * - 임시 BN_CTX 사용 (반복 호출 시 GF2N_Mul_Ctx 사용)
  * @param[out] BIGNUM *R
  * @param[in] BIGNUM *A (const)
  * @param[in] BIGNUM *B (const)
@@ -924,8 +1150,31 @@ void GF2N_Redc(GF2N *Out, GF2N *In, GF2N *Irr)
  */
 void GF2N_Mul(GF2N *Out, GF2N *In1, GF2N *In2, GF2N *Irr)
 {
-	GF2N T1, T2, tmpOut;
-	UNWORD Mask;
+	BN_CTX ctx;
+
+	BN_CTX_Init(&ctx);
+	GF2N_Mul_Ctx(Out, In1, In2, Irr, &ctx);
+	BN_CTX_Free(&ctx);
+}
+
+/**
+ * @brief Multiply GF2N *A and GF2N *B (Shift-and-add, BN_CTX)
+ * @details
+ * - GF2N_Mul 과 동일, 임시 값은 BN_CTX *ctx 에서 재사용 \n
+ * - Out = In1 or Out = In2 가능 (임시 값에 계산 후 Out 에 저장) \n
+ * - T1 = In2 * x^k mod Irr 는 bit 마다 제자리 1 bit shift (GF2N_LShift_Bit_Inplace) 후 x^m 항이 생기면 Irr 더하기 \n
+ * - (bit 마다 GF2N_Redc_Ctx 호출 X, 처음 In2 한 번만 줄임) \n
+ * @param[out] GF2N *Out
+ * @param[in] GF2N *In1 (const)
+ * @param[in] GF2N *In2 (const)
+ * @param[in] GF2N *Irr (const)
+ * @param[in,out] BN_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void GF2N_Mul_Ctx(GF2N *Out, GF2N *In1, GF2N *In2, GF2N *Irr, BN_CTX *ctx)
+{
+	GF2N *T1, *tmpOut;
+	UNWORD Mask, top, k, msb = 0;
 	int i=0, j=0;
 
 	if((!In1->Length) && (!In1->Num[0]))
@@ -950,16 +1199,21 @@ void GF2N_Mul(GF2N *Out, GF2N *In1, GF2N *In2, GF2N *Irr)
 	}
 	else
 	{
-		GF2N_Init(&T1, In1->Length+In2->Length, DEFAULT);
-		GF2N_Init(&T2, In1->Length+In2->Length, DEFAULT);
-		GF2N_Init(&tmpOut, In1->Length+In2->Length, DEFAULT);
+		BN_CTX_Start(ctx);
+		// T1 (deg < m) 의 x 곱은 Irr 길이 안에 들어감 -> 배열 크기 고정
+		T1 = GF2N_CTX_Get(ctx, (In2->Length > Irr->Length) ? In2->Length : Irr->Length);
+		tmpOut = GF2N_CTX_Get(ctx, Irr->Length);
 
-		GF2N_Copy(&T1, In2);
+		// 최고차항 x^m 위치 (Irr 최상위 WORD 의 bit)
+		UW_BitSearch(&msb, Irr->Num[Irr->Length-1]);
+		top = (UNWORD)1 << msb;
+
+		GF2N_Redc_Ctx(T1, In2, Irr, ctx);
 
 		Mask = In1->Num[0];
 
 		if(Mask & 1)
-			GF2N_Copy(&tmpOut, In2);
+			GF2N_Copy(tmpOut, T1);
 
 		i = 0;
 		while(i < In1->Length)
@@ -969,28 +1223,35 @@ void GF2N_Mul(GF2N *Out, GF2N *In1, GF2N *In2, GF2N *Irr)
 
 			while((Mask) || (i < In1->Length-1))
 			{
-				GF2N_LShift_Bit(&T2, &T1, 1);
-				GF2N_Redc(&T1, &T2, Irr);
+				// T1 = T1 * x mod Irr
+				GF2N_LShift_Bit_Inplace(T1, 1);
+				if((T1->Length == Irr->Length) && (T1->Num[Irr->Length-1] & top))
+				{
+					for(k = 0 ; k < Irr->Length ; k++)
+						T1->Num[k] ^= Irr->Num[k];
+					GF2N_Optimize(T1);
+				}
 				
 				if(Mask & 1)
-					GF2N_Add(&tmpOut, &tmpOut, &T1);
+					GF2N_Add(tmpOut, tmpOut, T1);
 
 				Mask = (Mask >> 1);
 
-				if(++j == 32)
+				if(++j == BIT_LEN)
 					break;
 			}
 
 			i++;
 		}
 
-		GF2N_Redc(Out, &tmpOut, Irr);
+		// T1 이 항상 줄인 값 -> tmpOut 도 deg < m
+		GF2N_Copy(Out, tmpOut);
+		BN_CTX_End(ctx);
 	}
 	
 	GF2N_Optimize(Out);
 }
 
-
 /**
  * @brief Square GF2N *A 
  * @details 
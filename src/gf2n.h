@@ -2,15 +2,21 @@
 #define _GF2N_H_
 
 #include "config.h"
+#include "bignum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 // STRUCT
 typedef struct _GF2N
 {
     UNWORD	*Num;		// BIGNUM Value
-	UNWORD	Top;		// Allocated Array Size (1 ~ )
+	UNWORD	Top;		// Allocated Array Size (1 ~ ), 연산 후에도 유지 (Num[Length ~ Top - 1] = 0)
 	UNWORD	Length;		// Value Size (0 ~ )
 	UNWORD	Sign;		// Sign (PLUS, ZERO) 
 	SNWORD	Flag;		// Option (DEFAULT, OPTIMIZE)
+	const UW_ALLOC *Alloc;	// Num 할당자 (생성 시점의 할당자, NULL : calloc / realloc / free)
 } GF2N;
 
 //////////////////////////
@@ -31,12 +37,17 @@ void GF2N_Zero_Realloc_Mem(GF2N *A, const UNWORD size);								// done
 void GF2N_Top_Check(GF2N *A);
 void GF2N_Result_Size(GF2N *A, const UNWORD size);
 void GF2N_Optimize(GF2N *A);													// done
+void GF2N_Shrink(GF2N *A);
 
 void GF2N_Free(GF2N *A);															// done
 void GF2N_Zero_Free(GF2N *A);														// done
 
+GF2N *GF2N_CTX_Get(BN_CTX *ctx, const UNWORD len);
+
 void GF2N_RShift_Bit(GF2N *R, GF2N *A, const UNWORD s_bit);					// done
 void GF2N_LShift_Bit(GF2N *R, GF2N *A, const UNWORD s_bit);					// done
+UNWORD GF2N_RShift_Bit_Inplace(GF2N *A, const UNWORD s_bit);
+UNWORD GF2N_LShift_Bit_Inplace(GF2N *A, const UNWORD s_bit);
 
 SNWORD GF2N_IsZero(const GF2N *A);
 UNWORD GF2N_Deg(const GF2N *A);														// done
@@ -48,13 +59,27 @@ void GF2N_FPrint_bin(FILE *fp, const GF2N *A);										// done
 void GF2N_Print_poly(const GF2N *A);												// done
 void GF2N_FPrint_poly(FILE *fp, const GF2N *A);										// done
 
+// Byte Conversion (big / little endian, 고정 길이 출력)
+UNWORD GF2N_Num_Bytes(const GF2N *A);
+void GF2N_From_Bytes(GF2N *R, const UCHAR *buf, const UNWORD len);
+void GF2N_From_Bytes_LE(GF2N *R, const UCHAR *buf, const UNWORD len);
+SNWORD GF2N_To_Bytes(UCHAR *buf, const UNWORD len, const GF2N *A);
+SNWORD GF2N_To_Bytes_LE(UCHAR *buf, const UNWORD len, const GF2N *A);
+
 // Define Function 
 
+void GF2N_Add(GF2N *R, GF2N *A, GF2N *B);
 void GF2N_Div(GF2N *Q, GF2N *R, GF2N *A, GF2N *IRR);
 void GF2N_Redc(GF2N *R, GF2N *A, GF2N *IRR);
+void GF2N_Div_Ctx(GF2N *Q, GF2N *R, GF2N *A, GF2N *IRR, BN_CTX *ctx);
+void GF2N_Redc_Ctx(GF2N *R, GF2N *A, GF2N *IRR, BN_CTX *ctx);
 
 
 void GF2N_Mul(GF2N *Out, GF2N *In1, GF2N *In2, GF2N *Irr);
+void GF2N_Mul_Ctx(GF2N *Out, GF2N *In1, GF2N *In2, GF2N *Irr, BN_CTX *ctx);
 
+#ifdef __cplusplus
+}
+#endif
 #else
 #endif
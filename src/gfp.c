@@ -0,0 +1,803 @@
+/**
+ * @file gfp.c
+ * @brief 소수체 (GF(p)) 연산 context : 표준 곡선 소수 전용 리덕션 (NIST P-192 / 224 / 256 / 384 / 521, 2^255 - 19)
+ * @details
+ * - NIST 소수 (generalized Mersenne) : 2n WORD 곱셈 결과를 32-bit limb 로 보고 limb 의 덧셈 / 뺄셈 만으로 리덕션 (Solinas)
+ * - P-521 (2^521 - 1) : 하위 521-bit + 상위 (>> 521) 한 번 더하기
+ * - 2^255 - 19 : 2^256 = 38 (mod p) 이용, 하위 256-bit + 38 * 상위
+ * - 그 외 2^k - c (c 는 작은 1 WORD, ex. secp256k1) : 하위 k-bit + c * 상위 두 번 접기
+ * - 그 외 소수 : Barrett (BN_BAR)
+ * - 리덕션 종류는 GFP_Init (소수 비교로 자동 선택) / GFP_Init_Curve (곡선 지정) 에서 한 번 선택, 연산은 switch 로 분기
+ * - 곱셈 / 제곱은 n WORD 고정 길이 (UW_Fixed_Mul / UW_Fixed_Sqr, 그 외 UW_Base_Mul / UW_Base_Sqr) 후 리덕션
+ * - Guide to Elliptic Curve Cryptography Algorithm 2.27 ~ 2.31 참고
+ * - 특수 소수 리덕션 / GFP_Add / GFP_Sub 의 마지막 보정은 고정 횟수 연산 + mask 선택 (값에 따른 분기 X) \n
+ *   Barrett (GFP_GENERIC) 과 BIGNUM 입출력 (Length 정규화) 은 가변 시간
+ * @date 2026. 10. 17.
+ * @date 2026. 10. 18. 마지막 보정 분기 제거
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include "config.h"
+#include "bignum.h"
+#include "word.h"
+#include "intrin.h"
+#include "gfp.h"
+
+// r[0..n-1] += c, 모든 WORD 에 carry 전파 (UW_Add_1 제자리 연산의 carry 없을 때 종료 X), carry 리턴
+static UNWORD GFP_Add_1(UNWORD *r, const UNWORD n, UNWORD c)
+{
+	UNWORD i;
+
+	for(i = 0 ; i < n ; i++)
+		c = UW_Addc(&r[i], r[i], c, 0);
+	return c;
+}
+
+// (c == 1) or (r >= p) -> r - p (c : 0 or 1, borrow 만 먼저 구한 후 p 를 mask 로 선택해서 뺄셈, 분기 X)
+static void GFP_Cond_Sub(UNWORD *r, const UNWORD *p, const UNWORD n, const UNWORD c)
+{
+	UNWORD i, b, m, t;
+
+	for(i = 0, b = 0 ; i < n ; i++)
+		b = UW_Subb(&t, r[i], p[i], b);
+	m = (UNWORD)0 - ((c | (b ^ 1)) & 1);
+	for(i = 0, b = 0 ; i < n ; i++)
+		b = UW_Subb(&r[i], r[i], p[i] & m, b);
+}
+
+#if defined(GFP_SPECIAL)
+// 표준 곡선 소수 (32-bit limb, 하위 limb 부터)
+static const UNINT GFP_P192_32[6] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+static const UNINT GFP_P224_32[7] = { 0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+static const UNINT GFP_P256_32[8] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF };
+static const UNINT GFP_P384_32[12] = { 0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+									   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+static const UNINT GFP_P521_32[17] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+									   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+									   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000001FF };
+static const UNINT GFP_25519_32[8] = { 0xFFFFFFED, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF };
+
+// 리덕션 종류 별 소수 (GFP_Type 순서)
+static const struct
+{
+	const UNINT	*P;		// 소수 (32-bit limb)
+	UNWORD	Limbs;		// limb 개수
+} GFP_Primes[] = {
+	{ NULL, 0 },
+	{ GFP_P192_32, 6 },
+	{ GFP_P224_32, 7 },
+	{ GFP_P256_32, 8 },
+	{ GFP_P384_32, 12 },
+	{ GFP_P521_32, 17 },
+	{ GFP_25519_32, 8 },
+};
+
+#define GFP_TYPES		(sizeof(GFP_Primes) / sizeof(GFP_Primes[0]))
+
+#define GFP_P521_TOP	(521 - (UW_WORDS(521) - 1) * BIT_LEN)		// P-521 최상위 WORD 의 bit 개수
+#define GFP_P521_MASK	(((UNWORD)1 << GFP_P521_TOP) - 1)
+
+// a 의 i 번째 32-bit limb (부호 있는 누산용)
+#if (BIT_LEN == 64)
+#define GFP_C(i)		((SNLONG)(UNINT)(a[(i) >> 1] >> (((i) & 1) << 5)))
+#else
+#define GFP_C(i)		((SNLONG)a[i])
+#endif
+
+// Solinas 누산 : limb 하나 출력 후 부호 있는 carry 를 다음 limb 로 (acc 는 산술 >> 쉬프트)
+#define GFP_PUT(t, j)	{ (t)[j] = (UNINT)acc; acc >>= 32; }
+
+/**
+ * @brief Store 32-bit limbs to UNWORD array
+ * @details
+ * - r[0..n-1] = t[0..k-1] (남는 상위 bit 는 0) \n
+ * @date 2026. 10. 17. \n
+ */
+static void GFP_Store32(UNWORD *r, const UNINT *t, const UNWORD k, const UNWORD n)
+{
+	UNWORD i;
+
+#if (BIT_LEN == 64)
+	for(i = 0 ; i < (k >> 1) ; i++)
+		r[i] = t[2 * i] | ((UNWORD)t[2 * i + 1] << 32);
+	if(k & 1)
+		r[i++] = t[k - 1];
+#else
+	for(i = 0 ; i < k ; i++)
+		r[i] = t[i];
+#endif
+	for( ; i < n ; i++)
+		r[i] = 0;
+}
+
+#if (BIT_LEN == 64)
+// t -= c * p (32-bit limb, c 는 부호 있는 작은 정수), 부호 있는 상위 carry 리턴
+static SNLONG GFP_SubMul32(UNINT *t, const UNINT *p, const UNWORD k, const SNLONG c)
+{
+	UNWORD j;
+	SNLONG acc = 0;
+
+	for(j = 0 ; j < k ; j++)
+	{
+		acc += (SNLONG)t[j] - c * (SNLONG)p[j];
+		GFP_PUT(t, j);
+	}
+	return acc;
+}
+
+#endif
+
+/**
+ * @brief Normalize Solinas sum
+ * @details
+ * - r = t + c * 2^(32k) mod p (c : Solinas 합의 상위 carry, |c| < 8), [0, p) 로 정규화 \n
+ * - WORD 로 저장 후 c * p 를 한 번 빼면 (UW_SubMul_1 / UW_AddMul_1) 2^(32k) - p 가 작아서 상위 carry 는 0 or +-1 \n
+ * - c 의 부호는 곱하는 값을 mask 로 선택 (두 함수 모두 호출, 한 쪽은 0 배), 마지막 조건부 덧셈 / 뺄셈도 mask 로 선택 (분기 X) \n
+ * - carry -1 : 값 >= -8 (2^(32k) - p) -> p 한 번 더하면 [0, p), carry 0 / +1 : 값 < 2p -> p 한 번 빼면 [0, p) \n
+ * - 64-bit WORD 의 P-224 (k 홀수) 는 2^(32k) 가 WORD 경계가 아님 -> limb 단위로 같은 순서 (GFP_SubMul32 의 c 를 mask 로 선택) \n
+ * @param[out] UNWORD *r (UW_WORDS(32k) WORD)
+ * @param[in,out] UNINT *t (k limb)
+ * @param[in] UNINT *p32 (const) 소수 (32-bit limb)
+ * @param[in] UNWORD k (const) limb 개수
+ * @param[in] SNLONG c (const) 상위 carry
+ * @param[in] UNWORD *p (const) 소수 (WORD)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. c 부호 / P-224 while 반복 분기 제거 (고정 횟수 + mask 선택) \n
+ */
+static void GFP_Final32(UNWORD *r, UNINT *t, const UNINT *p32, const UNWORD k, SNLONG c, const UNWORD *p)
+{
+	UNWORD i, b, m, u;
+	UNWORD n = UW_WORDS(32 * k);
+
+#if (BIT_LEN == 64)
+	if(k & 1)
+	{
+		UNINT s[7];
+		SNLONG d;
+
+		c += GFP_SubMul32(t, p32, k, c);
+		c += GFP_SubMul32(t, p32, k, -(SNLONG)(c < 0));		// c < 0 -> t + p
+
+		// c > 0 or t >= p -> t - p
+		for(i = 0 ; i < k ; i++)
+			s[i] = t[i];
+		d = GFP_SubMul32(s, p32, k, 1);					// borrow -> -1
+		m = (UNWORD)0 - (UNWORD)((c > 0) | (d == 0));
+		for(i = 0 ; i < k ; i++)
+			t[i] = (UNINT)((s[i] & m) | (t[i] & ~m));
+		GFP_Store32(r, t, k, n);
+		return;
+	}
+#endif
+	(void)p32;
+	GFP_Store32(r, t, k, n);
+
+	// c > 0 -> r - c * p, c < 0 -> r + |c| * p
+	u = (UNWORD)c;
+	m = (UNWORD)0 - (UNWORD)(c < 0);
+	c -= UW_SubMul_1(r, p, n, u & ~m);
+	c += UW_AddMul_1(r, p, n, ((UNWORD)0 - u) & m);
+
+	// c < 0 -> r + p (한 번 더하면 0 이상)
+	m = (UNWORD)0 - (UNWORD)(c < 0);
+	for(i = 0, b = 0 ; i < n ; i++)
+		b = UW_Addc(&r[i], r[i], p[i] & m, b);
+	c += b;
+
+	// r >= p (or c > 0) -> r - p
+	GFP_Cond_Sub(r, p, n, (UNWORD)(c > 0));
+}
+
+/**
+ * @brief Fast Reduction modulo NIST P-192
+ * @details
+ * - r = a mod p (a : 2n WORD, 32-bit limb c0 ~ c11 = GFP_C(0) ~ GFP_C(11)) \n
+ * - p = 2^192 - 2^64 - 1, r = s1 + s2 + s3 + s4 (64-bit 단위 식을 32-bit limb 로 전개) \n
+ * - Guide to Elliptic Curve Cryptography Algorithm 2.27 참고 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @date 2026. 10. 17. \n
+ */
+static void GFP_Redc_P192(UNWORD *r, const UNWORD *a, const UNWORD *p)
+{
+	UNINT t[6];
+	SNLONG acc = 0;
+
+	acc += GFP_C(0) + GFP_C(6) + GFP_C(10);
+	GFP_PUT(t, 0);
+	acc += GFP_C(1) + GFP_C(7) + GFP_C(11);
+	GFP_PUT(t, 1);
+	acc += GFP_C(2) + GFP_C(6) + GFP_C(8) + GFP_C(10);
+	GFP_PUT(t, 2);
+	acc += GFP_C(3) + GFP_C(7) + GFP_C(9) + GFP_C(11);
+	GFP_PUT(t, 3);
+	acc += GFP_C(4) + GFP_C(8) + GFP_C(10);
+	GFP_PUT(t, 4);
+	acc += GFP_C(5) + GFP_C(9) + GFP_C(11);
+	GFP_PUT(t, 5);
+	GFP_Final32(r, t, GFP_P192_32, 6, acc, p);
+}
+
+/**
+ * @brief Fast Reduction modulo NIST P-224
+ * @details
+ * - r = a mod p (a : 2n WORD, 32-bit limb c0 ~ c13 = GFP_C(0) ~ GFP_C(13)) \n
+ * - p = 2^224 - 2^96 + 1, r = s1 + s2 + s3 - d1 - d2 \n
+ * - Guide to Elliptic Curve Cryptography Algorithm 2.28 참고 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @date 2026. 10. 17. \n
+ */
+static void GFP_Redc_P224(UNWORD *r, const UNWORD *a, const UNWORD *p)
+{
+	UNINT t[7];
+	SNLONG acc = 0;
+
+	acc += GFP_C(0) - GFP_C(7) - GFP_C(11);
+	GFP_PUT(t, 0);
+	acc += GFP_C(1) - GFP_C(8) - GFP_C(12);
+	GFP_PUT(t, 1);
+	acc += GFP_C(2) - GFP_C(9) - GFP_C(13);
+	GFP_PUT(t, 2);
+	acc += GFP_C(3) + GFP_C(7) - GFP_C(10) + GFP_C(11);
+	GFP_PUT(t, 3);
+	acc += GFP_C(4) + GFP_C(8) - GFP_C(11) + GFP_C(12);
+	GFP_PUT(t, 4);
+	acc += GFP_C(5) + GFP_C(9) - GFP_C(12) + GFP_C(13);
+	GFP_PUT(t, 5);
+	acc += GFP_C(6) + GFP_C(10) - GFP_C(13);
+	GFP_PUT(t, 6);
+	GFP_Final32(r, t, GFP_P224_32, 7, acc, p);
+}
+
+/**
+ * @brief Fast Reduction modulo NIST P-256
+ * @details
+ * - r = a mod p (a : 2n WORD, 32-bit limb c0 ~ c15 = GFP_C(0) ~ GFP_C(15)) \n
+ * - p = 2^256 - 2^224 + 2^192 + 2^96 - 1, r = s1 + 2 s2 + 2 s3 + s4 + s5 - d1 - d2 - d3 - d4 \n
+ * - Guide to Elliptic Curve Cryptography Algorithm 2.29 참고 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @date 2026. 10. 17. \n
+ */
+static void GFP_Redc_P256(UNWORD *r, const UNWORD *a, const UNWORD *p)
+{
+	UNINT t[8];
+	SNLONG acc = 0;
+
+	acc += GFP_C(0) + GFP_C(8) + GFP_C(9) - GFP_C(11) - GFP_C(12) - GFP_C(13) - GFP_C(14);
+	GFP_PUT(t, 0);
+	acc += GFP_C(1) + GFP_C(9) + GFP_C(10) - GFP_C(12) - GFP_C(13) - GFP_C(14) - GFP_C(15);
+	GFP_PUT(t, 1);
+	acc += GFP_C(2) + GFP_C(10) + GFP_C(11) - GFP_C(13) - GFP_C(14) - GFP_C(15);
+	GFP_PUT(t, 2);
+	acc += GFP_C(3) - GFP_C(8) - GFP_C(9) + 2 * GFP_C(11) + 2 * GFP_C(12) + GFP_C(13) - GFP_C(15);
+	GFP_PUT(t, 3);
+	acc += GFP_C(4) - GFP_C(9) - GFP_C(10) + 2 * GFP_C(12) + 2 * GFP_C(13) + GFP_C(14);
+	GFP_PUT(t, 4);
+	acc += GFP_C(5) - GFP_C(10) - GFP_C(11) + 2 * GFP_C(13) + 2 * GFP_C(14) + GFP_C(15);
+	GFP_PUT(t, 5);
+	acc += GFP_C(6) - GFP_C(8) - GFP_C(9) + GFP_C(13) + 3 * GFP_C(14) + 2 * GFP_C(15);
+	GFP_PUT(t, 6);
+	acc += GFP_C(7) + GFP_C(8) - GFP_C(10) - GFP_C(11) - GFP_C(12) - GFP_C(13) + 3 * GFP_C(15);
+	GFP_PUT(t, 7);
+	GFP_Final32(r, t, GFP_P256_32, 8, acc, p);
+}
+
+/**
+ * @brief Fast Reduction modulo NIST P-384
+ * @details
+ * - r = a mod p (a : 2n WORD, 32-bit limb c0 ~ c23 = GFP_C(0) ~ GFP_C(23)) \n
+ * - p = 2^384 - 2^128 - 2^96 + 2^32 - 1, r = s1 + 2 s2 + s3 + s4 + s5 + s6 + s7 - d1 - d2 - d3 \n
+ * - Guide to Elliptic Curve Cryptography Algorithm 2.30 참고 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @date 2026. 10. 17. \n
+ */
+static void GFP_Redc_P384(UNWORD *r, const UNWORD *a, const UNWORD *p)
+{
+	UNINT t[12];
+	SNLONG acc = 0;
+
+	acc += GFP_C(0) + GFP_C(12) + GFP_C(20) + GFP_C(21) - GFP_C(23);
+	GFP_PUT(t, 0);
+	acc += GFP_C(1) - GFP_C(12) + GFP_C(13) - GFP_C(20) + GFP_C(22) + GFP_C(23);
+	GFP_PUT(t, 1);
+	acc += GFP_C(2) - GFP_C(13) + GFP_C(14) - GFP_C(21) + GFP_C(23);
+	GFP_PUT(t, 2);
+	acc += GFP_C(3) + GFP_C(12) - GFP_C(14) + GFP_C(15) + GFP_C(20) + GFP_C(21) - GFP_C(22) - GFP_C(23);
+	GFP_PUT(t, 3);
+	acc += GFP_C(4) + GFP_C(12) + GFP_C(13) - GFP_C(15) + GFP_C(16) + GFP_C(20) + 2 * GFP_C(21) + GFP_C(22) - 2 * GFP_C(23);
+	GFP_PUT(t, 4);
+	acc += GFP_C(5) + GFP_C(13) + GFP_C(14) - GFP_C(16) + GFP_C(17) + GFP_C(21) + 2 * GFP_C(22) + GFP_C(23);
+	GFP_PUT(t, 5);
+	acc += GFP_C(6) + GFP_C(14) + GFP_C(15) - GFP_C(17) + GFP_C(18) + GFP_C(22) + 2 * GFP_C(23);
+	GFP_PUT(t, 6);
+	acc += GFP_C(7) + GFP_C(15) + GFP_C(16) - GFP_C(18) + GFP_C(19) + GFP_C(23);
+	GFP_PUT(t, 7);
+	acc += GFP_C(8) + GFP_C(16) + GFP_C(17) - GFP_C(19) + GFP_C(20);
+	GFP_PUT(t, 8);
+	acc += GFP_C(9) + GFP_C(17) + GFP_C(18) - GFP_C(20) + GFP_C(21);
+	GFP_PUT(t, 9);
+	acc += GFP_C(10) + GFP_C(18) + GFP_C(19) - GFP_C(21) + GFP_C(22);
+	GFP_PUT(t, 10);
+	acc += GFP_C(11) + GFP_C(19) + GFP_C(20) - GFP_C(22) + GFP_C(23);
+	GFP_PUT(t, 11);
+	GFP_Final32(r, t, GFP_P384_32, 12, acc, p);
+}
+
+/**
+ * @brief Fast Reduction modulo NIST P-521
+ * @details
+ * - r = a mod p (0 <= a < p^2, 2n WORD) \n
+ * - p = 2^521 - 1 : r = (a mod 2^521) + Floor(a / 2^521) (< 2^522), 522 번째 bit 한 번 더 접기 \n
+ * - 접은 값 <= p, r == p 는 모든 WORD 비교를 OR 로 모은 mask 로 0 선택 (분기 X) \n
+ * - Guide to Elliptic Curve Cryptography Algorithm 2.31 참고 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. r == p 확인 분기 제거 \n
+ */
+static void GFP_Redc_P521(UNWORD *r, const UNWORD *a)
+{
+	UNWORD h[UW_WORDS(521) + 1];
+	UNWORD i, c, d, n = UW_WORDS(521);
+
+	// h = Floor(a / 2^521) (< 2^521)
+	UW_RShift_n(h, a + (n - 1), (n + 1), GFP_P521_TOP);
+
+	// r = (a mod 2^521) + h
+	for(i = 0 ; i < n ; i++)
+		r[i] = a[i];
+	r[n - 1] &= GFP_P521_MASK;
+	UW_Add_n(r, r, h, n);
+
+	// 2^521 이상 bit 접기 (r < 2^522 -> 접은 후 < 2^521)
+	c = r[n - 1] >> GFP_P521_TOP;
+	r[n - 1] &= GFP_P521_MASK;
+	GFP_Add_1(r, n, c);
+
+	// r == p -> 0 (d == 0 <-> r == p)
+	d = r[n - 1] ^ GFP_P521_MASK;
+	for(i = 0 ; i < n - 1 ; i++)
+		d |= r[i] ^ WORD_MASK;
+	d = ((d | ((UNWORD)0 - d)) >> (BIT_LEN - 1)) - 1;
+	for(i = 0 ; i < n ; i++)
+		r[i] &= ~d;
+}
+
+/**
+ * @brief Fast Reduction modulo 2^255 - 19
+ * @details
+ * - r = a mod p (a : 2n WORD) \n
+ * - 2^256 = 38 (mod p) : r = (a mod 2^256) + 38 * Floor(a / 2^256), 넘친 carry 도 38 배로 접기 \n
+ * - 최상위 bit (2^255 = 19) 접은 후 한 번 조건부 뺄셈 (GFP_Cond_Sub, 분기 X) \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *p (const)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. carry 전파 / 조건부 뺄셈 분기 제거 \n
+ */
+static void GFP_Redc_25519(UNWORD *r, const UNWORD *a, const UNWORD *p)
+{
+	UNWORD i, c, n = UW_WORDS(256);
+
+	for(i = 0 ; i < n ; i++)
+		r[i] = a[i];
+	c = UW_AddMul_1(r, a + n, n, 38);
+	c = GFP_Add_1(r, n, c * 38);
+	GFP_Add_1(r, n, c * 38);			// 두 번째 carry 는 r 이 작음 -> 더 넘치지 않음
+
+	c = r[n - 1] >> (BIT_LEN - 1);
+	r[n - 1] &= ~WORD_MASK_MSB;
+	GFP_Add_1(r, n, c * 19);
+
+	GFP_Cond_Sub(r, p, n, 0);
+}
+#endif
+
+/**
+ * @brief Reduction modulo pseudo-Mersenne prime 2^k - c
+ * @details
+ * - r = a mod p (0 <= a < p^2, 2n WORD), 2^k = c (mod p) \n
+ * - r = (a mod 2^k) + c * Floor(a / 2^k) (< (c + 1) 2^k), 2^k 이상 bit 를 한 번 더 c 배로 접기 \n
+ * - 두 번 접은 값 < 2^k + c (c + 1) < 2p (GFP_Init 에서 c^2 + 3c < 2^k 확인) -> 한 번 조건부 뺄셈 (GFP_Cond_Sub, 분기 X) \n
+ * - Floor(a / 2^k) 는 ctx->T + 2n 에 2n - q WORD 기록 (q = Floor(k / BIT_LEN) >= n - 1 -> n + 1 WORD 이하, T 의 4n WORD 범위 내) \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. Floor(a / 2^k) 영역 크기 설명 수정 \n
+ * @date 2026. 10. 18. carry 전파 / 조건부 뺄셈 분기 제거 \n
+ */
+static void GFP_Redc_PM(UNWORD *r, GFP_CTX *ctx)
+{
+	UNWORD i, h1, o, n = ctx->n;
+	UNWORD q = ctx->k >> WORD_SHIFT, s = ctx->k & (BIT_LEN - 1);
+	UNWORD mask = (s == 0) ? WORD_MASK : (((UNWORD)1 << s) - 1);
+	UNWORD *a = ctx->T, *h = ctx->T + 2 * n;
+
+	// h = Floor(a / 2^k) (< 2^k, n WORD)
+	UW_RShift_n(h, a + q, 2 * n - q, s);
+
+	// r = (a mod 2^k) + c * h
+	for(i = 0 ; i < n ; i++)
+		r[i] = a[i];
+	r[n - 1] &= mask;
+	o = UW_AddMul_1(r, h, n, ctx->c);
+
+	// 2^k 이상 (< c + 1) 다시 접기
+	h1 = (s == 0) ? o : ((r[n - 1] >> s) | (o << (BIT_LEN - s)));
+	r[n - 1] &= mask;
+	o = UW_AddMul_1(r, &ctx->c, 1, h1);
+	o = GFP_Add_1(r + 1, n - 1, o);
+
+	// r < 2p
+	GFP_Cond_Sub(r, ctx->P, n, o);
+}
+
+// P = 2^k - c (c : 1 WORD, c^2 + 3c < 2^k) 이면 k, c 설정 후 TRUE
+static SNWORD GFP_Detect_PM(GFP_CTX *ctx, const BIGNUM *P)
+{
+	UNWORD i, n = P->Length;
+	UNWORD k = (n - 1) * BIT_LEN + UW_Bit_Len(P->Num[n - 1]);
+	UNWORD s = k & (BIT_LEN - 1);
+	UNWORD c, top = ~P->Num[n - 1];
+
+	// 2^k - P = (~P mod 2^k) + 1 : 상위 WORD 가 모두 0 이어야 c 가 1 WORD
+	if(s != 0)
+		top &= ((UNWORD)1 << s) - 1;
+	if((n > 1) && (top != 0))
+		return FALSE;
+	for(i = 1 ; i + 1 < n ; i++)
+	{
+		if(P->Num[i] != WORD_MASK)
+			return FALSE;
+	}
+	c = ((n == 1) ? top : ~P->Num[0]) + 1;
+
+	// c < 2^(BIT_LEN - 1) (두 번째 접기의 c + 1 이 1 WORD), c^2 + 3c < 2^k
+	if((c == 0) || (c >> (BIT_LEN - 1)) || (2 * UW_Bit_Len(c) + 2 > k))
+		return FALSE;
+
+	ctx->k = k;
+	ctx->c = c;
+	return TRUE;
+}
+
+// n WORD 고정 길이 입력 : 배열이 n WORD 이상이면 그대로 (Num[Length ~ Top - 1] = 0), 작으면 buf 에 0 채워서 복사
+static const UNWORD *GFP_Arg(const BIGNUM *A, UNWORD *buf, const UNWORD n)
+{
+	UNWORD i;
+
+	if(A->Top >= n)
+		return A->Num;
+	for(i = 0 ; i < A->Length ; i++)
+		buf[i] = A->Num[i];
+	for( ; i < n ; i++)
+		buf[i] = 0;
+	return buf;
+}
+
+// 결과 출력 (R->Num 에 n WORD 쓴 후)
+static void GFP_Out(BIGNUM *R, const UNWORD n)
+{
+	R->Length = n;
+	R->Sign = PLUS;
+	BN_Optimize(R);
+}
+
+/**
+ * @brief Reduce 2n WORD product in ctx->T to BIGNUM *R
+ * @details
+ * - R = T[0..2n-1] mod P, 리덕션 종류 (ctx->Type) 별 분기 \n
+ * - GFP_GENERIC : T 를 가리키는 BIGNUM 으로 BN_Bar_Reduce \n
+ * @param[out] BIGNUM *R
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+static void GFP_Reduce(BIGNUM *R, GFP_CTX *ctx)
+{
+	UNWORD n = ctx->n;
+	BIGNUM t;
+
+	if(ctx->Type == GFP_GENERIC)
+	{
+		t.Num = ctx->T;
+		t.Top = t.Length = 2 * n;
+		t.Sign = PLUS;
+		t.Flag = DEFAULT;
+		t.Alloc = NULL;
+		BN_Optimize(&t);
+		BN_Bar_Reduce(R, &t, &ctx->Bar);
+		return;
+	}
+
+	BN_Result_Size(R, n);
+	switch(ctx->Type)
+	{
+#if defined(GFP_SPECIAL)
+	case GFP_P192:	GFP_Redc_P192(R->Num, ctx->T, ctx->P);				break;
+	case GFP_P224:	GFP_Redc_P224(R->Num, ctx->T, ctx->P);				break;
+	case GFP_P256:	GFP_Redc_P256(R->Num, ctx->T, ctx->P);				break;
+	case GFP_P384:	GFP_Redc_P384(R->Num, ctx->T, ctx->P);				break;
+	case GFP_P521:	GFP_Redc_P521(R->Num, ctx->T);				break;
+	case GFP_25519:	GFP_Redc_25519(R->Num, ctx->T, ctx->P);		break;
+#endif
+	case GFP_PMERSENNE:	GFP_Redc_PM(R->Num, ctx);					break;
+	default:														break;
+	}
+	GFP_Out(R, n);
+}
+
+// 소수 복사, 리덕션 종류 설정, [P | T] 한 번에 할당
+static SNWORD GFP_Setup(GFP_CTX *ctx, const UNWORD *p, const UNWORD n, const SNWORD type)
+{
+	UNWORD i;
+
+	ctx->Type = type;
+	ctx->n = n;
+	ctx->Alloc = UW_Alloc_Get();
+	ctx->P = UW_Mem_Alloc(ctx->Alloc, 5 * n);
+	if(ctx->P == NULL)
+		return FALSE;
+	ctx->T = ctx->P + n;
+	for(i = 0 ; i < n ; i++)
+		ctx->P[i] = p[i];
+
+	return TRUE;
+}
+
+// 빈 context (GFP_Free 가능)
+static void GFP_Clear(GFP_CTX *ctx)
+{
+	ctx->Type = GFP_GENERIC;
+	ctx->n = 0;
+	ctx->P = ctx->T = NULL;
+	ctx->k = ctx->c = 0;
+	ctx->Bar.N = ctx->Bar.Mu = ctx->Bar.T = NULL;
+	ctx->Bar.n = ctx->Bar.Mu_Len = 0;
+	ctx->Alloc = NULL;
+}
+
+/**
+ * @brief Initialize prime field context
+ * @details
+ * - 소수 P (> 1) 가 표준 곡선 소수 (NIST P-192 / 224 / 256 / 384 / 521, 2^255 - 19) 와 같으면 전용 리덕션 선택 \n
+ * - 2^k - c (c 는 작은 1 WORD, ex. secp256k1 2^256 - 2^32 - 977) 형태면 상위 * c 접기 (GFP_PMERSENNE) \n
+ * - 그 외 소수는 Barrett (BN_Bar_Init) \n
+ * @param[out] GFP_CTX *ctx
+ * @param[in] BIGNUM *P (const)
+ * @return TRUE (성공) / FALSE (P <= 1 or 할당 실패)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD GFP_Init(GFP_CTX *ctx, const BIGNUM *P)
+{
+	SNWORD type = GFP_GENERIC;
+	UNWORD n = P->Length;
+#if defined(GFP_SPECIAL)
+	UNWORD i, p[UW_WORDS(544)];
+#endif
+
+	GFP_Clear(ctx);
+	if((P->Sign != PLUS) || (n == 0) || ((n == 1) && (P->Num[0] == 1)))
+		return FALSE;
+
+#if defined(GFP_SPECIAL)
+	for(i = 1 ; i < GFP_TYPES ; i++)
+	{
+		if(UW_WORDS(32 * GFP_Primes[i].Limbs) != n)
+			continue;
+		GFP_Store32(p, GFP_Primes[i].P, GFP_Primes[i].Limbs, n);
+		if(UW_Cmp_n(P->Num, p, n) == EQUAL)
+		{
+			type = (SNWORD)i;
+			break;
+		}
+	}
+#endif
+	if((type == GFP_GENERIC) && (GFP_Detect_PM(ctx, P) == TRUE))
+		type = GFP_PMERSENNE;
+
+	if(GFP_Setup(ctx, P->Num, n, type) != TRUE)
+		return FALSE;
+	if((type == GFP_GENERIC) && (BN_Bar_Init(&ctx->Bar, P) != TRUE))
+	{
+		GFP_Free(ctx);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/**
+ * @brief Initialize prime field context of standard curve
+ * @details
+ * - type : GFP_P192, GFP_P224, GFP_P256, GFP_P384, GFP_P521, GFP_25519 \n
+ * - 소수를 내부 상수로 설정하고 전용 리덕션 선택 \n
+ * @param[out] GFP_CTX *ctx
+ * @param[in] SNWORD type (const)
+ * @return TRUE (성공) / FALSE (지원하지 않는 type or 할당 실패)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD GFP_Init_Curve(GFP_CTX *ctx, const SNWORD type)
+{
+#if defined(GFP_SPECIAL)
+	UNWORD n, p[UW_WORDS(544)];
+#endif
+
+	GFP_Clear(ctx);
+
+#if defined(GFP_SPECIAL)
+	if((type <= GFP_GENERIC) || ((UNWORD)type >= GFP_TYPES))
+		return FALSE;
+
+	n = UW_WORDS(32 * GFP_Primes[type].Limbs);
+	GFP_Store32(p, GFP_Primes[type].P, GFP_Primes[type].Limbs, n);
+	return GFP_Setup(ctx, p, n, type);
+#else
+	(void)type;
+	return FALSE;
+#endif
+}
+
+/**
+ * @brief Free prime field context
+ * @details
+ * - 소수 / 임시 배열 0 초기화 후 해제, Barrett context 해제 \n
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void GFP_Free(GFP_CTX *ctx)
+{
+	UNWORD i;
+
+	if(ctx->P != NULL)
+	{
+		for(i = 0 ; i < 5 * ctx->n ; i++)
+			ctx->P[i] = 0;
+		UW_Mem_Free(ctx->Alloc, ctx->P, 5 * ctx->n);
+	}
+	BN_Bar_Free(&ctx->Bar);
+	GFP_Clear(ctx);
+}
+
+/**
+ * @brief Get prime of prime field context
+ * @param[out] BIGNUM *P
+ * @param[in] GFP_CTX *ctx (const)
+ * @date 2026. 10. 17. \n
+ */
+void GFP_Get_Prime(BIGNUM *P, const GFP_CTX *ctx)
+{
+	UNWORD i;
+
+	BN_Result_Size(P, ctx->n);
+	for(i = 0 ; i < ctx->n ; i++)
+		P->Num[i] = ctx->P[i];
+	GFP_Out(P, ctx->n);
+}
+
+/**
+ * @brief Reduction modulo P
+ * @details
+ * - R = A mod P (0 <= A < P^2, ex. 두 원소의 곱) \n
+ * - 리덕션 종류 (GFP_Init 에서 선택) 별 분기 \n
+ * - R 은 A 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void GFP_Redc(BIGNUM *R, const BIGNUM *A, GFP_CTX *ctx)
+{
+	UNWORD i, n2 = 2 * ctx->n;
+	UNWORD len = (A->Length < n2) ? A->Length : n2;
+
+	for(i = 0 ; i < len ; i++)
+		ctx->T[i] = A->Num[i];
+	for( ; i < n2 ; i++)
+		ctx->T[i] = 0;
+	GFP_Reduce(R, ctx);
+}
+
+/**
+ * @brief Modular Addition in prime field
+ * @details
+ * - R = A + B mod P (0 <= A, B < P) \n
+ * - n WORD 덧셈 후 한 번 조건부 뺄셈 (GFP_Cond_Sub, 분기 X) \n
+ * - R 은 A, B 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 조건부 뺄셈 분기 제거 \n
+ */
+void GFP_Add(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, GFP_CTX *ctx)
+{
+	UNWORD n = ctx->n;
+	const UNWORD *a, *b;
+
+	BN_Result_Size(R, n);	// R == A or B 인 경우 A, B 도 n WORD 이상
+	a = GFP_Arg(A, ctx->T + 2 * n, n);
+	b = GFP_Arg(B, ctx->T + 3 * n, n);
+	GFP_Cond_Sub(R->Num, ctx->P, n, UW_Add_n(R->Num, a, b, n));
+	GFP_Out(R, n);
+}
+
+/**
+ * @brief Modular Subtraction in prime field
+ * @details
+ * - R = A - B mod P (0 <= A, B < P) \n
+ * - n WORD 뺄셈 후 borrow 가 있으면 P 더하기 (P 를 borrow mask 로 선택해서 항상 덧셈, 분기 X) \n
+ * - R 은 A, B 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. borrow 분기 제거 \n
+ */
+void GFP_Sub(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, GFP_CTX *ctx)
+{
+	UNWORD i, c, m, n = ctx->n;
+	const UNWORD *a, *b;
+
+	BN_Result_Size(R, n);
+	a = GFP_Arg(A, ctx->T + 2 * n, n);
+	b = GFP_Arg(B, ctx->T + 3 * n, n);
+	m = (UNWORD)0 - UW_Sub_n(R->Num, a, b, n);
+	for(i = 0, c = 0 ; i < n ; i++)
+		c = UW_Addc(&R->Num[i], R->Num[i], ctx->P[i] & m, c);
+	GFP_Out(R, n);
+}
+
+/**
+ * @brief Modular Multiplication in prime field
+ * @details
+ * - R = A * B mod P (0 <= A, B < P) \n
+ * - n WORD 고정 길이 곱셈 (UW_Fixed_Mul, 그 외 UW_Base_Mul) 후 리덕션 \n
+ * - 임시 값은 ctx->T 사용 (할당 X) \n
+ * - R 은 A, B 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in] BIGNUM *B (const)
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void GFP_Mul(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, GFP_CTX *ctx)
+{
+	UNWORD n = ctx->n;
+	const UNWORD *a, *b;
+
+	BN_Result_Size(R, n);
+	a = GFP_Arg(A, ctx->T + 2 * n, n);
+	b = GFP_Arg(B, ctx->T + 3 * n, n);
+	if(UW_Fixed_Mul(ctx->T, a, b, n) != TRUE)
+		UW_Base_Mul(ctx->T, a, n, b, n);
+	GFP_Reduce(R, ctx);
+}
+
+/**
+ * @brief Modular Squaring in prime field
+ * @details
+ * - R = A^2 mod P (0 <= A < P) \n
+ * - n WORD 고정 길이 제곱 (UW_Fixed_Sqr, 그 외 UW_Base_Sqr) 후 리덕션 \n
+ * - R 은 A 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A (const)
+ * @param[in,out] GFP_CTX *ctx
+ * @date 2026. 10. 17. \n
+ */
+void GFP_Sqr(BIGNUM *R, const BIGNUM *A, GFP_CTX *ctx)
+{
+	UNWORD n = ctx->n;
+	const UNWORD *a;
+
+	BN_Result_Size(R, n);
+	a = GFP_Arg(A, ctx->T + 2 * n, n);
+	if(UW_Fixed_Sqr(ctx->T, a, n) != TRUE)
+		UW_Base_Sqr(ctx->T, a, n);
+	GFP_Reduce(R, ctx);
+}
@@ -0,0 +1,56 @@
+#ifndef _GFP_H_
+#define _GFP_H_
+
+#include "config.h"
+#include "bignum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 소수체 리덕션 종류 (GFP_CTX Type)
+// - 표준 곡선 소수는 WORD 단위 덧셈 / 뺄셈만으로 리덕션 (Solinas), 2^k - c 형태는 상위 * c 접기, 그 외는 Barrett (BN_BAR)
+#define GFP_GENERIC		0		// 일반 소수 (Barrett)
+#define GFP_P192		1		// NIST P-192 : 2^192 - 2^64 - 1
+#define GFP_P224		2		// NIST P-224 : 2^224 - 2^96 + 1
+#define GFP_P256		3		// NIST P-256 : 2^256 - 2^224 + 2^192 + 2^96 - 1
+#define GFP_P384		4		// NIST P-384 : 2^384 - 2^128 - 2^96 + 2^32 - 1
+#define GFP_P521		5		// NIST P-521 : 2^521 - 1
+#define GFP_25519		6		// Curve25519 : 2^255 - 19
+#define GFP_PMERSENNE	7		// pseudo-Mersenne : 2^k - c (c 는 작은 1 WORD, ex. secp256k1), GFP_Init 에서 자동 선택
+
+// 표준 곡선 소수 리덕션은 32-bit limb 단위 (WORD 는 32-bit limb 의 배수)
+#if (BIT_LEN == 32) || (BIT_LEN == 64)
+#define GFP_SPECIAL
+#endif
+
+// 소수체 context : 소수 마다 한 번 생성 (리덕션 종류 선택 + 임시 배열), 연산은 n WORD 고정 길이, 할당 X
+// - 임시 배열을 context 에 두므로 스레드 마다 context 하나 사용
+typedef struct _GFP_CTX
+{
+	SNWORD	Type;		// 리덕션 종류 (GFP_GENERIC, GFP_P192, ...)
+	UNWORD	n;			// 소수 WORD 개수
+	UNWORD	*P;			// 소수 (n WORD)
+	UNWORD	*T;			// 임시 배열 (곱셈 결과 2n + 고정 길이 입력 2 개 n, n)
+	UNWORD	k;			// GFP_PMERSENNE : P = 2^k - c
+	UNWORD	c;
+	BN_BAR	Bar;		// GFP_GENERIC 리덕션 context
+	const UW_ALLOC *Alloc;	// P / T 할당자 (한 번에 할당)
+} GFP_CTX;
+
+SNWORD GFP_Init(GFP_CTX *ctx, const BIGNUM *P);
+SNWORD GFP_Init_Curve(GFP_CTX *ctx, const SNWORD type);
+void GFP_Free(GFP_CTX *ctx);
+void GFP_Get_Prime(BIGNUM *P, const GFP_CTX *ctx);
+
+void GFP_Redc(BIGNUM *R, const BIGNUM *A, GFP_CTX *ctx);
+void GFP_Add(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, GFP_CTX *ctx);
+void GFP_Sub(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, GFP_CTX *ctx);
+void GFP_Mul(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, GFP_CTX *ctx);
+void GFP_Sqr(BIGNUM *R, const BIGNUM *A, GFP_CTX *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
@@ -0,0 +1,240 @@
+/**
+ * @file intrin.h
+ * @brief WORD 단위 bit / carry 명령 (intrinsics)
+ * @details
+ * - clz, ctz, popcount, bswap : 컴파일러 builtin (lzcnt / tzcnt / popcnt / bswap), 그 외 이식 가능한 C 코드
+ * - add-with-carry, sub-with-borrow : Clang __builtin_addcll / __builtin_subcll, 2 WORD 타입 (UDWORD, GCC 는 adc / sbb 생성), 그 외 비교 연산
+ * - 차수 (GF2N_Deg), 최상위 bit (UW_BitSearch), 덧셈 / 뺄셈 carry 는 모두 이 함수 사용
+ * - 호출 위치에 inline (static inline, 함수 호출 비용 없음)
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#ifndef _INTRIN_H_
+#define _INTRIN_H_
+
+#include "config.h"
+
+// Clang carry builtin (GCC 12 의 _addcarry_u64 는 반복문에서 UDWORD 덧셈보다 느림 -> UDWORD 사용)
+#if (BIT_LEN == 64) && defined(__clang__) && defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+#define UW_BUILTIN_CARRY
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Count Leading Zeros of UNWORD a
+ * @details
+ * - 최상위 bit 부터 연속된 0 bit 개수 (a == 0 이면 BIT_LEN) \n
+ * - GCC / Clang 은 __builtin_clz (lzcnt / bsr 1 명령), 그 외는 반 WORD 씩 이진 탐색 \n
+ * @param[in] UNWORD a (const)
+ * @return UNWORD 0 bit 개수
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Clz(const UNWORD a)
+{
+#if defined(__GNUC__) && (BIT_LEN == 64)
+	return (a == 0) ? BIT_LEN : (UNWORD)__builtin_clzll(a);
+#elif defined(__GNUC__)
+	// BIT_LEN < 32 은 unsigned int 로 확장된 상위 bit 제외
+	return (a == 0) ? BIT_LEN : (UNWORD)(__builtin_clz(a) - (32 - BIT_LEN));
+#else
+	UNWORD n = 0, h = BIT_LEN >> 1;
+	UNWORD x = a;
+
+	if(x == 0)
+		return BIT_LEN;
+	for( ; h != 0 ; h >>= 1)
+	{
+		if((x >> (BIT_LEN - h)) == 0)
+		{
+			n += h;
+			x <<= h;
+		}
+	}
+	return n;
+#endif
+}
+
+/**
+ * @brief Count Trailing Zeros of UNWORD a
+ * @details
+ * - 최하위 bit 부터 연속된 0 bit 개수 (a == 0 이면 BIT_LEN) \n
+ * - GCC / Clang 은 __builtin_ctz (tzcnt / bsf 1 명령), 그 외는 반 WORD 씩 이진 탐색 \n
+ * @param[in] UNWORD a (const)
+ * @return UNWORD 0 bit 개수
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Ctz(const UNWORD a)
+{
+#if defined(__GNUC__) && (BIT_LEN == 64)
+	return (a == 0) ? BIT_LEN : (UNWORD)__builtin_ctzll(a);
+#elif defined(__GNUC__)
+	return (a == 0) ? BIT_LEN : (UNWORD)__builtin_ctz(a);
+#else
+	UNWORD n = 0, h = BIT_LEN >> 1;
+	UNWORD x = a;
+
+	if(x == 0)
+		return BIT_LEN;
+	for( ; h != 0 ; h >>= 1)
+	{
+		if((UNWORD)(x << (BIT_LEN - h)) == 0)
+		{
+			n += h;
+			x >>= h;
+		}
+	}
+	return n;
+#endif
+}
+
+/**
+ * @brief Bit length of UNWORD a
+ * @details
+ * - 최상위 1 bit 위치 + 1 (a == 0 이면 0), 차수 / 최상위 bit 계산 \n
+ * @param[in] UNWORD a (const)
+ * @return UNWORD bit 길이
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Bit_Len(const UNWORD a)
+{
+	return BIT_LEN - UW_Clz(a);
+}
+
+/**
+ * @brief Population count of UNWORD a
+ * @details
+ * - 1 bit 개수 \n
+ * - GCC / Clang 은 __builtin_popcount (-mpopcnt 인 경우 popcnt 1 명령), 그 외는 최하위 1 bit 제거 반복 \n
+ * @param[in] UNWORD a (const)
+ * @return UNWORD 1 bit 개수
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Popcnt(const UNWORD a)
+{
+#if defined(__GNUC__) && (BIT_LEN == 64)
+	return (UNWORD)__builtin_popcountll(a);
+#elif defined(__GNUC__)
+	return (UNWORD)__builtin_popcount(a);
+#else
+	UNWORD n = 0;
+	UNWORD x = a;
+
+	// 최하위 1 bit 제거 반복 (1 bit 개수 만큼)
+	for( ; x != 0 ; n++)
+		x &= x - 1;
+	return n;
+#endif
+}
+
+/**
+ * @brief Byte swap of UNWORD a
+ * @details
+ * - byte 순서 반대 (big endian <-> little endian) \n
+ * - GCC / Clang 은 __builtin_bswap (bswap 1 명령, load / store 와 합쳐서 movbe), 그 외는 byte 단위 이동 \n
+ * @param[in] UNWORD a (const)
+ * @return UNWORD byte 순서 반대 값
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Bswap(const UNWORD a)
+{
+#if defined(__GNUC__) && (BIT_LEN == 64)
+	return (UNWORD)__builtin_bswap64(a);
+#elif defined(__GNUC__) && (BIT_LEN == 32)
+	return (UNWORD)__builtin_bswap32(a);
+#elif (BIT_LEN == 8)
+	return a;
+#else
+	UNWORD i, r = 0, x = a;
+
+	for(i = 0 ; i < (BIT_LEN >> 3) ; i++)
+	{
+		r = (UNWORD)((r << 8) | (x & 0xFF));
+		x = (UNWORD)(x >> 8);
+	}
+	return r;
+#endif
+}
+
+/**
+ * @brief Add with carry
+ * @details
+ * - *r = a + b + c (mod 2^BIT_LEN), carry 리턴 \n
+ * - c 는 0 or 1 \n
+ * - Clang : __builtin_addcll, UDWORD : 2 WORD 덧셈 (adc), 그 외 비교 2 번 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD a (const)
+ * @param[in] UNWORD b (const)
+ * @param[in] UNWORD c (const) carry in
+ * @return UNWORD carry out (1 or 0)
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Addc(UNWORD *r, const UNWORD a, const UNWORD b, const UNWORD c)
+{
+#if defined(UW_BUILTIN_CARRY)
+	unsigned long long o;
+
+	*r = __builtin_addcll(a, b, c, &o);
+	return o;
+#elif defined(UDWORD)
+	UDWORD t = (UDWORD)a + b + c;
+
+	*r = (UNWORD)t;
+	return (UNWORD)(t >> BIT_LEN);
+#else
+	UNWORD t = a + c;
+	UNWORD o = (t < c);
+
+	t += b;
+	o += (t < b);
+	*r = t;
+	return o;
+#endif
+}
+
+/**
+ * @brief Subtract with borrow
+ * @details
+ * - *r = a - b - c (mod 2^BIT_LEN), borrow 리턴 \n
+ * - c 는 0 or 1 \n
+ * - Clang : __builtin_subcll, UDWORD : 2 WORD 뺄셈 (sbb), 그 외 비교 2 번 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD a (const)
+ * @param[in] UNWORD b (const)
+ * @param[in] UNWORD c (const) borrow in
+ * @return UNWORD borrow out (1 or 0)
+ * @date 2026. 10. 17. \n
+ */
+static inline UNWORD UW_Subb(UNWORD *r, const UNWORD a, const UNWORD b, const UNWORD c)
+{
+#if defined(UW_BUILTIN_CARRY)
+	unsigned long long o;
+
+	*r = __builtin_subcll(a, b, c, &o);
+	return o;
+#elif defined(UDWORD)
+	UDWORD t = (UDWORD)a - b - c;
+
+	*r = (UNWORD)t;
+	return (UNWORD)(t >> BIT_LEN) & 1;
+#else
+	UNWORD t = a - c;
+	UNWORD o = (t > a);
+
+	o += (t < b);
+	*r = t - b;
+	return o;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
@@ -0,0 +1,462 @@
+/**
+ * @file ntt.c
+ * @brief Number Theoretic Transform 곱셈
+ * @details
+ * - 3-prime NTT (p = c * 2^50 + 1, 62-bit) 곱셈, 제곱
+ * - 각 소수에서 WORD 배열 합성곱 후 CRT (Garner) 로 복원
+ * - 모듈러 곱셈 : Montgomery (R = 2^64)
+ * - 변환 : 재귀 (depth-first) + NTT_BLOCK 이하는 반복문 -> 캐시 블록 단위 처리
+ * - WORD (32 or 64-bit) 하나를 계수 하나로 사용, 합성곱 값 < N * W^2 < p1 p2 p3 (N < 2^57)
+ * - 병렬 모드 (UW_Pool_Init) : 소수 3 개의 합성곱, 재귀 변환의 두 절반을 worker pool 에 분배
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include "config.h"
+#include "ntt.h"
+#include "pool.h"
+
+#if defined(UW_NTT)
+
+typedef unsigned __int128 NTT_U128;
+
+// NTT 소수와 원시근 (p - 1 = c * 2^50, 변환 길이 최대 2^50)
+static const UNLONG NTT_P[3] = {0x3FDC000000000001ULL, 0x3F18000000000001ULL, 0x3EC4000000000001ULL};
+static const UNLONG NTT_G[3] = {3, 10, 37};
+
+// 소수 하나에 대한 Montgomery 상수
+typedef struct _NTT_MOD
+{
+	UNLONG	p;			// 소수
+	UNLONG	pinv;		// -p^(-1) mod 2^64
+	UNLONG	r2;			// R^2 mod p
+} NTT_MOD;
+
+static void NTT_Mod_Init(NTT_MOD *m, const UNLONG p)
+{
+	UNLONG i, inv = p;
+	UNLONG r = (UNLONG)((((NTT_U128)1) << 64) % p);
+
+	// p^(-1) mod 2^64 (Newton)
+	for(i = 0 ; i < 5 ; i++)
+		inv *= 2 - p * inv;
+
+	m->p = p;
+	m->pinv = (UNLONG)0 - inv;
+	m->r2 = (UNLONG)(((NTT_U128)r * r) % p);
+}
+
+// Montgomery 곱셈 : a * b * R^(-1) mod p (a, b < p < 2^63)
+static inline UNLONG NTT_Mul(const NTT_MOD *m, const UNLONG a, const UNLONG b)
+{
+	NTT_U128 t = (NTT_U128)a * b;
+	UNLONG q = (UNLONG)t * m->pinv;
+	UNLONG u = (UNLONG)((t + (NTT_U128)q * m->p) >> 64);
+
+	return (u >= m->p) ? (u - m->p) : u;
+}
+
+static inline UNLONG NTT_Add(const UNLONG p, const UNLONG a, const UNLONG b)
+{
+	UNLONG t = a + b;
+
+	return (t >= p) ? (t - p) : t;
+}
+
+static inline UNLONG NTT_Sub(const UNLONG p, const UNLONG a, const UNLONG b)
+{
+	return (a >= b) ? (a - b) : (a + p - b);
+}
+
+// Montgomery 형식 변환 : a * R mod p
+static inline UNLONG NTT_To_Mont(const NTT_MOD *m, const UNLONG a)
+{
+	return NTT_Mul(m, a, m->r2);
+}
+
+// a^e mod p (a : Montgomery 형식, 결과 : Montgomery 형식)
+static UNLONG NTT_Pow(const NTT_MOD *m, UNLONG a, UNLONG e)
+{
+	UNLONG r = NTT_To_Mont(m, 1);
+
+	while(e)
+	{
+		if(e & 1)
+			r = NTT_Mul(m, r, a);
+		a = NTT_Mul(m, a, a);
+		e >>= 1;
+	}
+	return r;
+}
+
+/**
+ * @brief Root table of NTT
+ * @details
+ * - w[h + j] = (w_2h)^j (j < h, h = 1, 2, 4, ..., n/2), Montgomery 형식 \n
+ * - 단계별 twiddle 이 연속된 메모리에 위치 (stride 접근 없음) \n
+ * - inv != 0 이면 역원 원시근 사용 (역변환) \n
+ * @date 2026. 10. 17. \n
+ */
+static void NTT_Roots(const NTT_MOD *m, const UNLONG g, UNLONG *w, const UNLONG n, const SNWORD inv)
+{
+	UNLONG h, j;
+	UNLONG wn = NTT_Pow(m, NTT_To_Mont(m, g), (m->p - 1) / n);	// n 차 원시근
+
+	if(inv)
+		wn = NTT_Pow(m, wn, m->p - 2);
+
+	h = n >> 1;
+	w[h] = NTT_To_Mont(m, 1);
+	for(j = 1 ; j < h ; j++)
+		w[h + j] = NTT_Mul(m, w[h + j - 1], wn);
+	for(h >>= 1 ; h > 0 ; h >>= 1)
+		for(j = 0 ; j < h ; j++)
+			w[h + j] = w[(h << 1) + (j << 1)];
+}
+
+static void NTT_Forward(const NTT_MOD *m, UNLONG *x, const UNLONG n, const UNLONG *w);
+static void NTT_Inverse(const NTT_MOD *m, UNLONG *x, const UNLONG n, const UNLONG *w);
+
+// 병렬 변환 작업 (재귀 변환의 절반)
+typedef struct _NTT_HALF
+{
+	const NTT_MOD	*m;
+	UNLONG			*x;
+	UNLONG			n;
+	const UNLONG	*w;
+	SNWORD			inv;
+} NTT_HALF;
+
+static void NTT_Half_Task(void *arg)
+{
+	NTT_HALF *p = (NTT_HALF *)arg;
+
+	if(p->inv)
+		NTT_Inverse(p->m, p->x, p->n, p->w);
+	else
+		NTT_Forward(p->m, p->x, p->n, p->w);
+}
+
+// 길이 h 인 두 절반 x[0..h-1], x[h..2h-1] 변환 (병렬 모드이면 동시 수행)
+static void NTT_Halves(const NTT_MOD *m, UNLONG *x, const UNLONG h, const UNLONG *w, const SNWORD inv)
+{
+	NTT_HALF p[2] = {{m, x, h, w, inv}, {m, x + h, h, w, inv}};
+	UW_TASK task[2];
+
+	if(UW_Pool_Use((UNWORD)h) == FALSE)
+	{
+		NTT_Half_Task(&p[0]);
+		NTT_Half_Task(&p[1]);
+		return;
+	}
+	task[0].Func = NTT_Half_Task;
+	task[0].Arg = &p[0];
+	task[1].Func = NTT_Half_Task;
+	task[1].Arg = &p[1];
+	UW_Pool_Run(task, 2);
+}
+
+/**
+ * @brief Forward NTT (Decimation In Frequency)
+ * @details
+ * - 입력 : 자연 순서, 출력 : bit-reversed 순서 (역변환이 bit-reversed 입력을 받으므로 재배열 없음) \n
+ * - 길이 > NTT_BLOCK : 한 단계 butterfly 후 절반씩 재귀 (depth-first -> 하위 단계는 캐시 안에서 수행) \n
+ * - 두 절반은 서로 독립 (병렬 모드이면 NTT_Halves 에서 동시 수행) \n
+ * - 길이 <= NTT_BLOCK : 모든 단계를 반복문으로 수행 \n
+ * @date 2026. 10. 17. \n
+ */
+static void NTT_Forward(const NTT_MOD *m, UNLONG *x, const UNLONG n, const UNLONG *w)
+{
+	UNLONG h, i, j, u, v;
+	UNLONG p = m->p;
+
+	if(n > NTT_BLOCK)
+	{
+		h = n >> 1;
+		for(j = 0 ; j < h ; j++)
+		{
+			u = x[j];
+			v = x[j + h];
+			x[j] = NTT_Add(p, u, v);
+			x[j + h] = NTT_Mul(m, NTT_Sub(p, u, v), w[h + j]);
+		}
+		NTT_Halves(m, x, h, w, 0);
+		return;
+	}
+
+	for(h = n >> 1 ; h > 0 ; h >>= 1)
+		for(i = 0 ; i < n ; i += (h << 1))
+			for(j = 0 ; j < h ; j++)
+			{
+				u = x[i + j];
+				v = x[i + j + h];
+				x[i + j] = NTT_Add(p, u, v);
+				x[i + j + h] = NTT_Mul(m, NTT_Sub(p, u, v), w[h + j]);
+			}
+}
+
+/**
+ * @brief Inverse NTT (Decimation In Time, 1/n 곱셈 제외)
+ * @details
+ * - 입력 : bit-reversed 순서, 출력 : 자연 순서 \n
+ * - NTT_Forward 와 같은 방식으로 캐시 블록 단위 처리 \n
+ * @date 2026. 10. 17. \n
+ */
+static void NTT_Inverse(const NTT_MOD *m, UNLONG *x, const UNLONG n, const UNLONG *w)
+{
+	UNLONG h, i, j, u, v;
+	UNLONG p = m->p;
+
+	if(n > NTT_BLOCK)
+	{
+		h = n >> 1;
+		NTT_Halves(m, x, h, w, 1);
+		for(j = 0 ; j < h ; j++)
+		{
+			u = x[j];
+			v = NTT_Mul(m, x[j + h], w[h + j]);
+			x[j] = NTT_Add(p, u, v);
+			x[j + h] = NTT_Sub(p, u, v);
+		}
+		return;
+	}
+
+	for(h = 1 ; h < n ; h <<= 1)
+		for(i = 0 ; i < n ; i += (h << 1))
+			for(j = 0 ; j < h ; j++)
+			{
+				u = x[i + j];
+				v = NTT_Mul(m, x[i + j + h], w[h + j]);
+				x[i + j] = NTT_Add(p, u, v);
+				x[i + j + h] = NTT_Sub(p, u, v);
+			}
+}
+
+// x[0..n-1] = a[0..na-1] mod p (상위 0 채움)
+static void NTT_Load(const NTT_MOD *m, UNLONG *x, const UNLONG n, const UNWORD *a, const UNWORD na)
+{
+	UNLONG i;
+
+	for(i = 0 ; i < na ; i++)
+		x[i] = (UNLONG)a[i] % m->p;
+	for( ; i < n ; i++)
+		x[i] = 0;
+}
+
+// 변환 길이 : 2^k >= rn - 1 (합성곱 계수 개수)
+static UNLONG NTT_Length(const UNWORD rn)
+{
+	UNLONG n = 2;
+
+	while(n < (UNLONG)rn - 1)
+		n <<= 1;
+	return n;
+}
+
+/**
+ * @brief Convolution of A and B modulo NTT prime
+ * @details
+ * - x[0..n-1] = a * b (합성곱) mod p \n
+ * - b == NULL 이면 제곱 (변환 한 번) \n
+ * - y : 임시 배열 n (b 변환), w : 임시 배열 n (twiddle) \n
+ * @date 2026. 10. 17. \n
+ */
+static void NTT_Conv(const SNWORD k, UNLONG *x, const UNLONG n, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNLONG *y, UNLONG *w)
+{
+	NTT_MOD m;
+	UNLONG i, c;
+
+	NTT_Mod_Init(&m, NTT_P[k]);
+
+	// 점별 곱 후 역변환 결과 = a * b * n : c = n^(-1) R^2 를 곱해서 보정 (Montgomery 곱 2 번의 R^(-2) 상쇄)
+	c = NTT_Pow(&m, NTT_To_Mont(&m, n % m.p), m.p - 2);	// n^(-1) R
+	c = NTT_Mul(&m, c, m.r2);							// n^(-1) R^2
+
+	NTT_Roots(&m, NTT_G[k], w, n, 0);
+	NTT_Load(&m, x, n, a, na);
+	NTT_Forward(&m, x, n, w);
+	if(b != NULL)
+	{
+		NTT_Load(&m, y, n, b, nb);
+		NTT_Forward(&m, y, n, w);
+		for(i = 0 ; i < n ; i++)
+			x[i] = NTT_Mul(&m, NTT_Mul(&m, x[i], y[i]), c);
+	}
+	else
+	{
+		for(i = 0 ; i < n ; i++)
+			x[i] = NTT_Mul(&m, NTT_Mul(&m, x[i], x[i]), c);
+	}
+
+	NTT_Roots(&m, NTT_G[k], w, n, 1);
+	NTT_Inverse(&m, x, n, w);
+}
+
+// 병렬 합성곱 작업 (소수 하나), y == NULL 이면 작업 안에서 임시 배열 할당
+typedef struct _NTT_CONV
+{
+	SNWORD			k;
+	UNLONG			*x;
+	UNLONG			n;
+	const UNWORD	*a;
+	UNWORD			na;
+	const UNWORD	*b;
+	UNWORD			nb;
+	UNLONG			*y;
+} NTT_CONV;
+
+static void NTT_Conv_Task(void *arg)
+{
+	NTT_CONV *p = (NTT_CONV *)arg;
+	UNLONG *y = p->y;
+
+	if(y == NULL)
+		y = (UNLONG *)malloc((p->n << 1) * sizeof(UNLONG));
+	NTT_Conv(p->k, p->x, p->n, p->a, p->na, p->b, p->nb, y, y + p->n);
+	if(p->y == NULL)
+		free(y);
+}
+
+// 소수 3 개의 합성곱 : t[kn..(k+1)n-1] (k = 0, 1, 2), 병렬 모드이면 동시 수행
+static void NTT_Conv3(UNLONG *t, const UNLONG n, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb)
+{
+	NTT_CONV p[3] = {
+		{0, t, n, a, na, b, nb, t + 3 * n},
+		{1, t + n, n, a, na, b, nb, NULL},
+		{2, t + 2 * n, n, a, na, b, nb, NULL}
+	};
+	UW_TASK task[3];
+	SNWORD k;
+
+	if(UW_Pool_Use((UNWORD)n) == FALSE)
+	{
+		for(k = 0 ; k < 3 ; k++)
+			NTT_Conv(k, t + k * n, n, a, na, b, nb, t + 3 * n, t + 4 * n);
+		return;
+	}
+	for(k = 0 ; k < 3 ; k++)
+	{
+		task[k].Func = NTT_Conv_Task;
+		task[k].Arg = &p[k];
+	}
+	UW_Pool_Run(task, 3);
+}
+
+/**
+ * @brief CRT (Garner) of 3 residues and carry propagation
+ * @details
+ * - 계수 i : x = r1 + p1 v2 + p1 p2 v3 (< 2^186, 64-bit 3 개) \n
+ * - r[i] = (누적값 + x) 의 하위 WORD, 나머지는 다음 계수로 carry \n
+ * @date 2026. 10. 17. \n
+ */
+static void NTT_CRT(UNWORD *r, const UNWORD rn, const UNLONG *x1, const UNLONG *x2, const UNLONG *x3)
+{
+	NTT_MOD m2, m3;
+	NTT_U128 t, p12;
+	UNLONG i12, i123, p1m3, s, v2, v3, y1;
+	UNLONG a0 = 0, a1 = 0, a2 = 0;			// 누적값 (192-bit)
+	UNLONG p1 = NTT_P[0];
+	UNWORD i;
+
+	NTT_Mod_Init(&m2, NTT_P[1]);
+	NTT_Mod_Init(&m3, NTT_P[2]);
+
+	// 상수 (Montgomery 형식) : p1^(-1) mod p2, (p1 p2)^(-1) mod p3, p1 mod p3
+	i12 = NTT_Pow(&m2, NTT_To_Mont(&m2, p1 % m2.p), m2.p - 2);
+	p1m3 = NTT_To_Mont(&m3, p1 % m3.p);
+	i123 = NTT_Pow(&m3, NTT_Mul(&m3, p1m3, NTT_To_Mont(&m3, NTT_P[1] % m3.p)), m3.p - 2);
+	p12 = (NTT_U128)p1 * NTT_P[1];
+
+	for(i = 0 ; i < rn ; i++)
+	{
+		if(i < rn - 1)
+		{
+			// v2 = (r2 - r1) p1^(-1) mod p2
+			y1 = (x1[i] >= m2.p) ? (x1[i] - m2.p) : x1[i];
+			v2 = NTT_Mul(&m2, NTT_Sub(m2.p, x2[i], y1), i12);
+			// v3 = (r3 - r1 - p1 v2) (p1 p2)^(-1) mod p3
+			y1 = (x1[i] >= m3.p) ? (x1[i] - m3.p) : x1[i];	// p1 < 2 p3
+			s = NTT_Mul(&m3, (v2 >= m3.p) ? (v2 - m3.p) : v2, p1m3);
+			v3 = NTT_Mul(&m3, NTT_Sub(m3.p, NTT_Sub(m3.p, x3[i], y1), s), i123);
+
+			// 누적값 += r1 + p1 v2 + p1 p2 v3
+			t = (NTT_U128)p1 * v2 + (NTT_U128)(UNLONG)p12 * v3 + x1[i] + a0;	// < 2^127
+			a0 = (UNLONG)t;
+			t = (t >> 64) + (NTT_U128)(UNLONG)(p12 >> 64) * v3 + a1;
+			a1 = (UNLONG)t;
+			a2 += (UNLONG)(t >> 64);
+		}
+
+		r[i] = (UNWORD)a0;
+#if (BIT_LEN == 64)
+		a0 = a1;
+		a1 = a2;
+		a2 = 0;
+#else
+		a0 = (a0 >> BIT_LEN) | (a1 << (64 - BIT_LEN));
+		a1 = (a1 >> BIT_LEN) | (a2 << (64 - BIT_LEN));
+		a2 >>= BIT_LEN;
+#endif
+	}
+}
+
+/**
+ * @brief Scratch size of UW_NTT_Mul / UW_NTT_Sqr
+ * @details
+ * - 결과 길이 rn (= na + nb) WORD 인 곱셈에 필요한 임시 배열 크기 (64-bit 원소 개수) \n
+ * - 변환 길이 n : 소수별 결과 3n + b 변환 n + twiddle n \n
+ * @param[in] UNWORD rn (const)
+ * @return UNWORD 임시 배열 UNLONG 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_NTT_Scratch_Size(const UNWORD rn)
+{
+	return (UNWORD)(5 * NTT_Length(rn));
+}
+
+/**
+ * @brief NTT Multiplication of UNWORD array A and B
+ * @details
+ * - r[0..na+nb-1] = a[0..na-1] * b[0..nb-1] \n
+ * - 3 개 소수에서 각각 NTT 합성곱 후 CRT 복원 \n
+ * - 병렬 모드 : 소수별 합성곱 동시 수행 (소수 2, 3 은 작업별 임시 배열 할당) \n
+ * - 임시 배열 t 는 호출하는 쪽에서 UW_NTT_Scratch_Size(na + nb) 개 UNLONG 할당 \n
+ * - r 은 a, b 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const) (>= 1)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const) (>= 1)
+ * @param[in] UNLONG *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_NTT_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNLONG *t)
+{
+	UNLONG n = NTT_Length(na + nb);
+
+	NTT_Conv3(t, n, a, na, b, nb);
+	NTT_CRT(r, na + nb, t, t + n, t + 2 * n);
+}
+
+/**
+ * @brief NTT Square of UNWORD array A
+ * @details
+ * - r[0..2n-1] = (a[0..n-1])^2, 소수마다 변환 한 번 \n
+ * - 임시 배열 t 는 호출하는 쪽에서 UW_NTT_Scratch_Size(2n) 개 UNLONG 할당 \n
+ * - r 은 a 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) (>= 1)
+ * @param[in] UNLONG *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_NTT_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNLONG *t)
+{
+	UNLONG l = NTT_Length(n << 1);
+
+	NTT_Conv3(t, l, a, n, NULL, 0);
+	NTT_CRT(r, (n << 1), t, t + l, t + 2 * l);
+}
+
+#endif
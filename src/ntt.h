@@ -0,0 +1,28 @@
+#ifndef _NTT_H_
+#define _NTT_H_
+
+#include "config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 3-prime NTT 곱셈 사용 가능 조건 (64-bit 모듈러 곱셈에 unsigned __int128 필요)
+#if defined(__SIZEOF_INT128__) && ((BIT_LEN == 32) || (BIT_LEN == 64))
+#define UW_NTT
+#endif
+
+// 캐시 블록 크기 (원소 개수) : 이 크기 이하의 변환은 캐시 안에서 모든 단계 반복 수행
+#define NTT_BLOCK		1024
+
+#if defined(UW_NTT)
+UNWORD UW_NTT_Scratch_Size(const UNWORD n);
+void UW_NTT_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNLONG *t);
+void UW_NTT_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNLONG *t);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
@@ -0,0 +1,217 @@
+/**
+ * @file pool.c
+ * @brief 병렬 곱셈용 worker pool
+ * @details
+ * - 기본값은 직렬 수행, UW_Pool_Init 호출 후에만 병렬 수행 (opt-in)
+ * - Karatsuba / Toom 의 최상위 부분 곱, NTT 의 소수별 변환과 butterfly 절반을 작업 단위로 분배
+ * - fork-join : 작업을 대기열에 넣은 스레드도 기다리는 동안 대기열의 작업 수행 (중첩 호출 가능, deadlock 없음)
+ * - min_size 보다 작은 부분 곱은 분배하지 않음 (작업 하나의 최소 크기)
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include "config.h"
+#include "pool.h"
+
+#if defined(UW_POOL)
+#include <pthread.h>
+
+static pthread_mutex_t	Pool_Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	Pool_Work = PTHREAD_COND_INITIALIZER;	// 대기열에 작업 추가
+static pthread_cond_t	Pool_Done = PTHREAD_COND_INITIALIZER;	// 작업 완료
+static pthread_t		*Pool_Thread = NULL;
+static UW_TASK			*Pool_Head = NULL;						// 대기열 (LIFO)
+static UNWORD			Pool_Threads = 1;						// 전체 스레드 수 (호출 스레드 포함)
+static UNWORD			Pool_Min = POOL_MIN_SIZE;
+static SNWORD			Pool_Stop = FALSE;
+
+// 대기열에서 작업 하나 꺼내서 수행 (Pool_Lock 잠근 상태로 호출, 리턴 시 잠근 상태)
+static void Pool_Exec(void)
+{
+	UW_TASK *task = Pool_Head;
+
+	Pool_Head = task->Next;
+	pthread_mutex_unlock(&Pool_Lock);
+	task->Func(task->Arg);
+	pthread_mutex_lock(&Pool_Lock);
+	if(--(*task->Remain) == 0)
+		pthread_cond_broadcast(&Pool_Done);
+}
+
+static void *Pool_Worker(void *arg)
+{
+	(void)arg;
+
+	pthread_mutex_lock(&Pool_Lock);
+	for(;;)
+	{
+		while((Pool_Head == NULL) && (Pool_Stop == FALSE))
+			pthread_cond_wait(&Pool_Work, &Pool_Lock);
+		if(Pool_Stop == TRUE)
+			break;
+		Pool_Exec();
+	}
+	pthread_mutex_unlock(&Pool_Lock);
+	return NULL;
+}
+#endif
+
+/**
+ * @brief Start worker pool
+ * @details
+ * - threads 개 스레드로 병렬 곱셈 (호출 스레드 포함, worker 는 threads - 1 개 생성) \n
+ * - min_size : 병렬 작업 하나의 최소 크기 (WORD 개수), 0 이면 POOL_MIN_SIZE \n
+ * - threads <= 1 이면 pool 종료 후 직렬 수행 \n
+ * - 곱셈 수행 중에 호출하면 안됨 \n
+ * @param[in] UNWORD threads (const)
+ * @param[in] UNWORD min_size (const)
+ * @return TRUE (병렬 수행) / FALSE (직렬 수행)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD UW_Pool_Init(const UNWORD threads, const UNWORD min_size)
+{
+#if defined(UW_POOL)
+	UNWORD i;
+
+	UW_Pool_Free();
+
+	Pool_Min = (min_size == 0) ? POOL_MIN_SIZE : min_size;
+	if(threads <= 1)
+		return FALSE;
+
+	Pool_Thread = (pthread_t *)malloc((threads - 1) * sizeof(pthread_t));
+	if(Pool_Thread == NULL)
+		return FALSE;
+
+	Pool_Stop = FALSE;
+	for(i = 0 ; i < threads - 1 ; i++)
+	{
+		if(pthread_create(&Pool_Thread[i], NULL, Pool_Worker, NULL) != 0)
+			break;
+	}
+	Pool_Threads = i + 1;
+	if(Pool_Threads == 1)
+	{
+		free(Pool_Thread);
+		Pool_Thread = NULL;
+		return FALSE;
+	}
+	return TRUE;
+#else
+	(void)threads;
+	(void)min_size;
+	return FALSE;
+#endif
+}
+
+/**
+ * @brief Stop worker pool
+ * @details
+ * - worker 스레드 종료 후 직렬 수행으로 복귀 \n
+ * - 곱셈 수행 중에 호출하면 안됨 \n
+ * @date 2026. 10. 17. \n
+ */
+void UW_Pool_Free(void)
+{
+#if defined(UW_POOL)
+	UNWORD i;
+
+	if(Pool_Thread == NULL)
+		return;
+
+	pthread_mutex_lock(&Pool_Lock);
+	Pool_Stop = TRUE;
+	pthread_cond_broadcast(&Pool_Work);
+	pthread_mutex_unlock(&Pool_Lock);
+
+	for(i = 0 ; i < Pool_Threads - 1 ; i++)
+		pthread_join(Pool_Thread[i], NULL);
+
+	free(Pool_Thread);
+	Pool_Thread = NULL;
+	Pool_Threads = 1;
+	Pool_Stop = FALSE;
+#endif
+}
+
+/**
+ * @brief Number of threads of worker pool
+ * @return UNWORD 전체 스레드 수 (직렬 수행이면 1)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Pool_Threads(void)
+{
+#if defined(UW_POOL)
+	return Pool_Threads;
+#else
+	return 1;
+#endif
+}
+
+/**
+ * @brief Check parallel execution of sub-product
+ * @details
+ * - pool 이 동작 중이고 부분 곱 크기 n >= min_size 이면 TRUE \n
+ * @param[in] UNWORD n (const) 부분 곱 하나의 크기 (WORD 개수)
+ * @return TRUE (병렬 수행) / FALSE (직렬 수행)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD UW_Pool_Use(const UNWORD n)
+{
+#if defined(UW_POOL)
+	return ((Pool_Threads > 1) && (n >= Pool_Min)) ? TRUE : FALSE;
+#else
+	(void)n;
+	return FALSE;
+#endif
+}
+
+/**
+ * @brief Run tasks on worker pool
+ * @details
+ * - task[0..n-1] 을 모두 수행한 후 리턴 (fork-join) \n
+ * - task[0] 은 호출 스레드가 직접 수행, 나머지는 대기열에 추가 \n
+ * - 기다리는 동안 대기열의 작업 (다른 호출의 작업 포함) 수행 \n
+ * - pool 이 동작 중이 아니면 순서대로 직렬 수행 \n
+ * @param[in] UW_TASK *task
+ * @param[in] UNWORD n (const)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Pool_Run(UW_TASK *task, const UNWORD n)
+{
+	UNWORD i;
+#if defined(UW_POOL)
+	UNWORD remain;
+
+	if((Pool_Threads > 1) && (n > 1))
+	{
+		pthread_mutex_lock(&Pool_Lock);
+		remain = n - 1;
+		for(i = n - 1 ; i > 0 ; i--)
+		{
+			task[i].Remain = &remain;
+			task[i].Next = Pool_Head;
+			Pool_Head = &task[i];
+		}
+		pthread_cond_broadcast(&Pool_Work);
+		pthread_mutex_unlock(&Pool_Lock);
+
+		task[0].Func(task[0].Arg);
+
+		pthread_mutex_lock(&Pool_Lock);
+		while(remain != 0)
+		{
+			if(Pool_Head != NULL)
+				Pool_Exec();
+			else
+				pthread_cond_wait(&Pool_Done, &Pool_Lock);
+		}
+		pthread_mutex_unlock(&Pool_Lock);
+		return;
+	}
+#endif
+
+	for(i = 0 ; i < n ; i++)
+		task[i].Func(task[i].Arg);
+}
@@ -0,0 +1,39 @@
+#ifndef _POOL_H_
+#define _POOL_H_
+
+#include "config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// POSIX thread 사용 가능한 경우 worker pool 사용 (그 외 항상 직렬 수행)
+#if defined(__unix__) || defined(__APPLE__)
+#define UW_POOL
+#endif
+
+// 병렬 작업 하나의 최소 크기 기본값 (WORD 개수, UW_Pool_Init 의 min_size == 0 인 경우)
+// - multi-core 속도 향상은 측정 X (단일 core 에서 작업 분배 비용만 확인 : 2048 -> 직렬과 차이 없음, 512 -> 4096 WORD 곱셈 3 ~ 6% 느림)
+// - 사용 환경에서 UW_Pool_Init 의 min_size 로 조정
+#define POOL_MIN_SIZE		2048
+
+// 병렬 작업 (Func(Arg) 호출, Next / Remain 은 pool 내부 사용)
+typedef struct _UW_TASK
+{
+	void	(*Func)(void *);	// 작업 함수
+	void	*Arg;				// 작업 함수 인자
+	struct _UW_TASK	*Next;		// 대기열 (내부 사용)
+	UNWORD	*Remain;			// 남은 작업 수 (내부 사용)
+} UW_TASK;
+
+SNWORD UW_Pool_Init(const UNWORD threads, const UNWORD min_size);
+void UW_Pool_Free(void);
+UNWORD UW_Pool_Threads(void);
+SNWORD UW_Pool_Use(const UNWORD n);
+void UW_Pool_Run(UW_TASK *task, const UNWORD n);
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
@@ -0,0 +1,636 @@
+/**
+ * @file r52.c
+ * @brief radix 2^52 곱셈, Montgomery 곱셈 (AVX-512 IFMA / AVX2)
+ * @details
+ * - 피연산자를 64-bit lane 하나에 52-bit limb 하나씩 저장
+ * - AVX-512 IFMA : vpmadd52luq / vpmadd52huq 로 52 x 52 -> 104-bit 곱의 하위 / 상위 52-bit 누적 (8 lane)
+ * - AVX2 : limb 를 26-bit 2 개로 나누어 vpmuludq (32 x 32 -> 64) 4 번으로 같은 하위 / 상위 값 계산 (4 lane)
+ * - 그 외 : unsigned __int128 scalar
+ * - 곱셈 중에는 carry 전파 없이 64-bit lane 에 누적 (하위 L[], 상위 H[] 분리 -> lane 간 이동 없음), 마지막에 한 번 정규화
+ * - Montgomery 곱셈 (IFMA) : n / 8 개 zmm 누산기를 레지스터에 두고 b 의 limb 마다 곱셈과 reduction 을 함께 수행 (word-by-word)
+ * - Montgomery 곱셈 (AVX2 / scalar) : 곱셈 후 limb 단위 reduction (SOS), R = 2^(52n)
+ * - BIGNUM (UNWORD) <-> radix 2^52 변환은 API 경계에서만 수행
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include "config.h"
+#include "bignum.h"
+#include "word.h"
+#include "r52.h"
+
+#if defined(UW_R52)
+
+#if defined(R52_IFMA) || defined(R52_AVX2)
+#include <immintrin.h>
+#endif
+
+#if defined(R52_IFMA)
+// 고정 zmm 개수 함수 : 상수 개수로 inline + 반복문 완전 unroll (누산기 배열 -> zmm 레지스터)
+#if defined(__clang__)
+#define R52_FORCE_INLINE	static inline __attribute__((always_inline))
+#define R52_UNROLL			_Pragma("unroll")
+#elif defined(__GNUC__)
+#define R52_FORCE_INLINE	static inline __attribute__((always_inline))
+#define R52_UNROLL			_Pragma("GCC unroll 16")
+#else
+#define R52_FORCE_INLINE	static inline
+#define R52_UNROLL
+#endif
+
+#define R52_ZMM_MAX			(R52_MAX_LIMBS / 8)		// zmm 누산기 최대 개수
+#endif
+
+// 지수승 table 한 항목의 limb 간격 (zmm 단위로 올림, 마지막 zmm 도 항목 안에서 읽음)
+#define R52_STRIDE(n)		(((n) + 7) & ~((UNWORD)7))
+
+/**
+ * @brief Row kernel of radix 2^52 multiplication
+ * @details
+ * - l[j] += (a * b[j]) mod 2^52, h[j] += (a * b[j]) >> 52 (j < n) \n
+ * - h[j] 의 가중치는 2^(52(j+1)) (다음 limb) \n
+ * - a, b[j] < 2^52 \n
+ * @date 2026. 10. 17. \n
+ */
+static void R52_AddMul_1(UNLONG *l, UNLONG *h, const UNLONG *b, const UNWORD n, const UNLONG a)
+{
+	UNWORD j = 0;
+#if defined(R52_IFMA)
+	__m512i va = _mm512_set1_epi64((long long)a);
+	__m512i vb;
+	__mmask8 k;
+
+	for( ; j + 8 <= n ; j += 8)
+	{
+		vb = _mm512_loadu_si512((const void *)(b + j));
+		_mm512_storeu_si512((void *)(l + j), _mm512_madd52lo_epu64(_mm512_loadu_si512((const void *)(l + j)), va, vb));
+		_mm512_storeu_si512((void *)(h + j), _mm512_madd52hi_epu64(_mm512_loadu_si512((const void *)(h + j)), va, vb));
+	}
+	if(j < n)
+	{
+		k = (__mmask8)((1U << (n - j)) - 1);
+		vb = _mm512_maskz_loadu_epi64(k, (const void *)(b + j));
+		_mm512_mask_storeu_epi64((void *)(l + j), k, _mm512_madd52lo_epu64(_mm512_maskz_loadu_epi64(k, (const void *)(l + j)), va, vb));
+		_mm512_mask_storeu_epi64((void *)(h + j), k, _mm512_madd52hi_epu64(_mm512_maskz_loadu_epi64(k, (const void *)(h + j)), va, vb));
+	}
+#else
+#if defined(R52_AVX2)
+	// a * b = al bl + (al bh + ah bl) 2^26 + ah bh 2^52 (al, ah, bl, bh < 2^26)
+	__m256i m26 = _mm256_set1_epi64x(0x3FFFFFF);
+	__m256i al = _mm256_set1_epi64x((long long)(a & 0x3FFFFFF));
+	__m256i ah = _mm256_set1_epi64x((long long)(a >> 26));
+	__m256i vb, bl, bh, t0, t1, t2;
+
+	for( ; j + 4 <= n ; j += 4)
+	{
+		vb = _mm256_loadu_si256((const __m256i *)(b + j));
+		bl = _mm256_and_si256(vb, m26);
+		bh = _mm256_srli_epi64(vb, 26);
+		t0 = _mm256_mul_epu32(al, bl);
+		t1 = _mm256_add_epi64(_mm256_mul_epu32(al, bh), _mm256_mul_epu32(ah, bl));
+		t2 = _mm256_mul_epu32(ah, bh);
+		// 하위 : t0 + (t1 mod 2^26) 2^26, 상위 : t2 + (t1 >> 26)
+		t0 = _mm256_add_epi64(t0, _mm256_slli_epi64(_mm256_and_si256(t1, m26), 26));
+		t2 = _mm256_add_epi64(t2, _mm256_srli_epi64(t1, 26));
+		_mm256_storeu_si256((__m256i *)(l + j), _mm256_add_epi64(_mm256_loadu_si256((const __m256i *)(l + j)), t0));
+		_mm256_storeu_si256((__m256i *)(h + j), _mm256_add_epi64(_mm256_loadu_si256((const __m256i *)(h + j)), t2));
+	}
+#endif
+	for( ; j < n ; j++)
+	{
+#if defined(__SIZEOF_INT128__)
+		unsigned __int128 p = (unsigned __int128)a * b[j];
+
+		l[j] += (UNLONG)p & R52_MASK;
+		h[j] += (UNLONG)(p >> R52_BITS);
+#else
+		UNLONG t0 = (a & 0x3FFFFFF) * (b[j] & 0x3FFFFFF);
+		UNLONG t1 = (a & 0x3FFFFFF) * (b[j] >> 26) + (a >> 26) * (b[j] & 0x3FFFFFF);
+		UNLONG t2 = (a >> 26) * (b[j] >> 26);
+
+		l[j] += t0 + ((t1 & 0x3FFFFFF) << 26);
+		h[j] += t2 + (t1 >> 26);
+#endif
+	}
+#endif
+}
+
+// l[0..2n-1], h[0..2n-1] = a * b (정규화 전 누산기)
+static void R52_Mul_Acc(UNLONG *l, UNLONG *h, const UNLONG *a, const UNLONG *b, const UNWORD n)
+{
+	UNWORD i;
+
+	for(i = 0 ; i < (n << 1) ; i++)
+	{
+		l[i] = 0;
+		h[i] = 0;
+	}
+	for(i = 0 ; i < n ; i++)
+		R52_AddMul_1(l + i, h + i, b, n, a[i]);
+}
+
+// r[0..n-1] - m[0..n-1] (borrow 리턴), limb < 2^52
+static UNLONG R52_Sub_n(UNLONG *r, const UNLONG *a, const UNLONG *m, const UNWORD n)
+{
+	UNLONG d, borrow = 0;
+	UNWORD i;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		d = a[i] - m[i] - borrow;
+		r[i] = d & R52_MASK;
+		borrow = d >> 63;
+	}
+	return borrow;
+}
+
+// r = t - m (t[n] != 0 or t >= m) or t, t < 2m (n + 1 limb), 비교 / 분기 없이 mask 로 선택
+static void R52_Final_Sub(UNLONG *r, const UNLONG *t, const UNLONG *m, const UNWORD n)
+{
+	UNLONG d[R52_MAX_LIMBS];
+	UNLONG mask;
+	UNWORD i;
+
+	// t[n] = 1 이면 borrow = 1 이지만 t - m (mod 2^(52n)) 이 결과
+	mask = (UNLONG)0 - ((t[n] | (R52_Sub_n(d, t, m, n) ^ 1)) & 1);
+	for(i = 0 ; i < n ; i++)
+		r[i] = (d[i] & mask) | (t[i] & ~mask);
+}
+
+/**
+ * @brief Convert UNWORD array to radix 2^52
+ * @details
+ * - r[0..n-1] = a[0..na-1] 를 52-bit 씩 자른 값 (상위 bit 는 버림, 부족한 bit 는 0) \n
+ * @param[out] UNLONG *r
+ * @param[in] UNWORD n (const) limb 개수
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const)
+ * @date 2026. 10. 17. \n
+ */
+void R52_From_Words(UNLONG *r, const UNWORD n, const UNWORD *a, const UNWORD na)
+{
+	UNWORD i, pos, w, s, take, got;
+	UNLONG v, word;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		v = 0;
+		pos = i * R52_BITS;
+		for(got = 0 ; got < R52_BITS ; got += take, pos += take)
+		{
+			w = pos / BIT_LEN;
+			s = pos % BIT_LEN;
+			take = ((BIT_LEN - s) < (R52_BITS - got)) ? (BIT_LEN - s) : (R52_BITS - got);
+			word = (w < na) ? (UNLONG)(a[w] >> s) : 0;
+			v |= (word & ((((UNLONG)1) << take) - 1)) << got;
+		}
+		r[i] = v;
+	}
+}
+
+/**
+ * @brief Convert radix 2^52 to UNWORD array
+ * @details
+ * - r[0..nw-1] = a[0..n-1] (정규화된 limb, 상위 bit 는 버림, 부족한 bit 는 0) \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD nw (const) WORD 개수
+ * @param[in] UNLONG *a (const)
+ * @param[in] UNWORD n (const) limb 개수
+ * @date 2026. 10. 17. \n
+ */
+void R52_To_Words(UNWORD *r, const UNWORD nw, const UNLONG *a, const UNWORD n)
+{
+	UNWORD i, pos, w, s, take, got;
+	UNLONG v, limb;
+
+	for(i = 0 ; i < nw ; i++)
+	{
+		v = 0;
+		pos = i * BIT_LEN;
+		for(got = 0 ; got < BIT_LEN ; got += take, pos += take)
+		{
+			w = pos / R52_BITS;
+			s = pos % R52_BITS;
+			take = ((R52_BITS - s) < (BIT_LEN - got)) ? (R52_BITS - s) : (BIT_LEN - got);
+			limb = (w < n) ? (a[w] >> s) : 0;
+			v |= (limb & ((((UNLONG)1) << take) - 1)) << got;
+		}
+		r[i] = (UNWORD)v;
+	}
+}
+
+/**
+ * @brief Multiplication of radix 2^52 array A and B
+ * @details
+ * - r[0..2n-1] = a[0..n-1] * b[0..n-1] (정규화된 limb) \n
+ * - n <= R52_MAX_LIMBS, r 은 a, b 와 겹쳐도 됨 \n
+ * @param[out] UNLONG *r
+ * @param[in] UNLONG *a (const)
+ * @param[in] UNLONG *b (const)
+ * @param[in] UNWORD n (const)
+ * @date 2026. 10. 17. \n
+ */
+void R52_Mul(UNLONG *r, const UNLONG *a, const UNLONG *b, const UNWORD n)
+{
+	UNLONG l[R52_MAX_LIMBS << 1], h[R52_MAX_LIMBS << 1];
+	UNLONG c = 0;
+	UNWORD i;
+
+	R52_Mul_Acc(l, h, a, b, n);
+
+	// 정규화 : 열 k = l[k] + h[k-1] + carry
+	for(i = 0 ; i < (n << 1) ; i++)
+	{
+		c += l[i] + ((i != 0) ? h[i - 1] : 0);
+		r[i] = c & R52_MASK;
+		c >>= R52_BITS;
+	}
+}
+
+#if defined(R52_IFMA)
+/**
+ * @brief Montgomery multiplication kernel with K zmm accumulators (IFMA)
+ * @details
+ * - r = a * b * R^(-1) mod m (n limb, K = ceil(n / 8), 상수 K 로 inline) \n
+ * - limb j 는 acc[j / 8] 의 lane (j mod 8), 값은 정규화 하지 않고 64-bit lane 에 누적 \n
+ * - b[i] 마다 (word-by-word, reduction interleave) \n
+ *   1) t0 += lo52(a[0] b[i]), y = t0 k0 mod 2^52, carry = (t0 + lo52(m[0] y)) >> 52 (t0 : lane 0, scalar) \n
+ *   2) acc += lo52(a b[i]) + lo52(m y), hi = hi52(a b[i]) + hi52(m y) (hi 는 acc 와 독립) \n
+ *   3) acc = (acc 를 lane 하나 내림, valignq) + hi (상위 52-bit 의 가중치가 lane 이동 후 위치와 같음) \n
+ *   4) t0 = acc lane 0 + carry (carry 는 vector 에 넣지 않음 -> 의존 경로 단축) \n
+ * - lane 마다 반복 당 2^54 미만 추가 -> n <= R52_MAX_LIMBS 이면 overflow 없음 \n
+ * - 마지막에 한 번 정규화 (< 2m), R52_Final_Sub \n
+ * - a, b, m 은 n limb 만 읽음 (마지막 zmm 은 mask load), r 은 a, b 와 겹쳐도 됨 \n
+ * @date 2026. 10. 18. \n
+ */
+R52_FORCE_INLINE void R52_Mont_Mul_Zmm(UNLONG *r, const UNLONG *a, const UNLONG *b, const UNLONG *m, const UNLONG k0, const UNWORD n, const UNWORD K)
+{
+	__m512i acc[R52_ZMM_MAX], hi[R52_ZMM_MAX], va[R52_ZMM_MAX], vm[R52_ZMM_MAX];
+	__m512i vb, vy, zero = _mm512_setzero_si512();
+	__mmask8 tail = (__mmask8)(0xFF >> ((8 * K) - n));
+	UNLONG t[R52_MAX_LIMBS + 1];
+	UNLONG t0 = 0, y, c;
+	UNWORD i, j;
+
+	R52_UNROLL
+	for(j = 0 ; j < K ; j++)
+	{
+		acc[j] = zero;
+		va[j] = (j + 1 < K) ? _mm512_loadu_si512((const void *)(a + 8 * j)) : _mm512_maskz_loadu_epi64(tail, (const void *)(a + 8 * j));
+		vm[j] = (j + 1 < K) ? _mm512_loadu_si512((const void *)(m + 8 * j)) : _mm512_maskz_loadu_epi64(tail, (const void *)(m + 8 * j));
+	}
+
+	for(i = 0 ; i < n ; i++)
+	{
+		// y = (t0 + a[0] b[i]) k0 mod 2^52 (곱의 하위 64-bit 로 충분), lane 0 의 carry 는 scalar 로만 계산
+		t0 += (a[0] * b[i]) & R52_MASK;
+		y = (t0 * k0) & R52_MASK;
+		c = (t0 + ((m[0] * y) & R52_MASK)) >> R52_BITS;
+		vb = _mm512_set1_epi64((long long)b[i]);
+		vy = _mm512_set1_epi64((long long)y);
+
+		// 상위 52-bit 곱은 누산기와 독립 (lane 이동 후 더함)
+		R52_UNROLL
+		for(j = 0 ; j < K ; j++)
+		{
+			acc[j] = _mm512_madd52lo_epu64(_mm512_madd52lo_epu64(acc[j], va[j], vb), vm[j], vy);
+			hi[j] = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(zero, va[j], vb), vm[j], vy);
+		}
+
+		// lane 하나 내림 (lane 0 은 버림, carry c 는 t0 에만 반영)
+		R52_UNROLL
+		for(j = 0 ; j < K ; j++)
+			acc[j] = _mm512_add_epi64(_mm512_alignr_epi64((j + 1 < K) ? acc[j + 1] : zero, acc[j], 1), hi[j]);
+
+		t0 = (UNLONG)_mm_cvtsi128_si64(_mm512_castsi512_si128(acc[0])) + c;
+	}
+
+	// 정규화 (< 2m, n + 1 limb)
+	R52_UNROLL
+	for(j = 0 ; j < K ; j++)
+		_mm512_storeu_si512((void *)(t + 8 * j), acc[j]);
+	t[0] = t0;
+	c = 0;
+	for(i = 0 ; i < n ; i++)
+	{
+		c += t[i];
+		t[i] = c & R52_MASK;
+		c >>= R52_BITS;
+	}
+	t[n] = c;
+
+	R52_Final_Sub(r, t, m, n);
+}
+
+// zmm 개수 (K) 별 상수 inline
+#define R52_MONT_MUL_K(K)	case K: R52_Mont_Mul_Zmm(r, a, b, ctx->m, ctx->k0, ctx->n, K); break
+#endif
+
+/**
+ * @brief Montgomery Multiplication of radix 2^52 array A and B
+ * @details
+ * - r = a * b * R^(-1) mod m (R = 2^(52n), a, b < m) \n
+ * - IFMA : R52_Mont_Mul_Zmm (zmm 누산기, b 의 limb 마다 곱셈 + reduction) \n
+ * - AVX2 / scalar : 곱셈 (누산기) 후 limb 마다 q = t_i * k0 mod 2^52, t += q m 2^(52i) (같은 row kernel 사용) \n
+ * - 결과 < 2m 이면 한 번 빼서 [0, m) 출력 (분기 없이 mask 선택), r 은 a, b 와 겹쳐도 됨 \n
+ * @param[in] R52_MONT *ctx (const)
+ * @param[out] UNLONG *r
+ * @param[in] UNLONG *a (const)
+ * @param[in] UNLONG *b (const)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. IFMA 는 zmm 누산기 word-by-word kernel, 마지막 뺄셈 constant-time \n
+ */
+void R52_Mont_Mul(const R52_MONT *ctx, UNLONG *r, const UNLONG *a, const UNLONG *b)
+{
+#if defined(R52_IFMA)
+	switch((ctx->n + 7) >> 3)
+	{
+	R52_MONT_MUL_K(1);	R52_MONT_MUL_K(2);	R52_MONT_MUL_K(3);	R52_MONT_MUL_K(4);
+	R52_MONT_MUL_K(5);	R52_MONT_MUL_K(6);	R52_MONT_MUL_K(7);	R52_MONT_MUL_K(8);
+	R52_MONT_MUL_K(9);	R52_MONT_MUL_K(10);	R52_MONT_MUL_K(11);	R52_MONT_MUL_K(12);
+	R52_MONT_MUL_K(13);	R52_MONT_MUL_K(14);	R52_MONT_MUL_K(15);	R52_MONT_MUL_K(16);
+	}
+#else
+	UNLONG l[R52_MAX_LIMBS << 1], h[R52_MAX_LIMBS << 1], t[R52_MAX_LIMBS + 1];
+	UNLONG c = 0, q, hp;
+	UNWORD i, n = ctx->n;
+
+	R52_Mul_Acc(l, h, a, b, n);
+
+	// reduction : 하위 limb 부터 0 으로 만들고 carry 는 다음 limb 로
+	for(i = 0 ; i < n ; i++)
+	{
+		hp = (i != 0) ? h[i - 1] : 0;
+		q = (((c + l[i] + hp) & R52_MASK) * ctx->k0) & R52_MASK;
+		R52_AddMul_1(l + i, h + i, ctx->m, n, q);
+		c = (c + l[i] + hp) >> R52_BITS;
+	}
+
+	// t = 상위 n limb 정규화 (< 2m)
+	for(i = n ; i < (n << 1) ; i++)
+	{
+		c += l[i] + h[i - 1];
+		t[i - n] = c & R52_MASK;
+		c >>= R52_BITS;
+	}
+	t[n] = c;
+
+	R52_Final_Sub(r, t, ctx->m, n);
+#endif
+}
+
+/**
+ * @brief Convert to Montgomery form
+ * @details
+ * - r = a * R mod m (a < m) \n
+ * @date 2026. 10. 17. \n
+ */
+void R52_Mont_To(const R52_MONT *ctx, UNLONG *r, const UNLONG *a)
+{
+	R52_Mont_Mul(ctx, r, a, ctx->rr);
+}
+
+/**
+ * @brief Convert from Montgomery form
+ * @details
+ * - r = a * R^(-1) mod m \n
+ * @date 2026. 10. 17. \n
+ */
+void R52_Mont_From(const R52_MONT *ctx, UNLONG *r, const UNLONG *a)
+{
+	UNLONG one[R52_MAX_LIMBS];
+	UNWORD i;
+
+	one[0] = 1;
+	for(i = 1 ; i < ctx->n ; i++)
+		one[i] = 0;
+	R52_Mont_Mul(ctx, r, a, one);
+}
+
+/**
+ * @brief Initialize radix 2^52 Montgomery context
+ * @details
+ * - 홀수 모듈러 N (> 1, R52_MAX_LIMBS limb 이하) 의 k0 = -N^(-1) mod 2^52, R^2 mod N 계산 \n
+ * - k0, R^2 mod N = 2^(2 * 52n) mod N : UW_Mont_Setup (long division 나머지), 키 마다 한 번만 수행 \n
+ * @param[out] R52_MONT *ctx
+ * @param[in] BIGNUM *N (const)
+ * @return TRUE (성공) / FALSE (지원하지 않는 모듈러, 메모리 할당 실패)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. R^2 mod N 을 2 배 반복 대신 UW_Pow2_Mod 로 계산, 상수 계산은 UW_Mont_Setup 공통 \n
+ * @date 2026. 10. 18. 할당 실패 확인 \n
+ */
+SNWORD R52_Mont_Init(R52_MONT *ctx, const BIGNUM *N)
+{
+	UNWORD msb = 0, nw = N->Length;
+	UNWORD *x;
+
+	ctx->m = NULL;
+	ctx->rr = NULL;
+
+	if((nw == 0) || (N->Sign != PLUS) || ((N->Num[0] & 1) == 0) || ((nw == 1) && (N->Num[0] == 1)))
+		return FALSE;
+
+	UW_BitSearch(&msb, N->Num[nw - 1]);
+	ctx->n = R52_LIMBS((nw - 1) * BIT_LEN + msb + 1);
+	ctx->nw = nw;
+	if(ctx->n > R52_MAX_LIMBS)
+		return FALSE;
+
+	ctx->m = (UNLONG *)malloc(ctx->n * sizeof(UNLONG));
+	ctx->rr = (UNLONG *)malloc(ctx->n * sizeof(UNLONG));
+	if((ctx->m == NULL) || (ctx->rr == NULL))
+	{
+		R52_Mont_Free(ctx);
+		return FALSE;
+	}
+	R52_From_Words(ctx->m, ctx->n, N->Num, nw);
+
+	// k0 = -m^(-1) mod 2^52, R^2 mod N = 2^(2 * 52n) mod N
+	x = (UNWORD *)calloc(nw + UW_MONT_SETUP_SCRATCH(R52_BITS * ctx->n, nw), sizeof(UNWORD));
+	if(x == NULL)
+	{
+		R52_Mont_Free(ctx);
+		return FALSE;
+	}
+	ctx->k0 = UW_Mont_Setup(x, N->Num, nw, R52_BITS * ctx->n, x + nw) & R52_MASK;
+	R52_From_Words(ctx->rr, ctx->n, x, nw);
+	free(x);
+
+	return TRUE;
+}
+
+/**
+ * @brief Free radix 2^52 Montgomery context
+ * @date 2026. 10. 17. \n
+ */
+void R52_Mont_Free(R52_MONT *ctx)
+{
+	free(ctx->m);
+	free(ctx->rr);
+	ctx->m = NULL;
+	ctx->rr = NULL;
+	ctx->n = 0;
+	ctx->nw = 0;
+}
+
+/**
+ * @brief Multiply BIGNUM *A and BIGNUM *B in radix 2^52
+ * @details
+ * - BIGNUM *A 와 BIGNUM *B 를 곱한 결과 BIGNUM *R 출력 \n
+ * - radix 2^52 변환 -> R52_Mul -> UNWORD 변환 \n
+ * - R52_MAX_LIMBS 를 넘는 입력은 BN_Mul \n
+ * - 부호 구분 가능, R 은 A, B 와 같아도 됨 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A
+ * @param[in] BIGNUM *B
+ * @date 2026. 10. 17. \n
+ */
+void BN_R52_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B)
+{
+	UNLONG a[R52_MAX_LIMBS], b[R52_MAX_LIMBS], r[R52_MAX_LIMBS << 1];
+	UNWORD nw, n;
+	SNWORD sign;
+
+	if((A->Length == 0) || (B->Length == 0)) // A 또는 B 가 0 인 경우
+	{
+		BN_Zeroize(R);
+		return;
+	}
+
+	nw = (A->Length > B->Length) ? A->Length : B->Length;
+	n = R52_LIMBS(nw * BIT_LEN);
+	if(n > R52_MAX_LIMBS)
+	{
+		BN_Mul(R, A, B);
+		return;
+	}
+
+	R52_From_Words(a, n, A->Num, A->Length);
+	R52_From_Words(b, n, B->Num, B->Length);
+	sign = A->Sign * B->Sign;
+	nw = A->Length + B->Length;
+
+	R52_Mul(r, a, b, n);
+
+	BN_Result_Size(R, nw);
+	R52_To_Words(R->Num, nw, r, (n << 1));
+	R->Length = nw;
+	R->Sign = sign;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+/**
+ * @brief Constant-time table lookup (radix 2^52)
+ * @details
+ * - r = tb[idx] (항목 cnt 개, 항목 간격 s limb, n limb 복사) \n
+ * - 모든 항목을 읽고 mask 로 선택 (idx 에 따른 주소 / 분기 없음) \n
+ * - IFMA : 모든 항목을 zmm 단위로 mask 없이 읽고 and / or 로 선택 (s 는 8 의 배수, R52_STRIDE) \n
+ *   (masked load / blend 의 memory operand 는 mask 에 따라 cache line 접근 여부가 달라질 수 있음) \n
+ * @date 2026. 10. 18. \n
+ */
+static void R52_Select(UNLONG *r, const UNLONG *tb, const UNWORD n, const UNWORD s, const UNWORD cnt, const UNWORD idx)
+{
+#if defined(R52_IFMA)
+	__m512i v[R52_ZMM_MAX], vm;
+	UNLONG mask, d;
+	UNWORD j, k, K = s >> 3;
+
+	for(j = 0 ; j < K ; j++)
+		v[j] = _mm512_setzero_si512();
+	for(k = 0 ; k < cnt ; k++)
+	{
+		d = (UNLONG)(k ^ idx);
+		mask = ((d | ((UNLONG)0 - d)) >> 63) - 1;
+		vm = _mm512_set1_epi64((long long)mask);
+		for(j = 0 ; j < K ; j++)
+			v[j] = _mm512_or_si512(v[j], _mm512_and_si512(vm, _mm512_loadu_si512((const void *)(tb + k * s + 8 * j))));
+	}
+	for(j = 0 ; j < n ; j += 8)
+		_mm512_mask_storeu_epi64((void *)(r + j), (__mmask8)((n - j >= 8) ? 0xFF : (0xFF >> (8 - (n - j)))), v[j >> 3]);
+#else
+	UNLONG mask, d;
+	UNWORD j, k;
+
+	for(j = 0 ; j < n ; j++)
+		r[j] = 0;
+	for(k = 0 ; k < cnt ; k++)
+	{
+		d = (UNLONG)(k ^ idx);
+		mask = ((d | ((UNLONG)0 - d)) >> 63) - 1;
+		for(j = 0 ; j < n ; j++)
+			r[j] |= tb[k * s + j] & mask;
+	}
+#endif
+}
+
+/**
+ * @brief Modular Exponentiation in radix 2^52 Montgomery form
+ * @details
+ * - R = A^E mod N (ctx : R52_Mont_Init(ctx, N)) \n
+ * - 0 <= A < N, E >= 0 \n
+ * - 고정 4-bit window (table 16 개, window 마다 제곱 4 번 + 곱셈 1 번) \n
+ * - 모든 곱셈은 R52_Mont_Mul (IFMA / AVX2 backend), 변환은 처음과 끝에서 한 번씩 \n
+ * - table 은 stack (항목 간격 R52_STRIDE(n)), window 값은 R52_Select 로 constant-time 선택, 종료 시 0 으로 지움 \n
+ * @param[out] BIGNUM *R
+ * @param[in] BIGNUM *A
+ * @param[in] BIGNUM *E
+ * @param[in] R52_MONT *ctx (const)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. table index 접근 -> masked table scan, malloc 제거 \n
+ */
+void BN_R52_Mod_Exp(BIGNUM *R, BIGNUM *A, BIGNUM *E, const R52_MONT *ctx)
+{
+	UNLONG tb[R52_MAX_LIMBS << 4];
+	UNLONG x[R52_MAX_LIMBS], y[R52_MAX_LIMBS];
+	UNWORD i, j, w, msb = 0, n = ctx->n, s = R52_STRIDE(ctx->n);
+
+	// 항목 간격의 나머지 limb 는 0
+	for(i = 0 ; i < (s << 4) ; i++)
+		tb[i] = 0;
+
+	// tb[0] = 1, tb[1] = A (Montgomery 형식)
+	R52_From_Words(x, n, A->Num, A->Length);
+	R52_Mont_To(ctx, tb + s, x);
+	for(i = 0 ; i < n ; i++)
+		x[i] = (i == 0) ? 1 : 0;
+	R52_Mont_To(ctx, tb, x);
+	for(i = 2 ; i < 16 ; i++)
+		R52_Mont_Mul(ctx, tb + i * s, tb + (i - 1) * s, tb + s);
+
+	// window 개수
+	w = 0;
+	if(E->Length != 0)
+	{
+		UW_BitSearch(&msb, E->Num[E->Length - 1]);
+		w = ((E->Length - 1) * BIT_LEN + msb + 4) >> 2;
+	}
+
+	for(i = 0 ; i < n ; i++)
+		x[i] = tb[i];
+	for(i = w ; i > 0 ; i--)
+	{
+		if(i != w)
+			for(j = 0 ; j < 4 ; j++)
+				R52_Mont_Mul(ctx, x, x, x);
+		R52_Select(y, tb, n, s, 16, UW_Window(E->Num, i - 1));
+		R52_Mont_Mul(ctx, x, x, y);
+	}
+	R52_Mont_From(ctx, x, x);
+
+	// table 지우기
+	for(i = 0 ; i < (s << 4) ; i++)
+		tb[i] = 0;
+
+	BN_Result_Size(R, ctx->nw);
+	R52_To_Words(R->Num, ctx->nw, x, n);
+	R->Length = ctx->nw;
+	R->Sign = PLUS;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+#endif
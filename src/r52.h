@@ -0,0 +1,57 @@
+#ifndef _R52_H_
+#define _R52_H_
+
+#include "config.h"
+#include "bignum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// radix 2^52 (64-bit lane 에 52-bit limb) 곱셈 backend
+// AVX-512 IFMA (vpmadd52luq / vpmadd52huq) > AVX2 (vpmuludq, 26-bit 분할) > scalar (unsigned __int128)
+#if defined(__AVX512F__) && defined(__AVX512IFMA__)
+#define R52_IFMA
+#elif defined(__AVX2__)
+#define R52_AVX2
+#endif
+
+#if defined(R52_IFMA) || defined(R52_AVX2) || defined(__SIZEOF_INT128__)
+#define UW_R52
+#endif
+
+#define R52_BITS			52
+#define R52_MASK			((UNLONG)0xFFFFFFFFFFFFFULL)
+#define R52_LIMBS(bits)		(((bits) + R52_BITS - 1) / R52_BITS)	// bit 길이 -> limb 개수
+#define R52_MAX_LIMBS		128		// 누산기 overflow 없는 최대 limb 개수 (6656-bit)
+
+// radix 2^52 Montgomery context (R = 2^(52n))
+typedef struct _R52_MONT
+{
+	UNWORD	n;			// limb 개수
+	UNWORD	nw;			// 모듈러 WORD 개수
+	UNLONG	*m;			// 모듈러 (radix 2^52)
+	UNLONG	*rr;		// R^2 mod m (radix 2^52)
+	UNLONG	k0;			// -m^(-1) mod 2^52
+} R52_MONT;
+
+#if defined(UW_R52)
+void R52_From_Words(UNLONG *r, const UNWORD n, const UNWORD *a, const UNWORD na);
+void R52_To_Words(UNWORD *r, const UNWORD nw, const UNLONG *a, const UNWORD n);
+void R52_Mul(UNLONG *r, const UNLONG *a, const UNLONG *b, const UNWORD n);
+
+SNWORD R52_Mont_Init(R52_MONT *ctx, const BIGNUM *N);
+void R52_Mont_Free(R52_MONT *ctx);
+void R52_Mont_Mul(const R52_MONT *ctx, UNLONG *r, const UNLONG *a, const UNLONG *b);
+void R52_Mont_To(const R52_MONT *ctx, UNLONG *r, const UNLONG *a);
+void R52_Mont_From(const R52_MONT *ctx, UNLONG *r, const UNLONG *a);
+
+void BN_R52_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+void BN_R52_Mod_Exp(BIGNUM *R, BIGNUM *A, BIGNUM *E, const R52_MONT *ctx);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
@@ -25,6 +25,9 @@
 #include "word.h"
 #include "bignum.h"
 #include "gf2n.h"
+#include "gfp.h"
+#include "r52.h"
+#include "vec.h"
 
 
 void Sage_Test_GF2N()
@@ -397,6 +400,41 @@ void Sage_Test_GF2N()
 	GF2N_Zero_Free(&a);
 	GF2N_Zero_Free(&r);	
 #endif 
+#if 0
+// void GF2N_Div(GF2N *Q, GF2N *R, GF2N *A, GF2N *IRR);
+	GF2N a, irr, q, r;
+	FILE *fp;
+	fp = fopen("GF2N_Div.txt", "at");
+	// deg(A) >= deg(IRR) 인 경우 포함 (A 4 WORD, IRR 2 WORD 이하)
+	GF2N_Init_Rand(&a, 4);
+	GF2N_Init_Rand(&irr, 2);
+	GF2N_Init_Zero(&q);
+	GF2N_Init_Zero(&r);
+	GF2N_Div(&q, &r, &a, &irr);
+	printf("(");
+	fprintf(fp, "(");
+	GF2N_Print_poly(&a);
+	GF2N_FPrint_poly(fp, &a);
+	printf("+0) == (");
+	fprintf(fp, "+0) == (");
+	GF2N_Print_poly(&q);
+	GF2N_FPrint_poly(fp, &q);
+	printf("+0) * (");
+	fprintf(fp, "+0) * (");
+	GF2N_Print_poly(&irr);
+	GF2N_FPrint_poly(fp, &irr);
+	printf("+0) + (");
+	fprintf(fp, "+0) + (");
+	GF2N_Print_poly(&r);
+	GF2N_FPrint_poly(fp, &r);
+	printf("+0)\n");
+	fprintf(fp, "+0)\n");
+	fclose(fp);
+	GF2N_Zero_Free(&a);
+	GF2N_Zero_Free(&irr);
+	GF2N_Zero_Free(&q);
+	GF2N_Zero_Free(&r);
+#endif 
 
 
 
@@ -942,6 +980,726 @@ void Sage_Test_BIGNUM()
 	
 #endif 
 
+#if 0
+// SNWORD BN_Div(BIGNUM *Q, BIGNUM *R, const BIGNUM *A, const BIGNUM *B);
+	BIGNUM a, b, q, r;
+	FILE *fp;
+	fp = fopen("BN_Div.txt", "at");
+	// 몫은 0 방향 버림, R 의 부호 = A 의 부호 (Sage // 와 다름 -> A == Q * B + R 로 확인)
+	BN_Init_Rand(&a, 8);
+	BN_Init_Rand(&b, 4);
+	BN_Init_Zero(&q);
+	BN_Init_Zero(&r);
+	BN_Div(&q, &r, &a, &b);
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") == hex((");
+	fprintf(fp, ") == hex((");
+	BN_Print_hex(&q);
+	BN_FPrint_hex(fp, &q);
+	printf(") * (");
+	fprintf(fp, ") * (");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") + (");
+	fprintf(fp, ") + (");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf("))\n");
+	fprintf(fp, "))\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&q);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// SNWORD BN_Mod(BIGNUM *R, const BIGNUM *A, const BIGNUM *N);
+	BIGNUM a, n, r;
+	FILE *fp;
+	fp = fopen("BN_Mod.txt", "at");
+	// 음수 A 포함, N 은 양수 (0 <= R < N)
+	BN_Init_Rand(&a, 8);
+	BN_Init_Rand(&n, 4);
+	BN_Init_Zero(&r);
+	n.Sign = PLUS;
+	BN_Mod(&r, &a, &n);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") %% (");
+	fprintf(fp, ") %% (");
+	BN_Print_hex(&n);
+	BN_FPrint_hex(fp, &n);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&n);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Euclidean_GCD(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r;
+	FILE *fp;
+	fp = fopen("BN_Euclidean_GCD.txt", "at");
+	BN_Init_Rand(&a, 4);
+	BN_Init_Rand(&b, 4);
+	BN_Init_Zero(&r);
+	a.Sign = b.Sign = PLUS;
+	BN_Euclidean_GCD(&r, &a, &b);
+	printf("hex(gcd(");
+	fprintf(fp, "hex(gcd(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(", ");
+	fprintf(fp, ", ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Ext_Euclidean_GCD(BIGNUM *R, BIGNUM *X, BIGNUM *Y, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r, x, y;
+	FILE *fp;
+	fp = fopen("BN_Ext_Euclidean_GCD.txt", "at");
+	// R == gcd(A, B) and A * X + B * Y == R
+	BN_Init_Rand(&a, 4);
+	BN_Init_Rand(&b, 4);
+	BN_Init_Zero(&r);
+	BN_Init_Zero(&x);
+	BN_Init_Zero(&y);
+	a.Sign = b.Sign = PLUS;
+	BN_Ext_Euclidean_GCD(&r, &x, &y, &a, &b);
+	printf("hex(gcd(");
+	fprintf(fp, "hex(gcd(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(", ");
+	fprintf(fp, ", ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(") == hex((");
+	fprintf(fp, ") == hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") * (");
+	fprintf(fp, ") * (");
+	BN_Print_hex(&x);
+	BN_FPrint_hex(fp, &x);
+	printf(") + (");
+	fprintf(fp, ") + (");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") * (");
+	fprintf(fp, ") * (");
+	BN_Print_hex(&y);
+	BN_FPrint_hex(fp, &y);
+	printf("))\n");
+	fprintf(fp, "))\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+	BN_Zero_Free(&x);
+	BN_Zero_Free(&y);
+#endif 
+#if 0
+// SNWORD BN_Bar_Reduce(BIGNUM *R, const BIGNUM *A, BN_BAR *ctx);
+	BIGNUM a, n, r;
+	BN_BAR ctx;
+	FILE *fp;
+	fp = fopen("BN_Bar_Reduce.txt", "at");
+	// 0 <= A < W^(2n), n = N 의 WORD 개수
+	BN_Init_Rand(&n, 4);
+	n.Sign = PLUS;
+	BN_Init_Rand(&a, 2 * n.Length);
+	a.Sign = PLUS;
+	BN_Init_Zero(&r);
+	BN_Bar_Init(&ctx, &n);
+	BN_Bar_Reduce(&r, &a, &ctx);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") %% (");
+	fprintf(fp, ") %% (");
+	BN_Print_hex(&n);
+	BN_FPrint_hex(fp, &n);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Bar_Free(&ctx);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&n);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Mont_Mul(BIGNUM *R, const BIGNUM *A, const BIGNUM *B, BN_MONT *ctx);
+	BIGNUM a, b, n, am, bm, r;
+	BN_MONT ctx;
+	FILE *fp;
+	fp = fopen("BN_Mont_Mul.txt", "at");
+	// 홀수 N, 0 <= A, B < N (BN_Mont_To -> BN_Mont_Mul -> BN_Mont_From)
+	BN_Init_Rand(&n, 4);
+	n.Num[0] |= 1;
+	n.Sign = PLUS;
+	BN_Init_Rand(&a, 4);
+	BN_Init_Rand(&b, 4);
+	BN_Mod(&a, &a, &n);
+	BN_Mod(&b, &b, &n);
+	BN_Init_Zero(&am);
+	BN_Init_Zero(&bm);
+	BN_Init_Zero(&r);
+	BN_Mont_Init(&ctx, &n);
+	BN_Mont_To(&am, &a, &ctx);
+	BN_Mont_To(&bm, &b, &ctx);
+	BN_Mont_Mul(&r, &am, &bm, &ctx);
+	BN_Mont_From(&r, &r, &ctx);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") * (");
+	fprintf(fp, ") * (");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") %% (");
+	fprintf(fp, ") %% (");
+	BN_Print_hex(&n);
+	BN_FPrint_hex(fp, &n);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Mont_Free(&ctx);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&n);
+	BN_Zero_Free(&am);
+	BN_Zero_Free(&bm);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Mont_Exp(BIGNUM *R, const BIGNUM *A, const BIGNUM *E, BN_MONT *ctx);
+	BIGNUM a, e, n, r;
+	BN_MONT ctx;
+	FILE *fp;
+	fp = fopen("BN_Mont_Exp.txt", "at");
+	// 홀수 N, 0 <= A < N, E >= 0
+	BN_Init_Rand(&n, 8);
+	n.Num[0] |= 1;
+	n.Sign = PLUS;
+	BN_Init_Rand(&a, 8);
+	BN_Init_Rand(&e, 8);
+	BN_Mod(&a, &a, &n);
+	e.Sign = PLUS;
+	BN_Init_Zero(&r);
+	BN_Mont_Init(&ctx, &n);
+	BN_Mont_Exp(&r, &a, &e, &ctx);
+	printf("hex(power_mod(");
+	fprintf(fp, "hex(power_mod(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(", ");
+	fprintf(fp, ", ");
+	BN_Print_hex(&e);
+	BN_FPrint_hex(fp, &e);
+	printf(", ");
+	fprintf(fp, ", ");
+	BN_Print_hex(&n);
+	BN_FPrint_hex(fp, &n);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Mont_Free(&ctx);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&e);
+	BN_Zero_Free(&n);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void GFP_Redc(BIGNUM *R, const BIGNUM *A, GFP_CTX *ctx);
+	BIGNUM a, b, p, r;
+	GFP_CTX ctx;
+	FILE *fp;
+	fp = fopen("GFP_Redc.txt", "at");
+	// 표준 곡선 소수 (GFP_P192 ~ GFP_25519), 0 <= A = a * b < P^2
+	GFP_Init_Curve(&ctx, (rand() % GFP_25519) + 1);
+	BN_Init_Zero(&p);
+	GFP_Get_Prime(&p, &ctx);
+	BN_Init_Rand(&a, ctx.n);
+	BN_Init_Rand(&b, ctx.n);
+	BN_Mod(&a, &a, &p);
+	BN_Mod(&b, &b, &p);
+	BN_Mul(&a, &a, &b);
+	BN_Init_Zero(&r);
+	GFP_Redc(&r, &a, &ctx);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") %% (");
+	fprintf(fp, ") %% (");
+	BN_Print_hex(&p);
+	BN_FPrint_hex(fp, &p);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	GFP_Free(&ctx);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&p);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void GFP_Redc(BIGNUM *R, const BIGNUM *A, GFP_CTX *ctx); (GFP_PMERSENNE)
+	BIGNUM a, b, p, r;
+	GFP_CTX ctx;
+	UCHAR buf[32];
+	UNWORD i, c;
+	FILE *fp;
+	fp = fopen("GFP_Redc_PM.txt", "at");
+	// P = 2^256 - c (c < 2^16, GFP_Init 에서 GFP_PMERSENNE 선택), 0 <= A = a * b < P^2
+	c = (rand() & 0xFFFF) + 1;
+	for(i = 0 ; i < 32 ; i++)
+		buf[i] = 0xFF;
+	buf[30] = (UCHAR)(0xFF - ((c - 1) >> 8));
+	buf[31] = (UCHAR)(0xFF - ((c - 1) & 0xFF));
+	BN_Init_Zero(&p);
+	BN_From_Bytes(&p, buf, 32);
+	GFP_Init(&ctx, &p);
+	BN_Init_Rand(&a, ctx.n);
+	BN_Init_Rand(&b, ctx.n);
+	BN_Mod(&a, &a, &p);
+	BN_Mod(&b, &b, &p);
+	BN_Mul(&a, &a, &b);
+	BN_Init_Zero(&r);
+	GFP_Redc(&r, &a, &ctx);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(") %% (");
+	fprintf(fp, ") %% (");
+	BN_Print_hex(&p);
+	BN_FPrint_hex(fp, &p);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	GFP_Free(&ctx);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&p);
+	BN_Zero_Free(&r);
+#endif 
+#if 0 // UW_VEC 필요
+// void BN_Vec_Mod_Exp(BN_VEC *R, const BN_VEC *A, const BIGNUM *E, const BN_VEC_MONT *ctx);
+	BIGNUM a[4], n, e, r[4];
+	BIGNUM *pa[4], *pr[4];
+	BN_VEC va, vr;
+	BN_VEC_MONT ctx;
+	UNWORD j;
+	FILE *fp;
+	fp = fopen("BN_Vec_Mod_Exp.txt", "at");
+	// 홀수 N, lane 마다 0 <= A_j < N, 모든 lane 같은 E (lane 마다 한 줄)
+	BN_Init_Rand(&n, 8);
+	n.Num[0] |= 1;
+	n.Sign = PLUS;
+	BN_Init_Rand(&e, 4);
+	e.Sign = PLUS;
+	for(j = 0 ; j < 4 ; j++)
+	{
+		BN_Init_Rand(&a[j], 8);
+		BN_Mod(&a[j], &a[j], &n);
+		BN_Init_Zero(&r[j]);
+		pa[j] = &a[j];
+		pr[j] = &r[j];
+	}
+	BN_Vec_Mont_Init(&ctx, &n);
+	BN_Vec_Init(&va, 4, ctx.Digits * VEC_DIGIT_BITS);
+	BN_Vec_Init(&vr, 4, ctx.Digits * VEC_DIGIT_BITS);
+	BN_Vec_Gather(&va, pa);
+	BN_Vec_Mod_Exp(&vr, &va, &e, &ctx);
+	BN_Vec_Scatter(pr, &vr);
+	for(j = 0 ; j < 4 ; j++)
+	{
+		printf("hex(power_mod(");
+		fprintf(fp, "hex(power_mod(");
+		BN_Print_hex(&a[j]);
+		BN_FPrint_hex(fp, &a[j]);
+		printf(", ");
+		fprintf(fp, ", ");
+		BN_Print_hex(&e);
+		BN_FPrint_hex(fp, &e);
+		printf(", ");
+		fprintf(fp, ", ");
+		BN_Print_hex(&n);
+		BN_FPrint_hex(fp, &n);
+		printf(")) == hex(");
+		fprintf(fp, ")) == hex(");
+		BN_Print_hex(&r[j]);
+		BN_FPrint_hex(fp, &r[j]);
+		printf(")\n");
+		fprintf(fp, ")\n");
+	}
+	fclose(fp);
+	BN_Vec_Free(&va);
+	BN_Vec_Free(&vr);
+	BN_Vec_Mont_Free(&ctx);
+	for(j = 0 ; j < 4 ; j++)
+	{
+		BN_Zero_Free(&a[j]);
+		BN_Zero_Free(&r[j]);
+	}
+	BN_Zero_Free(&n);
+	BN_Zero_Free(&e);
+#endif 
+#if 0 // UW_R52 필요
+// void BN_R52_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r;
+	FILE *fp;
+	fp = fopen("BN_R52_Mul.txt", "at");
+	BN_Init_Rand(&a, 8);
+	BN_Init_Rand(&b, 8);
+	BN_Init_Zero(&r);
+	BN_R52_Mul(&r, &a, &b);
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0 // UW_R52 필요
+// void BN_R52_Mod_Exp(BIGNUM *R, BIGNUM *A, BIGNUM *E, const R52_MONT *ctx);
+	BIGNUM a, e, n, r;
+	R52_MONT ctx;
+	FILE *fp;
+	fp = fopen("BN_R52_Mod_Exp.txt", "at");
+	// 홀수 N, 0 <= A < N, E >= 0
+	BN_Init_Rand(&n, 8);
+	n.Num[0] |= 1;
+	n.Sign = PLUS;
+	BN_Init_Rand(&a, 8);
+	BN_Init_Rand(&e, 8);
+	BN_Mod(&a, &a, &n);
+	e.Sign = PLUS;
+	BN_Init_Zero(&r);
+	R52_Mont_Init(&ctx, &n);
+	BN_R52_Mod_Exp(&r, &a, &e, &ctx);
+	printf("hex(power_mod(");
+	fprintf(fp, "hex(power_mod(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(", ");
+	fprintf(fp, ", ");
+	BN_Print_hex(&e);
+	BN_FPrint_hex(fp, &e);
+	printf(", ");
+	fprintf(fp, ", ");
+	BN_Print_hex(&n);
+	BN_FPrint_hex(fp, &n);
+	printf(")) == hex(");
+	fprintf(fp, ")) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	R52_Mont_Free(&ctx);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&e);
+	BN_Zero_Free(&n);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Toom_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r;
+	FILE *fp;
+	fp = fopen("BN_Toom_Mul.txt", "at");
+	// TOOM4_THRESHOLD 이상, 1 / 4 조각 >= TOOM3_THRESHOLD : Toom-4 -> Toom-3 -> Karatsuba 재귀 모두 사용
+	BN_Init_Rand(&a, 1600);
+	BN_Init_Rand(&b, 1600);
+	BN_Init_Zero(&r);
+	BN_Toom_Mul(&r, &a, &b);
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Toom_Sqr(BIGNUM *R, BIGNUM *A);
+	BIGNUM a, r;
+	FILE *fp;
+	fp = fopen("BN_Toom_Sqr.txt", "at");
+	// TOOM4_SQR_THRESHOLD 이상, 1 / 4 조각 >= TOOM3_SQR_THRESHOLD : Toom-4 -> Toom-3 -> Karatsuba 제곱 재귀 모두 사용
+	BN_Init_Rand(&a, 1600);
+	BN_Init_Zero(&r);
+	BN_Toom_Sqr(&r, &a);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(")^2) == hex(");
+	fprintf(fp, ")^2) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&r);
+#endif 
+#if 0 // UW_NTT 필요
+// void BN_NTT_Mul(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r;
+	FILE *fp;
+	fp = fopen("BN_NTT_Mul.txt", "at");
+	// NTT_THRESHOLD 이상 (BN_Mul 에서 NTT 선택되는 길이)
+	BN_Init_Rand(&a, 8000);
+	BN_Init_Rand(&b, 8000);
+	BN_Init_Zero(&r);
+	BN_NTT_Mul(&r, &a, &b);
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0 // UW_NTT 필요
+// void BN_NTT_Sqr(BIGNUM *R, BIGNUM *A);
+	BIGNUM a, r;
+	FILE *fp;
+	fp = fopen("BN_NTT_Sqr.txt", "at");
+	// NTT_SQR_THRESHOLD 이상 (BN_Sqr 에서 NTT 선택되는 길이)
+	BN_Init_Rand(&a, 8000);
+	BN_Init_Zero(&r);
+	BN_NTT_Sqr(&r, &a);
+	printf("hex((");
+	fprintf(fp, "hex((");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(")^2) == hex(");
+	fprintf(fp, ")^2) == hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_MulAdd(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r;
+	FILE *fp;
+	fp = fopen("BN_MulAdd.txt", "at");
+	// 부호 랜덤, KARA_THRESHOLD 이상 / 미만 길이 모두 포함 (r = R0 + A * B)
+	BN_Init_Rand(&a, 100);
+	BN_Init_Rand(&b, 100);
+	BN_Init_Rand(&r, 100);
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(" + ");
+	fprintf(fp, " + ");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_MulAdd(&r, &a, &b);
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_MulSub(BIGNUM *R, BIGNUM *A, BIGNUM *B);
+	BIGNUM a, b, r;
+	FILE *fp;
+	fp = fopen("BN_MulSub.txt", "at");
+	// 부호 랜덤, KARA_THRESHOLD 이상 / 미만 길이 모두 포함 (r = R0 - A * B)
+	BN_Init_Rand(&a, 100);
+	BN_Init_Rand(&b, 100);
+	BN_Init_Rand(&r, 100);
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(" - ");
+	fprintf(fp, " - ");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	BN_Print_hex(&b);
+	BN_FPrint_hex(fp, &b);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_MulSub(&r, &a, &b);
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_Mul_Word(BIGNUM *R, BIGNUM *A, const UNWORD w);
+	BIGNUM a, b, r;
+	UNWORD w;
+	FILE *fp;
+	fp = fopen("BN_Mul_Word.txt", "at");
+	// w : 랜덤 1 WORD
+	BN_Init_Rand(&a, 100);
+	BN_Init_Rand(&b, 1);
+	BN_Init_Zero(&r);
+	w = b.Num[0];
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	printf("0x" WORD_HEX_FMT, w);
+	fprintf(fp, "0x" WORD_HEX_FMT, w);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_Mul_Word(&r, &a, w);
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
+#if 0
+// void BN_AddMul_Word(BIGNUM *R, BIGNUM *A, const UNWORD w);
+	BIGNUM a, b, r;
+	UNWORD w;
+	FILE *fp;
+	fp = fopen("BN_AddMul_Word.txt", "at");
+	// 부호 랜덤, w : 랜덤 1 WORD (r = R0 + A * w)
+	BN_Init_Rand(&a, 100);
+	BN_Init_Rand(&b, 1);
+	BN_Init_Rand(&r, 100);
+	w = b.Num[0];
+	printf("hex(");
+	fprintf(fp, "hex(");
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(" + ");
+	fprintf(fp, " + ");
+	BN_Print_hex(&a);
+	BN_FPrint_hex(fp, &a);
+	printf(" * ");
+	fprintf(fp, " * ");
+	printf("0x" WORD_HEX_FMT, w);
+	fprintf(fp, "0x" WORD_HEX_FMT, w);
+	printf(") == hex(");
+	fprintf(fp, ") == hex(");
+	BN_AddMul_Word(&r, &a, w);
+	BN_Print_hex(&r);
+	BN_FPrint_hex(fp, &r);
+	printf(")\n");
+	fprintf(fp, ")\n");
+	fclose(fp);
+	BN_Zero_Free(&a);
+	BN_Zero_Free(&b);
+	BN_Zero_Free(&r);
+#endif 
 
 
 }
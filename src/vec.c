@@ -0,0 +1,652 @@
+/**
+ * @file vec.c
+ * @brief 같은 크기 BIGNUM 묶음 (BN_VEC) 의 lane 병렬 덧셈, 뺄셈, 곱셈, Montgomery 곱셈, 모듈러 지수승
+ * @details
+ * - N 개 값을 limb-major (SoA) 로 저장 : 같은 자리 digit 이 연속 -> 한 명령어로 여러 값의 같은 자리 계산
+ * - digit (D-bit) 은 64-bit lane 하나에 하나, 곱의 하위 / 상위 D-bit 를 따로 누적 -> lane 안에서 carry 처리, lane 간 이동 없음
+ * - AVX-512 IFMA : D = 52 (vpmadd52luq / vpmadd52huq, 곱과 누적 한 명령어), 8 lane
+ * - 그 외 : D = 32 (vpmuludq : 32 x 32 -> 64-bit 곱 후 하위 / 상위 분리), AVX-512F : 8 lane, AVX2 : 4 lane, scalar : lane 마다 반복
+ * - 모든 lane 이 같은 순서로 같은 연산 (값에 따른 분기 X), 조건부 뺄셈은 mask 선택
+ * - BIGNUM <-> BN_VEC 변환은 Gather / Scatter (Set / Get) 에서만 수행
+ * @date 2026. 10. 17.
+ * @author YoungJin CHO
+ * @version 1.00
+ */
+
+#include "config.h"
+#include "bignum.h"
+#include "word.h"
+#include "vec.h"
+
+#if defined(UW_VEC)
+
+#if defined(VEC_AVX512) || defined(VEC_AVX2)
+#include <immintrin.h>
+#endif
+
+#define VEC_DIGIT_MASK		((((UNLONG)1) << VEC_DIGIT_BITS) - 1)
+
+// lane 연산 (VEC_WIDTH 개 lane 을 한 번에)
+#if defined(VEC_AVX512)
+#define VEC_WIDTH			8
+typedef __m512i VEC_T;
+#define VEC_LOAD(p)			_mm512_loadu_si512((const void *)(p))
+#define VEC_STORE(p, v)		_mm512_storeu_si512((void *)(p), (v))
+#define VEC_SET1(x)			_mm512_set1_epi64((long long)(x))
+#define VEC_ADD(a, b)		_mm512_add_epi64((a), (b))
+#define VEC_SUB(a, b)		_mm512_sub_epi64((a), (b))
+#define VEC_MUL(a, b)		_mm512_mul_epu32((a), (b))		// 하위 32-bit 곱 -> 64-bit
+#define VEC_AND(a, b)		_mm512_and_si512((a), (b))
+#define VEC_ANDNOT(a, b)	_mm512_andnot_si512((a), (b))	// ~a & b
+#define VEC_OR(a, b)		_mm512_or_si512((a), (b))
+#define VEC_SRL(a, s)		_mm512_srli_epi64((a), (s))
+#elif defined(VEC_AVX2)
+#define VEC_WIDTH			4
+typedef __m256i VEC_T;
+#define VEC_LOAD(p)			_mm256_loadu_si256((const __m256i *)(p))
+#define VEC_STORE(p, v)		_mm256_storeu_si256((__m256i *)(p), (v))
+#define VEC_SET1(x)			_mm256_set1_epi64x((long long)(x))
+#define VEC_ADD(a, b)		_mm256_add_epi64((a), (b))
+#define VEC_SUB(a, b)		_mm256_sub_epi64((a), (b))
+#define VEC_MUL(a, b)		_mm256_mul_epu32((a), (b))
+#define VEC_AND(a, b)		_mm256_and_si256((a), (b))
+#define VEC_ANDNOT(a, b)	_mm256_andnot_si256((a), (b))
+#define VEC_OR(a, b)		_mm256_or_si256((a), (b))
+#define VEC_SRL(a, s)		_mm256_srli_epi64((a), (s))
+#else
+#define VEC_WIDTH			1
+typedef UNLONG VEC_T;
+#define VEC_LOAD(p)			(*(p))
+#define VEC_STORE(p, v)		(*(p) = (v))
+#define VEC_SET1(x)			((UNLONG)(x))
+#define VEC_ADD(a, b)		((a) + (b))
+#define VEC_SUB(a, b)		((a) - (b))
+#define VEC_MUL(a, b)		(((a) & VEC_DIGIT_MASK) * ((b) & VEC_DIGIT_MASK))
+#define VEC_AND(a, b)		((a) & (b))
+#define VEC_ANDNOT(a, b)	(~(a) & (b))
+#define VEC_OR(a, b)		((a) | (b))
+#define VEC_SRL(a, s)		((a) >> (s))
+#endif
+
+// t + (a * b 의 하위 D-bit), t + (a * b 의 상위 D-bit) (a, b < 2^D)
+#if defined(VEC_IFMA)
+#define VEC_MADD_LO(t, a, b)	_mm512_madd52lo_epu64((t), (a), (b))
+#define VEC_MADD_HI(t, a, b)	_mm512_madd52hi_epu64((t), (a), (b))
+#else
+#define VEC_MADD_LO(t, a, b)	VEC_ADD((t), VEC_AND(VEC_MUL((a), (b)), VEC_SET1(VEC_DIGIT_MASK)))
+#define VEC_MADD_HI(t, a, b)	VEC_ADD((t), VEC_SRL(VEC_MUL((a), (b)), VEC_DIGIT_BITS))
+#endif
+
+/**
+ * @brief UNWORD array -> D-bit digit (stride 간격)
+ * @details
+ * - r[d * stride] = a 의 d 번째 D-bit digit (d < nd, a 길이 넘는 bit 는 0) \n
+ * - digit 하나가 WORD 여러 개에 걸칠 수 있음 (D = 52) -> WORD 경계 단위로 나누어 모음 \n
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. D = 52 지원 (WORD 경계에 걸친 digit) \n
+ */
+static void Vec_From_Words(UNLONG *r, const UNWORD stride, const UNWORD nd, const UNWORD *a, const UNWORD na)
+{
+	UNLONG v;
+	UNWORD d, i, k, o, c;
+
+	for(d = 0 ; d < nd ; d++)
+	{
+		v = 0;
+		for(k = 0 ; k < VEC_DIGIT_BITS ; k += c)
+		{
+			i = (d * VEC_DIGIT_BITS + k) / BIT_LEN;
+			o = (d * VEC_DIGIT_BITS + k) % BIT_LEN;
+			c = ((BIT_LEN - o) < (VEC_DIGIT_BITS - k)) ? (BIT_LEN - o) : (VEC_DIGIT_BITS - k);
+			if(i < na)
+				v |= ((UNLONG)(a[i] >> o) & ((((UNLONG)1) << c) - 1)) << k;
+		}
+		r[d * stride] = v;
+	}
+}
+
+/**
+ * @brief D-bit digit (stride 간격) -> UNWORD array
+ * @details
+ * - r[0 ~ nw - 1] = a 의 digit nd 개 (r 에 들어가지 않는 상위 bit 는 버림) \n
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. D = 52 지원 (WORD 경계에 걸친 digit) \n
+ */
+static void Vec_To_Words(UNWORD *r, const UNWORD nw, const UNLONG *a, const UNWORD stride, const UNWORD nd)
+{
+	UNWORD d, i, k, o, c;
+
+	for(i = 0 ; i < nw ; i++)
+		r[i] = 0;
+	for(d = 0 ; d < nd ; d++)
+		for(k = 0 ; k < VEC_DIGIT_BITS ; k += c)
+		{
+			i = (d * VEC_DIGIT_BITS + k) / BIT_LEN;
+			o = (d * VEC_DIGIT_BITS + k) % BIT_LEN;
+			c = ((BIT_LEN - o) < (VEC_DIGIT_BITS - k)) ? (BIT_LEN - o) : (VEC_DIGIT_BITS - k);
+			if(i < nw)
+				r[i] |= (UNWORD)((a[d * stride] >> k) & ((((UNLONG)1) << c) - 1)) << o;
+		}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Initialize BN_VEC
+ * @details
+ * - bits 크기 값 count 개 묶음 생성 (모든 값 0) \n
+ * - Digits = Ceil(bits / D), Lanes = Count 를 BN_VEC_LANES 배수로 올림 \n
+ * @param[out] BN_VEC *V
+ * @param[in] UNWORD count (const) 값 개수
+ * @param[in] UNWORD bits (const) 값 하나의 bit 길이 (1 ~ D * VEC_MAX_DIGITS)
+ * @return TRUE (성공) / FALSE (지원하지 않는 크기 or 할당 실패)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 할당 실패 확인 \n
+ */
+SNWORD BN_Vec_Init(BN_VEC *V, const UNWORD count, const UNWORD bits)
+{
+	V->Num = NULL;
+	V->Count = count;
+	V->Lanes = ((count + BN_VEC_LANES - 1) / BN_VEC_LANES) * BN_VEC_LANES;
+	V->Digits = VEC_DIGITS(bits);
+
+	if((count == 0) || (V->Digits == 0) || (V->Digits > VEC_MAX_DIGITS))
+	{
+		V->Count = V->Lanes = V->Digits = 0;
+		return FALSE;
+	}
+
+	V->Num = (UNLONG *)calloc(V->Digits * V->Lanes, sizeof(UNLONG));
+	if(V->Num == NULL)
+	{
+		V->Count = V->Lanes = V->Digits = 0;
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Free BN_VEC
+ * @details
+ * - digit 배열 0 초기화 후 해제 \n
+ * @param[in,out] BN_VEC *V
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Free(BN_VEC *V)
+{
+	UNWORD i;
+
+	for(i = 0 ; i < V->Digits * V->Lanes ; i++)
+		V->Num[i] = 0;
+	free(V->Num);
+	V->Num = NULL;
+	V->Count = V->Lanes = V->Digits = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Set j-th value of BN_VEC
+ * @details
+ * - V 의 j 번째 값 = |A| mod 2^(D Digits) (부호 무시) \n
+ * @param[in,out] BN_VEC *V
+ * @param[in] UNWORD j (const) 값 위치 (< Count)
+ * @param[in] BIGNUM *A (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Set(BN_VEC *V, const UNWORD j, const BIGNUM *A)
+{
+	Vec_From_Words(V->Num + j, V->Lanes, V->Digits, A->Num, A->Length);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Get j-th value of BN_VEC
+ * @details
+ * - BIGNUM *R = V 의 j 번째 값 (양수 or 0) \n
+ * @param[out] BIGNUM *R
+ * @param[in] BN_VEC *V (const)
+ * @param[in] UNWORD j (const) 값 위치 (< Count)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Get(BIGNUM *R, const BN_VEC *V, const UNWORD j)
+{
+	UNWORD nw = (V->Digits * VEC_DIGIT_BITS + BIT_LEN - 1) / BIT_LEN;
+
+	BN_Result_Size(R, nw);
+	Vec_To_Words(R->Num, nw, V->Num + j, V->Lanes, V->Digits);
+	R->Length = nw;
+	R->Sign = PLUS;
+
+	// BIGNUM 최적화
+	BN_Optimize(R);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Gather BIGNUMs into BN_VEC
+ * @details
+ * - V 의 j 번째 값 = |A[j]| mod 2^(D Digits) (j < Count) \n
+ * @param[in,out] BN_VEC *V
+ * @param[in] BIGNUM *A[] (const) Count 개 BIGNUM 포인터
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Gather(BN_VEC *V, BIGNUM *const *A)
+{
+	UNWORD j;
+
+	for(j = 0 ; j < V->Count ; j++)
+		BN_Vec_Set(V, j, A[j]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Scatter BN_VEC into BIGNUMs
+ * @details
+ * - BIGNUM *R[j] = V 의 j 번째 값 (j < Count) \n
+ * @param[out] BIGNUM *R[] Count 개 BIGNUM 포인터
+ * @param[in] BN_VEC *V (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Scatter(BIGNUM *const *R, const BN_VEC *V)
+{
+	UNWORD j;
+
+	for(j = 0 ; j < V->Count ; j++)
+		BN_Vec_Get(R[j], V, j);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Add BN_VEC *A and BN_VEC *B
+ * @details
+ * - 모든 lane 에 대해 R = (A + B) mod 2^(D Digits) \n
+ * - A, B, R 은 같은 Count, Digits (R = A or R = B 가능) \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BN_VEC *B (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Add(BN_VEC *R, const BN_VEC *A, const BN_VEC *B)
+{
+	UNWORD d, j, L = R->Lanes;
+	VEC_T s, c, mask = VEC_SET1(VEC_DIGIT_MASK);
+
+	for(j = 0 ; j < L ; j += VEC_WIDTH)
+	{
+		c = VEC_SET1(0);
+		for(d = 0 ; d < R->Digits ; d++)
+		{
+			s = VEC_ADD(VEC_ADD(VEC_LOAD(A->Num + d * L + j), VEC_LOAD(B->Num + d * L + j)), c);
+			VEC_STORE(R->Num + d * L + j, VEC_AND(s, mask));
+			c = VEC_SRL(s, VEC_DIGIT_BITS);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Subtract BN_VEC *B from BN_VEC *A
+ * @details
+ * - 모든 lane 에 대해 R = (A - B) mod 2^(D Digits) \n
+ * - A, B, R 은 같은 Count, Digits (R = A or R = B 가능) \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BN_VEC *B (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Sub(BN_VEC *R, const BN_VEC *A, const BN_VEC *B)
+{
+	UNWORD d, j, L = R->Lanes;
+	VEC_T s, b, mask = VEC_SET1(VEC_DIGIT_MASK);
+
+	for(j = 0 ; j < L ; j += VEC_WIDTH)
+	{
+		b = VEC_SET1(0);
+		for(d = 0 ; d < R->Digits ; d++)
+		{
+			// 음수 -> 64-bit 최상위 bit = borrow
+			s = VEC_SUB(VEC_SUB(VEC_LOAD(A->Num + d * L + j), VEC_LOAD(B->Num + d * L + j)), b);
+			VEC_STORE(R->Num + d * L + j, VEC_AND(s, mask));
+			b = VEC_SRL(s, 63);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Multiply BN_VEC *A and BN_VEC *B
+ * @details
+ * - 모든 lane 에 대해 R = (A * B) mod 2^(D R.Digits) (R.Digits = A.Digits + B.Digits 이면 전체 곱) \n
+ * - 기본 곱셈, 곱 a[d] * b[i] 의 하위 D-bit 는 t[i + d], 상위 D-bit 는 t[i + d + 1] 에 누적 \n
+ *   (carry 전파 없음 -> digit 간 의존성 X, t < 2n 2^D), 마지막에 한 번 정규화 \n
+ * - lane 묶음 단위로 임시 배열에 계산 후 저장 \n
+ * - A, B, R 은 같은 Count (R = A or R = B 가능) \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BN_VEC *B (const)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 하위 / 상위 누적을 VEC_MADD_LO / VEC_MADD_HI 로 (IFMA : D = 52) \n
+ */
+void BN_Vec_Mul(BN_VEC *R, const BN_VEC *A, const BN_VEC *B)
+{
+	VEC_T t[VEC_MAX_DIGITS + 1];
+	VEC_T s, c, a, h, bi, zero = VEC_SET1(0), mask = VEC_SET1(VEC_DIGIT_MASK);
+	UNWORD d, i, j, L = R->Lanes, nr = R->Digits;
+
+	for(j = 0 ; j < L ; j += VEC_WIDTH)
+	{
+		for(d = 0 ; d <= nr ; d++)
+			t[d] = zero;
+
+		for(i = 0 ; (i < B->Digits) && (i < nr) ; i++)
+		{
+			// 상위 D-bit h 는 다음 자리에서 더함 (t 배열은 digit 마다 한 번만 갱신)
+			bi = VEC_LOAD(B->Num + i * L + j);
+			h = zero;
+			for(d = 0 ; (d < A->Digits) && (i + d < nr) ; d++)
+			{
+				a = VEC_LOAD(A->Num + d * L + j);
+				t[i + d] = VEC_MADD_LO(VEC_ADD(t[i + d], h), a, bi);
+				h = VEC_MADD_HI(zero, a, bi);
+			}
+			t[i + d] = VEC_ADD(t[i + d], h);	// t[nr] 은 버림
+		}
+
+		// 정규화 (carry 전파) 후 저장
+		c = zero;
+		for(d = 0 ; d < nr ; d++)
+		{
+			s = VEC_ADD(t[d], c);
+			VEC_STORE(R->Num + d * L + j, VEC_AND(s, mask));
+			c = VEC_SRL(s, VEC_DIGIT_BITS);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Initialize BN_VEC Montgomery context
+ * @details
+ * - 홀수 모듈러 N (> 1, VEC_MAX_DIGITS digit 이하) 의 N0 = -N^(-1) mod 2^D, R^2 mod N 계산 \n
+ * - N0, R^2 mod N = 2^(2 D Digits) mod N : UW_Mont_Setup (long division 나머지), 모듈러 마다 한 번만 수행 \n
+ * - 사용할 BN_VEC 은 Digits = ctx->Digits 로 생성 (BN_Vec_Init(V, count, BN 의 bit 길이)) \n
+ * @param[out] BN_VEC_MONT *ctx
+ * @param[in] BIGNUM *N (const)
+ * @return TRUE (성공) / FALSE (지원하지 않는 모듈러 or 할당 실패)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. R^2 mod N 을 2 배 반복 대신 UW_Pow2_Mod 로 계산, 상수 계산은 UW_Mont_Setup 공통 \n
+ * @date 2026. 10. 18. 할당 실패 확인 \n
+ */
+SNWORD BN_Vec_Mont_Init(BN_VEC_MONT *ctx, const BIGNUM *N)
+{
+	UNWORD msb = 0, nw = N->Length;
+	UNWORD *x;
+
+	ctx->N = NULL;
+	ctx->RR = NULL;
+	ctx->Digits = ctx->nw = 0;
+
+	if((nw == 0) || (N->Sign != PLUS) || ((N->Num[0] & 1) == 0) || ((nw == 1) && (N->Num[0] == 1)))
+		return FALSE;
+
+	UW_BitSearch(&msb, N->Num[nw - 1]);
+	ctx->Digits = VEC_DIGITS((nw - 1) * BIT_LEN + msb + 1);
+	ctx->nw = nw;
+	if(ctx->Digits > VEC_MAX_DIGITS)
+		return FALSE;
+
+	ctx->N = (UNLONG *)malloc(ctx->Digits * sizeof(UNLONG));
+	ctx->RR = (UNLONG *)malloc(ctx->Digits * sizeof(UNLONG));
+	if((ctx->N == NULL) || (ctx->RR == NULL))
+	{
+		BN_Vec_Mont_Free(ctx);
+		return FALSE;
+	}
+	Vec_From_Words(ctx->N, 1, ctx->Digits, N->Num, nw);
+
+	// N0 = -N^(-1) mod 2^D, R^2 mod N = 2^(2 D Digits) mod N
+	x = (UNWORD *)calloc(nw + UW_MONT_SETUP_SCRATCH(VEC_DIGIT_BITS * ctx->Digits, nw), sizeof(UNWORD));
+	if(x == NULL)
+	{
+		BN_Vec_Mont_Free(ctx);
+		return FALSE;
+	}
+	ctx->N0 = UW_Mont_Setup(x, N->Num, nw, VEC_DIGIT_BITS * ctx->Digits, x + nw) & VEC_DIGIT_MASK;
+	Vec_From_Words(ctx->RR, 1, ctx->Digits, x, nw);
+	free(x);
+
+	return TRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Free BN_VEC Montgomery context
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Mont_Free(BN_VEC_MONT *ctx)
+{
+	free(ctx->N);
+	free(ctx->RR);
+	ctx->N = NULL;
+	ctx->RR = NULL;
+	ctx->Digits = 0;
+	ctx->nw = 0;
+}
+
+/**
+ * @brief Montgomery multiplication kernel of BN_VEC
+ * @details
+ * - 모든 lane 에 대해 r = a * b * R^(-1) mod N (a, b < N -> r < N) \n
+ * - bs = 0 : b 는 모든 lane 공통 값 (digit 배열, broadcast), 그 외 : lane 간격 bs 인 BN_VEC 배열 \n
+ * - digit 마다 t += (a * b[i] + m * N) * 2^(Di), m = t[i] * N0 mod 2^D (FIOS, 이동 대신 t[i] 부터 사용) \n
+ * - 곱의 하위 / 상위 D-bit 를 따로 누적 (VEC_MADD_LO / VEC_MADD_HI, carry 전파 없음, t < 4n 2^D), t[i] 의 carry 만 다음 자리로 \n
+ * - 마지막에 t[n ~ 2n] 정규화 (t < 2N), t - N 은 lane 마다 borrow 로 mask 만들어 선택 (분기 X) \n
+ * - lane 묶음 단위로 임시 배열에 계산 후 저장 (r = a or r = b 가능) \n
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 하위 / 상위 누적을 VEC_MADD_LO / VEC_MADD_HI 로 (IFMA : D = 52) \n
+ */
+static void Vec_Mont_Mul(UNLONG *r, const UNLONG *a, const UNLONG *b, const UNWORD bs, const UNWORD L, const BN_VEC_MONT *ctx)
+{
+	VEC_T t[(VEC_MAX_DIGITS << 1) + 2];
+	VEC_T s, c, m, h, ad, nd, bi, zero = VEC_SET1(0), mask = VEC_SET1(VEC_DIGIT_MASK), n0 = VEC_SET1(ctx->N0), one = VEC_SET1(1);
+	UNWORD d, i, j, n = ctx->Digits;
+
+	for(j = 0 ; j < L ; j += VEC_WIDTH)
+	{
+		for(d = 0 ; d < (n << 1) + 2 ; d++)
+			t[d] = zero;
+
+		for(i = 0 ; i < n ; i++)
+		{
+			// t += (a * b[i] + m * N) * 2^(Di), m = (t[i] + a[0] * b[i]) * N0 mod 2^D -> t[i] mod 2^D = 0
+			// 상위 D-bit h 는 다음 자리에서 더함 (t 배열은 digit 마다 한 번만 갱신)
+			bi = (bs == 0) ? VEC_SET1(b[i]) : VEC_LOAD(b + i * bs + j);
+			ad = VEC_LOAD(a + j);
+			nd = VEC_SET1(ctx->N[0]);
+			s = VEC_MADD_LO(t[i], ad, bi);
+			m = VEC_MADD_LO(zero, s, n0);
+			t[i] = VEC_MADD_LO(s, m, nd);
+			h = VEC_MADD_HI(VEC_MADD_HI(zero, ad, bi), m, nd);
+			for(d = 1 ; d < n ; d++)
+			{
+				ad = VEC_LOAD(a + d * L + j);
+				nd = VEC_SET1(ctx->N[d]);
+				t[i + d] = VEC_MADD_LO(VEC_MADD_LO(VEC_ADD(t[i + d], h), ad, bi), m, nd);
+				h = VEC_MADD_HI(VEC_MADD_HI(zero, ad, bi), m, nd);
+			}
+			t[i + n] = VEC_ADD(t[i + n], h);
+			t[i + 1] = VEC_ADD(t[i + 1], VEC_SRL(t[i], VEC_DIGIT_BITS));
+		}
+
+		// t[n ~ 2n] 정규화 (t < 2N -> t[2n] <= 1)
+		c = VEC_SET1(0);
+		for(d = n ; d <= (n << 1) ; d++)
+		{
+			s = VEC_ADD(t[d], c);
+			t[d] = VEC_AND(s, mask);
+			c = VEC_SRL(s, VEC_DIGIT_BITS);
+		}
+
+		// u = t - N 을 r 에 저장 (이 lane 묶음의 a, b 는 더 이상 읽지 않음), c = borrow
+		c = VEC_SET1(0);
+		for(d = 0 ; d < n ; d++)
+		{
+			s = VEC_SUB(VEC_SUB(t[n + d], VEC_SET1(ctx->N[d])), c);
+			VEC_STORE(r + d * L + j, VEC_AND(s, mask));
+			c = VEC_SRL(s, 63);
+		}
+		// t >= N 인 lane 은 u, 그 외 t (m = 모두 1 (t[2n] - c >= 0) or 0)
+		m = VEC_SUB(VEC_SRL(VEC_SUB(t[n << 1], c), 63), one);
+		for(d = 0 ; d < n ; d++)
+			VEC_STORE(r + d * L + j, VEC_OR(VEC_AND(m, VEC_LOAD(r + d * L + j)), VEC_ANDNOT(m, t[n + d])));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Montgomery Multiplication of BN_VEC
+ * @details
+ * - 모든 lane 에 대해 R = A * B * R^(-1) mod N (Montgomery 형식, A, B < N) \n
+ * - A, B, R 은 같은 Count, Digits = ctx->Digits (R = A or R = B 가능) \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BN_VEC *B (const)
+ * @param[in] BN_VEC_MONT *ctx (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Mont_Mul(BN_VEC *R, const BN_VEC *A, const BN_VEC *B, const BN_VEC_MONT *ctx)
+{
+	Vec_Mont_Mul(R->Num, A->Num, B->Num, B->Lanes, R->Lanes, ctx);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Convert BN_VEC to Montgomery form
+ * @details
+ * - 모든 lane 에 대해 R = A * R mod N (A * R^2 을 Montgomery 곱셈, A < N) \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BN_VEC_MONT *ctx (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Mont_To(BN_VEC *R, const BN_VEC *A, const BN_VEC_MONT *ctx)
+{
+	Vec_Mont_Mul(R->Num, A->Num, ctx->RR, 0, R->Lanes, ctx);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Convert BN_VEC from Montgomery form
+ * @details
+ * - 모든 lane 에 대해 R = A * R^(-1) mod N (A * 1 을 Montgomery 곱셈) \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BN_VEC_MONT *ctx (const)
+ * @date 2026. 10. 17. \n
+ */
+void BN_Vec_Mont_From(BN_VEC *R, const BN_VEC *A, const BN_VEC_MONT *ctx)
+{
+	UNLONG one[VEC_MAX_DIGITS];
+	UNWORD d;
+
+	for(d = 0 ; d < ctx->Digits ; d++)
+		one[d] = (d == 0) ? 1 : 0;
+	Vec_Mont_Mul(R->Num, A->Num, one, 0, R->Lanes, ctx);
+}
+
+/**
+ * @brief Constant-time table lookup of BN_VEC
+ * @details
+ * - r = tb[idx] (항목 cnt 개, 항목 하나 sz 개 UNLONG, sz 는 VEC_WIDTH 배수) \n
+ * - 모든 항목을 읽고 mask 로 선택 (idx 에 따른 주소 / 분기 없음, UW_Select_n 과 같은 방식) \n
+ * @date 2026. 10. 18. \n
+ */
+static void Vec_Select(UNLONG *r, const UNLONG *tb, const UNWORD sz, const UNWORD cnt, const UNWORD idx)
+{
+	UNLONG mask[16], d;
+	VEC_T v;
+	UNWORD i, k;
+
+	// mask[k] = 모두 1 (k == idx) or 0
+	for(k = 0 ; k < cnt ; k++)
+	{
+		d = (UNLONG)(k ^ idx);
+		mask[k] = ((d | ((UNLONG)0 - d)) >> 63) - 1;
+	}
+
+	for(i = 0 ; i < sz ; i += VEC_WIDTH)
+	{
+		v = VEC_SET1(0);
+		for(k = 0 ; k < cnt ; k++)
+			v = VEC_OR(v, VEC_AND(VEC_SET1(mask[k]), VEC_LOAD(tb + k * sz + i)));
+		VEC_STORE(r + i, v);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Modular Exponentiation of BN_VEC
+ * @details
+ * - 모든 lane 에 대해 R = A^E mod N (ctx : BN_Vec_Mont_Init(ctx, N), 모든 lane 같은 지수 E) \n
+ * - 0 <= A < N, E >= 0 \n
+ * - 고정 4-bit window (lane 마다 table 16 개, window 마다 제곱 4 번 + 곱셈 1 번) \n
+ * - 지수가 모든 lane 공통 -> table 선택도 공통 (lane 별 gather X) \n
+ * - window 값에 따른 table 접근은 Vec_Select (16 개 전체를 읽고 mask 선택, cache timing 으로 지수 노출 X) \n
+ * - A, R 은 같은 Count, Digits = ctx->Digits (R = A 가능), table 할당 실패 시 R 변경 X \n
+ * @param[out] BN_VEC *R
+ * @param[in] BN_VEC *A (const)
+ * @param[in] BIGNUM *E (const)
+ * @param[in] BN_VEC_MONT *ctx (const)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. table index 접근 -> masked table scan \n
+ */
+void BN_Vec_Mod_Exp(BN_VEC *R, const BN_VEC *A, const BIGNUM *E, const BN_VEC_MONT *ctx)
+{
+	UNLONG *tb, *x, *y, one[VEC_MAX_DIGITS];
+	UNWORD i, j, w, msb = 0, L = R->Lanes, sz = ctx->Digits * R->Lanes;
+
+	// table 16 개 + 선택된 table 값 y
+	tb = (UNLONG *)malloc(((sz << 4) + sz) * sizeof(UNLONG));
+	if(tb == NULL)
+		return;
+	x = R->Num;
+	y = tb + (sz << 4);
+
+	// tb[0] = 1, tb[1] = A (Montgomery 형식)
+	Vec_Mont_Mul(tb + sz, A->Num, ctx->RR, 0, L, ctx);
+	for(i = 0 ; i < ctx->Digits ; i++)
+		one[i] = (i == 0) ? 1 : 0;
+	for(i = 0 ; i < ctx->Digits ; i++)
+		for(j = 0 ; j < L ; j++)
+			tb[i * L + j] = one[i];
+	Vec_Mont_Mul(tb, tb, ctx->RR, 0, L, ctx);
+	for(i = 2 ; i < 16 ; i++)
+		Vec_Mont_Mul(tb + i * sz, tb + (i - 1) * sz, tb + sz, L, L, ctx);
+
+	// window 개수
+	w = 0;
+	if(E->Length != 0)
+	{
+		UW_BitSearch(&msb, E->Num[E->Length - 1]);
+		w = ((E->Length - 1) * BIT_LEN + msb + 4) >> 2;
+	}
+
+	for(i = 0 ; i < sz ; i++)
+		x[i] = tb[i];
+	for(i = w ; i > 0 ; i--)
+	{
+		if(i != w)
+			for(j = 0 ; j < 4 ; j++)
+				Vec_Mont_Mul(x, x, x, L, L, ctx);
+		Vec_Select(y, tb, sz, 16, UW_Window(E->Num, i - 1));
+		Vec_Mont_Mul(x, x, y, L, L, ctx);
+	}
+	Vec_Mont_Mul(x, x, one, 0, L, ctx);
+
+	for(i = 0 ; i < (sz << 4) + sz ; i++)
+		tb[i] = 0;
+	free(tb);
+}
+
+#endif
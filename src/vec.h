@@ -0,0 +1,82 @@
+#ifndef _VEC_H_
+#define _VEC_H_
+
+#include "config.h"
+#include "bignum.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 같은 크기 BIGNUM 여러 개 묶음 (SoA) : digit 을 64-bit lane 에 하나씩, lane 마다 값 하나
+// AVX-512 IFMA (52-bit digit, vpmadd52luq / vpmadd52huq zmm, 8 lane)
+// > AVX-512F (32-bit digit, vpmuludq zmm, 8 lane) > AVX2 (32-bit digit, vpmuludq ymm, 4 lane) > scalar (lane 마다 반복)
+#if (BIT_LEN == 32) || (BIT_LEN == 64)
+#define UW_VEC
+#endif
+
+#if defined(__AVX512F__)
+#define VEC_AVX512
+#define BN_VEC_LANES		8		// lane 개수 단위 (Count 를 배수로 올림)
+#if defined(__AVX512IFMA__)
+#define VEC_IFMA
+#endif
+#elif defined(__AVX2__)
+#define VEC_AVX2
+#define BN_VEC_LANES		4
+#else
+#define BN_VEC_LANES		4
+#endif
+
+#if defined(VEC_IFMA)
+#define VEC_DIGIT_BITS		52		// digit bit 길이 D
+#else
+#define VEC_DIGIT_BITS		32
+#endif
+#define VEC_DIGITS(bits)	(((bits) + VEC_DIGIT_BITS - 1) / VEC_DIGIT_BITS)	// bit 길이 -> digit 개수
+#define VEC_MAX_DIGITS		256		// 값 하나의 최대 digit 개수 (256 D-bit, kernel 임시 배열 크기)
+
+// BIGNUM 묶음 (limb-major) : Num[d * Lanes + j] = j 번째 값의 d 번째 digit (< 2^D)
+typedef struct _BN_VEC
+{
+	UNLONG	*Num;		// digit 배열 (Digits * Lanes)
+	UNWORD	Count;		// 값 개수
+	UNWORD	Lanes;		// Count 를 BN_VEC_LANES 배수로 올린 값 (나머지 lane 은 0)
+	UNWORD	Digits;		// 값 하나의 digit 개수 (고정 길이, 연산은 mod 2^(D Digits))
+} BN_VEC;
+
+// BN_VEC Montgomery context (R = 2^(D Digits), 모든 lane 같은 모듈러)
+typedef struct _BN_VEC_MONT
+{
+	UNWORD	Digits;		// 모듈러 digit 개수
+	UNWORD	nw;			// 모듈러 WORD 개수
+	UNLONG	*N;			// 모듈러 (digit)
+	UNLONG	*RR;		// R^2 mod N (digit)
+	UNLONG	N0;			// -N^(-1) mod 2^D
+} BN_VEC_MONT;
+
+#if defined(UW_VEC)
+SNWORD BN_Vec_Init(BN_VEC *V, const UNWORD count, const UNWORD bits);
+void BN_Vec_Free(BN_VEC *V);
+void BN_Vec_Set(BN_VEC *V, const UNWORD j, const BIGNUM *A);
+void BN_Vec_Get(BIGNUM *R, const BN_VEC *V, const UNWORD j);
+void BN_Vec_Gather(BN_VEC *V, BIGNUM *const *A);
+void BN_Vec_Scatter(BIGNUM *const *R, const BN_VEC *V);
+
+void BN_Vec_Add(BN_VEC *R, const BN_VEC *A, const BN_VEC *B);
+void BN_Vec_Sub(BN_VEC *R, const BN_VEC *A, const BN_VEC *B);
+void BN_Vec_Mul(BN_VEC *R, const BN_VEC *A, const BN_VEC *B);
+
+SNWORD BN_Vec_Mont_Init(BN_VEC_MONT *ctx, const BIGNUM *N);
+void BN_Vec_Mont_Free(BN_VEC_MONT *ctx);
+void BN_Vec_Mont_Mul(BN_VEC *R, const BN_VEC *A, const BN_VEC *B, const BN_VEC_MONT *ctx);
+void BN_Vec_Mont_To(BN_VEC *R, const BN_VEC *A, const BN_VEC_MONT *ctx);
+void BN_Vec_Mont_From(BN_VEC *R, const BN_VEC *A, const BN_VEC_MONT *ctx);
+void BN_Vec_Mod_Exp(BN_VEC *R, const BN_VEC *A, const BIGNUM *E, const BN_VEC_MONT *ctx);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#else
+#endif
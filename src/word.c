@@ -7,15 +7,78 @@
  * - Multiplication
  * - Modular
  * - inversion
+ * - WORD 배열 * WORD 연산 (row kernel : mul_1, addmul_1, submul_1)
+ * - Comba (product-scanning) 곱셈, 제곱
+ * - WORD 배열 덧셈, 뺄셈, 비교
+ * - 고정 길이 곱셈, 제곱 (256, 384, 521, 2048, 4096-bit)
+ * - Karatsuba 곱셈, 제곱 (WORD 배열, 메모리 할당 없음)
+ * - Toom-3, Toom-4 곱셈, 제곱 (WORD 배열, 메모리 할당 없음)
+ * - 병렬 모드 (UW_Pool_Init) : Karatsuba / Toom 의 상위 부분 곱을 worker pool 에 분배
+ * - WORD 배열 <-> byte 배열 변환 (big / little endian)
  * 자세한 설명
  * @date 2017. 03 ~ 07.
  * @author YoungJin CHO
  * @version 1.00
  */
 
+#include <string.h>
 #include "config.h"
 #include "bignum.h"
 #include "word.h"
+#include "pool.h"
+
+// 3 WORD 누산기 (c2|c1|c0) += a * b
+#if (BIT_LEN == 64) && defined(__GNUC__) && defined(__x86_64__)
+#define UW_MULADD(c0, c1, c2, a, b)					\
+	do {											\
+		UNWORD _lo, _hi;							\
+		__asm__ ("mulq	%3\n\t"					\
+			: "=a" (_lo), "=d" (_hi)				\
+			: "0" (a), "rm" (b) : "cc");			\
+		__asm__ ("addq	%3, %0\n\t"				\
+			"adcq	%4, %1\n\t"					\
+			"adcq	$0, %2\n\t"					\
+			: "+r" (c0), "+r" (c1), "+r" (c2)		\
+			: "r" (_lo), "r" (_hi) : "cc");			\
+	} while(0)
+#else
+#define UW_MULADD(c0, c1, c2, a, b)					\
+	do {											\
+		UNWORD _t[2];								\
+		UW_Mul(_t, (a), (b));						\
+		(c0) += _t[0];								\
+		_t[1] += ((c0) < _t[0]);					\
+		(c1) += _t[1];								\
+		(c2) += ((c1) < _t[1]);						\
+	} while(0)
+#endif
+
+// 고정 길이 함수 : 상수 길이로 inline + 반복문 완전 unroll (straight-line 코드 생성)
+#if defined(__clang__)
+#define UW_FORCE_INLINE		static inline __attribute__((always_inline))
+#define UW_UNROLL			_Pragma("unroll")
+#elif defined(__GNUC__)
+#define UW_FORCE_INLINE		static inline __attribute__((always_inline))
+#define UW_UNROLL			_Pragma("GCC unroll 128")
+#else
+#define UW_FORCE_INLINE		static inline
+#define UW_UNROLL
+#endif
+
+// 3 WORD 누산기 (c2|c1|c0) += 2 * (t2|t1|t0)
+#define UW_ADD2X3(c0, c1, c2, t0, t1, t2)			\
+	do {											\
+		UNWORD _c;									\
+		(t2) = ((t2) << 1) | ((t1) >> (BIT_LEN - 1));	\
+		(t1) = ((t1) << 1) | ((t0) >> (BIT_LEN - 1));	\
+		(t0) <<= 1;									\
+		(c0) += (t0);								\
+		_c = ((c0) < (t0));							\
+		(c1) += _c;									\
+		(c2) += ((c1) < _c);						\
+		(c1) += (t1);								\
+		(c2) += ((c1) < (t1)) + (t2);				\
+	} while(0)
 
 
 /**
@@ -67,67 +130,20 @@ UNWORD UW_MSB(const UNWORD a)
 }
 */
 
+/**
+ * @brief Search for MSB (Most Significant Bit) of UNWORD A
+ * @details
+ * - *msb_bit = A 의 최상위 1 bit 위치 (A == 0 인 경우 *msb_bit 변경 X) \n
+ * - UW_Clz (intrin.h) 사용 \n
+ * @param[out] UNWORD *msb_bit
+ * @param[in] UNWORD A (const)
+ * @date 2017. 03. 28. v1.00 \n
+ * @date 2026. 10. 17. 중첩 반복문 -> UW_Clz \n
+ */
 void UW_BitSearch(UNWORD *msb_bit, const UNWORD A) 
 {
-	SNWORD i=7;
-	UNWORD temp_A;
-
-	temp_A = A;
-
-	if((temp_A&WORD_MASK_H)!=0)
-	{
-		if((temp_A&WORD_MASK_H_H)!=0)
-		{
-			while(i>=0)
-			{
-				if(((temp_A>>i)&WORD_MASK_H_H)!=0)
-				{
-					*msb_bit = 8*3 + i;
-					break;
-				}
-				i--;
-			}
-		}
-		else
-		{
-			while(i>=0)
-			{
-				if(((temp_A>>i)&WORD_MASK_H_L)!=0)
-				{
-					*msb_bit = 8*2 + i;
-					break;
-				}
-				i--;
-			}
-		}		
-	}
-	else 
-	{
-		if((temp_A&WORD_MASK_L_H)!=0)
-		{
-			while(i>=0)
-			{
-				if(((temp_A>>i)&WORD_MASK_L_H)!=0)
-				{
-					*msb_bit = 8 + i;
-					break;
-				}
-				i--;
-			}
-		}
-		else
-		{
-			while(i>=0)
-			{
-				if(((temp_A>>i)&WORD_MASK_L_L)!=0)
-				{
-					*msb_bit = i;
-					break;
-				}
-				i--;
-			}
-		}		
-	}
+	if(A != 0)
+		*msb_bit = (BIT_LEN - 1) - UW_Clz(A);
 }
 
 /**
@@ -143,6 +159,12 @@ void UW_BitSearch(UNWORD *msb_bit, const UNWORD A)
 
 void UW_Mul(UNWORD *r, const UNWORD a, const UNWORD b)
 {	
+#if defined(UDWORD)
+	UDWORD t = (UDWORD)a * b; // 2 WORD 곱셈 (64-bit : unsigned __int128)
+
+	r[0] = (UNWORD)t;
+	r[1] = (UNWORD)(t >> BIT_LEN);
+#else
 	UNWORD half_len = BIT_LEN / 2;
 	
 	UNWORD a_H = (a >> half_len); // WORD 상위 절반 bit
@@ -165,69 +187,9 @@ void UW_Mul(UNWORD *r, const UNWORD a, const UNWORD b)
 	r[0] += (aL_bH << half_len);
 	if(r[0] < (aL_bH << half_len)) // carry
 		r[1] += 1;
+#endif
 }
 
-/**
- * @brief Multiply BIGNUM A from UNWORD b
- * @details
- * - BIGNUM A 에서 UNWORD B 를 곱해서 BIGNUM *R 출력 (최대 2 WORD 크기)
- * - BIGNUM * UNWORD 연산 -> R = A * b
- * @param[out] BIGNUM *R
- * @param[in] BIGNUM A (const)
- * @param[in] UNWORD b (const)
- * @date 2017. 03. 28. v1.00 \n
- */
-/*
-void BN_UW_Mul(BIGNUM *R, BIGNUM *A, const UNWORD b)
-{	
-	UNWORD i, n;
-	UNWORD carry = 0;
-	UNWORD tmp[2];
-		
-	if((A->Length == 0) || (b == 0)) // BIGNUM *A or UNWORD b 가 0 인 경우
-		BN_Zeroize(R); 
-	else if(b == 1) // UNWORD b == 1 인 경우
-		BN_Copy(R, A);
-	else if((A->Length == 1) && (A->Num[0] == 1)) // B = 1 or -1 인 경우 
-		R->Num[0] = b;
-	else // 실제 곱셈 연산
-	{
-		for(i = 0 ; i < A->Length ; i++)
-		{
-			// WORD * WORD 곱셈 , tmp[1]|tmp[0] 출력
-			UW_Mul(tmp, A->Num[i], b);
-			
-			// 결과 배열에 tmp[0] 추가
-			R->Num[i] += tmp[0];
-			carry = (R->Num[i] < tmp[0]); // carry 
-			tmp[1] = (tmp[1] + carry);
-			
-			// carry 고려한 덧셈
-			carry = (tmp[1] < carry); // tmp[1] + c < c 인 경우 carry 
-			R->Num[i + 1] += tmp[1];
-			carry += (R->Num[i + 1] < tmp[1]); // A + B + c < A + c 인 경우 carry 발생
-			
-			// 이후 상위 배열에 대한 carry 고려, 최대 배열 : R->Num[A->Length + B->Length - 1]
-			if((carry == 1) && ((i + 1) < (A->Length)))
-			{
-				n = (i + 1);
-				while (carry) // 상위 배열로 올라가면서 carry 계산
-				{
-					n++;
-					R->Num[n] += carry;
-					carry = (R->Num[n] < carry);
-				}
-			}
-		}
-	}
-	
-	// 부호 결정
-	R->Sign = A->Sign;
-
-	// BIGNUM 최적화
-	BN_Optimize(R);		
-}
-*/
 /**
  * @brief Multiply UNWORD A and B and 2
  * @details
@@ -240,6 +202,14 @@ void BN_UW_Mul(BIGNUM *R, BIGNUM *A, const UNWORD b)
  */
 void UW_Mul2(UNWORD *r, const UNWORD a, const UNWORD b)
 {	
+#if defined(UDWORD)
+	UDWORD t = (UDWORD)a * b;
+
+	r[2] = (UNWORD)(t >> ((2 * BIT_LEN) - 1)); // (a * b) * 2 의 carry (1 or 0)
+	t <<= 1;
+	r[1] = (UNWORD)(t >> BIT_LEN);
+	r[0] = (UNWORD)t;
+#else
 	UNWORD tmp_h, tmp_l;
 	
 	// WORD 단위 곱셈
@@ -251,6 +221,7 @@ void UW_Mul2(UNWORD *r, const UNWORD a, const UNWORD b)
 	r[2] = (tmp_h < r[1]); // carry of r[1] (1 or 0)
 	r[1] = tmp_h + (tmp_l < r[0]); // r[1] + carry of r[0]
 	r[0] = tmp_l;
+#endif
 }
 
 /**
@@ -265,6 +236,12 @@ void UW_Mul2(UNWORD *r, const UNWORD a, const UNWORD b)
  */
 void UW_Sqr(UNWORD *r, const UNWORD a)
 {	
+#if defined(UDWORD)
+	UDWORD t = (UDWORD)a * a;
+
+	r[0] = (UNWORD)t;
+	r[1] = (UNWORD)(t >> BIT_LEN);
+#else
 	UNWORD half_len = BIT_LEN / 2;
 	
 	UNWORD a_H = (a >> half_len);	// WORD 상위 절반 bit
@@ -285,4 +262,2207 @@ void UW_Sqr(UNWORD *r, const UNWORD a)
 	r[0] += (aH_bL << half_len);
 	if(r[0] < (aH_bL << half_len)) // carry 
 		r[1] += 1;
+#endif
+}
+
+/**
+ * @brief Multiply UNWORD array A by UNWORD b (row kernel)
+ * @details
+ * - r[0..n-1] = (a[0..n-1] * b) mod W^n, 상위 carry WORD 리턴 \n
+ * - BMI2 / ADX 지원 시 MULX + ADCX 어셈블리 (4 WORD unroll) \n
+ * - r == a 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) 배열 길이
+ * @param[in] UNWORD b (const)
+ * @return UNWORD carry
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Mul_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UNWORD c, lo, hi;
+	UNWORD n1 = n & 3;		// 앞쪽 1 WORD 씩 처리
+	UNWORD n4 = n >> 2;		// 4 WORD 단위 unroll
+
+	__asm__ (
+		"xorl	%k[c], %k[c]\n\t"			// c = 0, CF = OF = 0
+		"1:\n\t"
+		"jrcxz	2f\n\t"
+		"mulx	(%[a]), %[lo], %[hi]\n\t"
+		"adcx	%[c], %[lo]\n\t"
+		"movq	%[lo], (%[r])\n\t"
+		"movq	%[hi], %[c]\n\t"
+		"leaq	8(%[a]), %[a]\n\t"
+		"leaq	8(%[r]), %[r]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jmp	1b\n\t"
+		"2:\n\t"
+		"movq	%[n4], %%rcx\n\t"
+		"3:\n\t"
+		"jrcxz	4f\n\t"
+		"mulx	(%[a]), %[lo], %[hi]\n\t"
+		"adcx	%[c], %[lo]\n\t"
+		"movq	%[lo], (%[r])\n\t"
+		"mulx	8(%[a]), %[lo], %[c]\n\t"
+		"adcx	%[hi], %[lo]\n\t"
+		"movq	%[lo], 8(%[r])\n\t"
+		"mulx	16(%[a]), %[lo], %[hi]\n\t"
+		"adcx	%[c], %[lo]\n\t"
+		"movq	%[lo], 16(%[r])\n\t"
+		"mulx	24(%[a]), %[lo], %[c]\n\t"
+		"adcx	%[hi], %[lo]\n\t"
+		"movq	%[lo], 24(%[r])\n\t"
+		"leaq	32(%[a]), %[a]\n\t"
+		"leaq	32(%[r]), %[r]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jmp	3b\n\t"
+		"4:\n\t"
+		"movl	$0, %k[lo]\n\t"
+		"adcx	%[lo], %[c]\n\t"				// c += CF
+		: [r] "+&r" (r), [a] "+&r" (a), "+&c" (n1), [c] "=&r" (c), [lo] "=&r" (lo), [hi] "=&r" (hi)
+		: "d" (b), [n4] "r" (n4)
+		: "cc", "memory");
+	return c;
+#else
+	UNWORD i;
+	UNWORD c = 0;
+	UNWORD tmp[2];
+
+	for(i = 0 ; i < n ; i++)
+	{
+		UW_Mul(tmp, a[i], b);
+		tmp[0] += c;
+		c = tmp[1] + (tmp[0] < c);		// a * b + c < W^2 (carry 발생 X)
+		r[i] = tmp[0];
+	}
+	return c;
+#endif
+}
+
+/**
+ * @brief Multiply-Accumulate UNWORD array A by UNWORD b (row kernel)
+ * @details
+ * - r[0..n-1] += a[0..n-1] * b, 상위 carry WORD 리턴 \n
+ * - BMI2 / ADX 지원 시 MULX + ADCX / ADOX 두 개의 carry chain 사용 \n
+ * -- ADCX (CF) : r[i] + lo(a[i] * b) \n
+ * -- ADOX (OF) : + hi(a[i-1] * b) \n
+ * - 곱셈 기본 연산 (BN_Basic_Mul, BN_Sqr 의 각 row) \n
+ * @param[in,out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) 배열 길이
+ * @param[in] UNWORD b (const)
+ * @return UNWORD carry
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_AddMul_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UNWORD c, lo, hi;
+	UNWORD n1 = n & 3;
+	UNWORD n4 = n >> 2;
+
+	__asm__ (
+		"xorl	%k[c], %k[c]\n\t"			// c = 0, CF = OF = 0
+		"1:\n\t"
+		"jrcxz	2f\n\t"
+		"mulx	(%[a]), %[lo], %[hi]\n\t"
+		"adcx	(%[r]), %[lo]\n\t"
+		"adox	%[c], %[lo]\n\t"
+		"movq	%[lo], (%[r])\n\t"
+		"movq	%[hi], %[c]\n\t"
+		"leaq	8(%[a]), %[a]\n\t"
+		"leaq	8(%[r]), %[r]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jmp	1b\n\t"
+		"2:\n\t"
+		"movq	%[n4], %%rcx\n\t"
+		"3:\n\t"
+		"jrcxz	4f\n\t"
+		"mulx	(%[a]), %[lo], %[hi]\n\t"
+		"adcx	(%[r]), %[lo]\n\t"
+		"adox	%[c], %[lo]\n\t"
+		"movq	%[lo], (%[r])\n\t"
+		"mulx	8(%[a]), %[lo], %[c]\n\t"
+		"adcx	8(%[r]), %[lo]\n\t"
+		"adox	%[hi], %[lo]\n\t"
+		"movq	%[lo], 8(%[r])\n\t"
+		"mulx	16(%[a]), %[lo], %[hi]\n\t"
+		"adcx	16(%[r]), %[lo]\n\t"
+		"adox	%[c], %[lo]\n\t"
+		"movq	%[lo], 16(%[r])\n\t"
+		"mulx	24(%[a]), %[lo], %[c]\n\t"
+		"adcx	24(%[r]), %[lo]\n\t"
+		"adox	%[hi], %[lo]\n\t"
+		"movq	%[lo], 24(%[r])\n\t"
+		"leaq	32(%[a]), %[a]\n\t"
+		"leaq	32(%[r]), %[r]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jmp	3b\n\t"
+		"4:\n\t"
+		"movl	$0, %k[lo]\n\t"
+		"adcx	%[lo], %[c]\n\t"				// c += CF
+		"adox	%[lo], %[c]\n\t"				// c += OF
+		: [r] "+&r" (r), [a] "+&r" (a), "+&c" (n1), [c] "=&r" (c), [lo] "=&r" (lo), [hi] "=&r" (hi)
+		: "d" (b), [n4] "r" (n4)
+		: "cc", "memory");
+	return c;
+#else
+	UNWORD i;
+	UNWORD c = 0;
+	UNWORD tmp[2];
+
+	for(i = 0 ; i < n ; i++)
+	{
+		UW_Mul(tmp, a[i], b);
+		tmp[0] += c;
+		tmp[1] += (tmp[0] < c);
+		r[i] += tmp[0];
+		c = tmp[1] + (r[i] < tmp[0]);	// a * b + r + c < W^2 (carry 발생 X)
+	}
+	return c;
+#endif
+}
+
+/**
+ * @brief Multiply-Subtract UNWORD array A by UNWORD b (row kernel)
+ * @details
+ * - r[0..n-1] -= a[0..n-1] * b, 상위 borrow WORD 리턴 \n
+ * - BMI2 / ADX 지원 시 MULX + ADOX (곱셈 합) / ADCX (r + ~t + 1 형태 뺄셈) \n
+ * - 나눗셈, 리덕션에서 q * N 빼기 용도 \n
+ * @param[in,out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) 배열 길이
+ * @param[in] UNWORD b (const)
+ * @return UNWORD borrow
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_SubMul_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UNWORD c, lo, hi;
+	UNWORD n1 = n & 3;
+	UNWORD n4 = n >> 2;
+
+	__asm__ (
+		"xorl	%k[c], %k[c]\n\t"			// c = 0, CF = OF = 0
+		"stc\n\t"						// CF = 1 (r + ~t + 1 = r - t)
+		"1:\n\t"
+		"jrcxz	2f\n\t"
+		"mulx	(%[a]), %[lo], %[hi]\n\t"
+		"adox	%[c], %[lo]\n\t"
+		"notq	%[lo]\n\t"
+		"adcx	(%[r]), %[lo]\n\t"
+		"movq	%[lo], (%[r])\n\t"
+		"movq	%[hi], %[c]\n\t"
+		"leaq	8(%[a]), %[a]\n\t"
+		"leaq	8(%[r]), %[r]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jmp	1b\n\t"
+		"2:\n\t"
+		"movq	%[n4], %%rcx\n\t"
+		"3:\n\t"
+		"jrcxz	4f\n\t"
+		"mulx	(%[a]), %[lo], %[hi]\n\t"
+		"adox	%[c], %[lo]\n\t"
+		"notq	%[lo]\n\t"
+		"adcx	(%[r]), %[lo]\n\t"
+		"movq	%[lo], (%[r])\n\t"
+		"mulx	8(%[a]), %[lo], %[c]\n\t"
+		"adox	%[hi], %[lo]\n\t"
+		"notq	%[lo]\n\t"
+		"adcx	8(%[r]), %[lo]\n\t"
+		"movq	%[lo], 8(%[r])\n\t"
+		"mulx	16(%[a]), %[lo], %[hi]\n\t"
+		"adox	%[c], %[lo]\n\t"
+		"notq	%[lo]\n\t"
+		"adcx	16(%[r]), %[lo]\n\t"
+		"movq	%[lo], 16(%[r])\n\t"
+		"mulx	24(%[a]), %[lo], %[c]\n\t"
+		"adox	%[hi], %[lo]\n\t"
+		"notq	%[lo]\n\t"
+		"adcx	24(%[r]), %[lo]\n\t"
+		"movq	%[lo], 24(%[r])\n\t"
+		"leaq	32(%[a]), %[a]\n\t"
+		"leaq	32(%[r]), %[r]\n\t"
+		"leaq	-1(%%rcx), %%rcx\n\t"
+		"jmp	3b\n\t"
+		"4:\n\t"
+		"movl	$0, %k[lo]\n\t"
+		"adox	%[lo], %[c]\n\t"				// c += OF
+		"cmc\n\t"
+		"adcx	%[lo], %[c]\n\t"				// c += (1 - CF)
+		: [r] "+&r" (r), [a] "+&r" (a), "+&c" (n1), [c] "=&r" (c), [lo] "=&r" (lo), [hi] "=&r" (hi)
+		: "d" (b), [n4] "r" (n4)
+		: "cc", "memory");
+	return c;
+#else
+	UNWORD i;
+	UNWORD c = 0;
+	UNWORD tmp[2];
+
+	for(i = 0 ; i < n ; i++)
+	{
+		UW_Mul(tmp, a[i], b);
+		tmp[0] += c;
+		c = tmp[1] + (tmp[0] < c);
+		c += (r[i] < tmp[0]);			// borrow
+		r[i] -= tmp[0];
+	}
+	return c;
+#endif
+}
+
+/**
+ * @brief Comba Multiplication of UNWORD array A and B (product-scanning)
+ * @details
+ * - r[0..na+nb-1] = a[0..na-1] * b[0..nb-1] \n
+ * - 결과 WORD 단위 (column) 로 곱을 모두 누적한 후 r[k] 에 한 번만 저장 \n
+ * - 누산기 3 WORD (c2|c1|c0) 는 레지스터에 유지, carry ripple 없음 \n
+ * - r 은 a, b 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const) (>= 1)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const) (>= 1)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Comba_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb)
+{
+	UNWORD i, k, lo, hi;
+	UNWORD c0 = 0, c1 = 0, c2 = 0;
+
+	for(k = 0 ; k < (na + nb - 1) ; k++)
+	{
+		// a[i] * b[k - i] 범위 : max(0, k - nb + 1) <= i <= min(k, na - 1)
+		lo = (k < nb) ? 0 : (k - nb + 1);
+		hi = (k < na) ? k : (na - 1);
+		for(i = lo ; i <= hi ; i++)
+			UW_MULADD(c0, c1, c2, a[i], b[k - i]);
+
+		r[k] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	}
+	r[k] = c0;
+}
+
+/**
+ * @brief Comba Square of UNWORD array A (product-scanning)
+ * @details
+ * - r[0..2n-1] = (a[0..n-1])^2 \n
+ * - column 마다 a[i] * a[j] (i < j) 를 따로 누적 후 2배, 대각선 a[k/2]^2 더함 \n
+ * - r 은 a 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) (>= 1)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Comba_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n)
+{
+	UNWORD i, k, lo;
+	UNWORD c0 = 0, c1 = 0, c2 = 0;
+	UNWORD t0, t1, t2;
+
+	for(k = 0 ; k < ((n << 1) - 1) ; k++)
+	{
+		lo = (k < n) ? 0 : (k - n + 1);
+
+		// 대각선 제외 (i < k - i)
+		t0 = t1 = t2 = 0;
+		for(i = lo ; i < (k - i) ; i++)
+			UW_MULADD(t0, t1, t2, a[i], a[k - i]);
+		UW_ADD2X3(c0, c1, c2, t0, t1, t2);
+
+		// 대각선 (k 짝수)
+		if((k & 1) == 0)
+			UW_MULADD(c0, c1, c2, a[k >> 1], a[k >> 1]);
+
+		r[k] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	}
+	r[k] = c0;
+}
+
+/**
+ * @brief Row Multiplication of UNWORD array A and B (operand-scanning)
+ * @details
+ * - r[0..na+nb-1] = a[0..na-1] * b[0..nb-1] \n
+ * - 첫 row 는 UW_Mul_1, 이후 row 는 UW_AddMul_1 (r 초기화 불필요) \n
+ * - r 은 a, b 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const) (>= 1)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const) (>= 1)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Row_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb)
+{
+	UNWORD i;
+
+	r[nb] = UW_Mul_1(r, b, nb, a[0]);
+	// carry 는 다음 row 시작 전 r[i + nb] 에 저장
+	for(i = 1 ; i < na ; i++)
+		r[i + nb] = UW_AddMul_1(r + i, b, nb, a[i]);
+}
+
+/**
+ * @brief Row Square of UNWORD array A (operand-scanning)
+ * @details
+ * - r[0..2n-1] = (a[0..n-1])^2 \n
+ * - 1) 대각선 제외 부분 sum(a[i] * a[j]) (i < j) 를 row kernel 로 계산 \n
+ * - 2) 2배 (1 bit shift) 와 대각선 a[i]^2 덧셈을 한 번에 처리 \n
+ * - r 은 a 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) (>= 1)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Row_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n)
+{
+	UNWORD i;
+	UNWORD carry, msb, w;
+	UNWORD tmp[2];
+
+	// 1) 대각선 제외 부분
+	r[0] = 0;
+	r[n] = UW_Mul_1(r + 1, a + 1, n - 1, a[0]);
+	for(i = 1 ; i + 1 < n ; i++)
+		r[n + i] = UW_AddMul_1(r + (i << 1) + 1, a + i + 1, n - 1 - i, a[i]);
+	r[(n << 1) - 1] = 0;
+
+	// 2) r = 2 * r + sum(a[i]^2)
+	msb = 0;
+	carry = 0;
+	for(i = 0 ; i < (n << 1) ; i++)
+	{
+		if((i & 1) == 0)
+			UW_Sqr(tmp, a[i >> 1]);		// tmp[1]|tmp[0] = a[i/2]^2
+
+		w = r[i];
+		r[i] = (w << 1) | msb;			// 2 * r (이전 WORD 최상위 bit)
+		msb = w >> (BIT_LEN - 1);
+
+		carry = UW_Addc(&r[i], r[i], tmp[i & 1], carry);
+	}
+}
+
+/**
+ * @brief Base case Multiplication of UNWORD array A and B
+ * @details
+ * - Karatsuba 등 재귀 곱셈의 기본 곱셈 \n
+ * - 기본 : Comba \n
+ * - MULX / ADX row kernel 사용 가능한 경우 : Row (측정 결과 Comba 보다 빠름) \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const) (>= 1)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const) (>= 1)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Base_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UW_Row_Mul(r, a, na, b, nb);
+#else
+	UW_Comba_Mul(r, a, na, b, nb);
+#endif
+}
+
+/**
+ * @brief Base case Square of UNWORD array A
+ * @details
+ * - 기본 : Comba \n
+ * - MULX / ADX row kernel 사용 가능한 경우 : Row \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) (>= 1)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Base_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UW_Row_Sqr(r, a, n);
+#else
+	UW_Comba_Sqr(r, a, n);
+#endif
+}
+
+/**
+ * @brief Final subtraction of Montgomery Reduction (constant-time)
+ * @details
+ * - r = (top, t[n..2n-1]) - m (top != 0 or t[n..2n-1] >= m) or t[n..2n-1] (값 < 2m) \n
+ * - t[0..n-1] - m 을 항상 계산 (하위 절반 t[0..n-1] 은 리덕션 후 쓰지 않으므로 임시 배열로 사용) \n
+ * - borrow 와 top 으로 mask 를 만들어 선택 (비교 / 분기 없음, 추가 뺄셈 여부로 지수 노출 X) \n
+ * - r 은 t + n 과 같아도 됨 \n
+ * @date 2026. 10. 18. \n
+ */
+static void UW_Mont_Final_Sub(UNWORD *r, UNWORD *t, const UNWORD *m, const UNWORD n, const UNWORD top)
+{
+	UNWORD i, mask;
+
+	// mask = 모두 1 (top = 1 or borrow = 0) or 0
+	mask = (UNWORD)0 - ((top | (UW_Sub_n(t, t + n, m, n) ^ 1)) & 1);
+	for(i = 0 ; i < n ; i++)
+		r[i] = (t[i] & mask) | (t[i + n] & ~mask);
+}
+
+/**
+ * @brief Montgomery Reduction of UNWORD array T
+ * @details
+ * - r = t * W^(-n) mod m (t < m * W^n, 2n WORD, t 는 임시 값으로 덮어씀) \n
+ * - WORD 마다 q = t[i] * m0 mod W, t += q * m * W^i (row kernel), 행 끝 carry 는 다음 행의 상위 WORD 로 \n
+ * - 결과 < 2m -> 마지막에 한 번만 뺄셈, UW_Mont_Final_Sub (항상 뺄셈 후 mask 선택) \n
+ * - r 은 t 의 상위 절반 (t + n) 과 같아도 됨 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in,out] UNWORD *t (2n WORD)
+ * @param[in] UNWORD *m (const) 홀수 모듈러
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD m0 (const) -m^(-1) mod W
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 조건부 뺄셈 분기 / UW_Cmp_n 조기 종료 -> constant-time 선택 \n
+ */
+void UW_Mont_Redc(UNWORD *r, UNWORD *t, const UNWORD *m, const UNWORD n, const UNWORD m0)
+{
+	UNWORD i, c;
+	UNWORD top = 0;	// (i + n) 번째 WORD 로 올라가는 carry
+
+	for(i = 0 ; i < n ; i++)
+	{
+		c = UW_AddMul_1(t + i, m, n, t[i] * m0);
+		top = UW_Addc(t + i + n, t[i + n], c, top);
+	}
+
+	UW_Mont_Final_Sub(r, t, m, n, top);
+}
+
+/**
+ * @brief Montgomery Multiplication of UNWORD array A and B (CIOS)
+ * @details
+ * - r = a * b * W^(-n) mod m (a, b < m) \n
+ * - Coarsely Integrated Operand Scanning : a 의 WORD 마다 곱셈 행 (t += a[i] * b) 과 리덕션 행 (t += q * m) 을 번갈아 수행 \n
+ * -- 누산 값은 항상 n + 2 WORD 이하 (t < 2m W^i), 한 WORD 씩 오른쪽 쉬프트 대신 시작 위치 (t + i) 이동 \n
+ * -- 행은 UW_AddMul_1 (BMI2 / ADX 지원 시 MULX + ADCX / ADOX) \n
+ * - 결과 < 2m -> 마지막에 한 번만 뺄셈, UW_Mont_Final_Sub (항상 뺄셈 후 mask 선택) \n
+ * - r 은 a, b 와 같아도 됨 (결과는 t 에서 마지막에 복사) \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD *m (const) 홀수 모듈러
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD m0 (const) -m^(-1) mod W
+ * @param[out] UNWORD *t 임시 배열 (2n + 1 WORD)
+ * @date 2026. 10. 17. \n
+ * @date 2026. 10. 18. 조건부 뺄셈 분기 / UW_Cmp_n 조기 종료 -> constant-time 선택 \n
+ */
+void UW_Mont_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD *m, const UNWORD n, const UNWORD m0, UNWORD *t)
+{
+	UNWORD i, c1, c2;
+	UNWORD top;
+
+	for(i = 0 ; i <= n ; i++)
+		t[i] = 0;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		// t[i..i+n] += a[i] * b, t[i..i+n] += q * m (t[i] = 0)
+		c1 = UW_AddMul_1(t + i, b, n, a[i]);
+		c2 = UW_AddMul_1(t + i, m, n, t[i] * m0);
+
+		// 두 행의 carry 를 (i + n) 번째 WORD 에 더하고, 넘침은 (i + n + 1) 번째 WORD 로
+		top = UW_Addc(t + i + n, t[i + n], c1, 0);
+		top += UW_Addc(t + i + n, t[i + n], c2, 0);
+		t[i + n + 1] = top;
+	}
+
+	UW_Mont_Final_Sub(r, t, m, n, t[n << 1]);
+}
+
+/**
+ * @brief Montgomery Squaring of UNWORD array A
+ * @details
+ * - r = a^2 * W^(-n) mod m (a < m) \n
+ * - 제곱 (UW_Base_Sqr, 대칭 곱셈 생략 -> 약 n^2 / 2 곱셈) 후 UW_Mont_Redc (n^2 곱셈) \n
+ * -- CIOS 로 섞으면 대칭 곱셈을 생략할 수 없어서 (2n^2 곱셈) 제곱 -> 리덕션 순서 사용 \n
+ * - r 은 a 와 같아도 됨 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *m (const) 홀수 모듈러
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD m0 (const) -m^(-1) mod W
+ * @param[out] UNWORD *t 임시 배열 (2n + 1 WORD)
+ * @date 2026. 10. 17. \n
+ */
+void UW_Mont_Sqr(UNWORD *r, const UNWORD *a, const UNWORD *m, const UNWORD n, const UNWORD m0, UNWORD *t)
+{
+	UW_Base_Sqr(t, a, n);
+	UW_Mont_Redc(r, t, m, n, m0);
+}
+
+/**
+ * @brief Add UNWORD array A and B
+ * @details
+ * - r[0..n-1] = a[0..n-1] + b[0..n-1], carry 리턴 \n
+ * - r == a or r == b 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD n (const)
+ * @return UNWORD carry (1 or 0)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Add_n(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n)
+{
+	UNWORD i;
+	UNWORD carry = 0;
+
+	for(i = 0 ; i < n ; i++)
+		carry = UW_Addc(&r[i], a[i], b[i], carry);
+	return carry;
+}
+
+/**
+ * @brief Subtract UNWORD array B from A
+ * @details
+ * - r[0..n-1] = a[0..n-1] - b[0..n-1], borrow 리턴 \n
+ * - r == a or r == b 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD n (const)
+ * @return UNWORD borrow (1 or 0)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Sub_n(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n)
+{
+	UNWORD i;
+	UNWORD borrow = 0;
+
+	for(i = 0 ; i < n ; i++)
+		borrow = UW_Subb(&r[i], a[i], b[i], borrow);
+	return borrow;
+}
+
+/**
+ * @brief Add UNWORD b to UNWORD array A
+ * @details
+ * - r[0..n-1] = a[0..n-1] + b, carry 리턴 (상위 WORD 로 carry 전파) \n
+ * - r == a 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD b (const)
+ * @return UNWORD carry (1 or 0)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Add_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b)
+{
+	UNWORD i;
+	UNWORD carry = b;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		carry = UW_Addc(&r[i], a[i], carry, 0);
+		if((carry == 0) && (r == a)) // 제자리 연산은 carry 없으면 종료
+			return 0;
+	}
+	return carry;
+}
+
+/**
+ * @brief Subtract UNWORD b from UNWORD array A
+ * @details
+ * - r[0..n-1] = a[0..n-1] - b, borrow 리턴 (상위 WORD 로 borrow 전파) \n
+ * - r == a 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD b (const)
+ * @return UNWORD borrow (1 or 0)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Sub_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b)
+{
+	UNWORD i;
+	UNWORD borrow = b;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		borrow = UW_Subb(&r[i], a[i], borrow, 0);
+		if((borrow == 0) && (r == a)) // 제자리 연산은 borrow 없으면 종료
+			return 0;
+	}
+	return borrow;
+}
+
+/**
+ * @brief Compare UNWORD array A to B
+ * @details
+ * - 같은 길이 n 의 WORD 배열 크기 비교 (최상위 WORD 부터) \n
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD n (const)
+ * @return LARGE(1), EQUAL(0), SMALL(-1)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD UW_Cmp_n(const UNWORD *a, const UNWORD *b, const UNWORD n)
+{
+	UNWORD i;
+
+	for(i = n ; i > 0 ; i--)
+		if(a[i - 1] != b[i - 1])
+			return (a[i - 1] > b[i - 1]) ? LARGE : SMALL;
+	return EQUAL;
+}
+
+/**
+ * @brief Absolute Subtract of UNWORD array A and B
+ * @details
+ * - r[0..n-1] = |a[0..n-1] - b[0..n-1]| \n
+ * - a < b 인 경우 1 리턴 (부호) \n
+ * - 뺄셈형 Karatsuba 의 |a0 - a1| 계산 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD n (const)
+ * @return UNWORD (a < b) ? 1 : 0
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Abs_Sub_n(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n)
+{
+	if(UW_Cmp_n(a, b, n) == SMALL)
+	{
+		UW_Sub_n(r, b, a, n);
+		return 1;
+	}
+	UW_Sub_n(r, a, b, n);
+	return 0;
+}
+
+/**
+ * @brief Left shift UNWORD array A by s bits
+ * @details
+ * - r[0..n-1] = a[0..n-1] << s (0 <= s < BIT_LEN), 밀려난 상위 s bit 리턴 (하위 정렬) \n
+ * - 상위 WORD 부터 계산 -> r == a 또는 r 이 a 보다 높은 주소 (WORD 이동 겸용) 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD s (const)
+ * @return UNWORD a[n-1] >> (BIT_LEN - s) (s == 0 이면 0)
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_LShift_n(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD s)
+{
+	UNWORD i, out;
+
+	if(n == 0)
+		return 0;
+	if(s == 0)
+	{
+		for(i = n ; i > 0 ; i--)
+			r[i - 1] = a[i - 1];
+		return 0;
+	}
+	out = a[n - 1] >> (BIT_LEN - s);
+	for(i = n - 1 ; i > 0 ; i--)
+		r[i] = (a[i] << s) | (a[i - 1] >> (BIT_LEN - s));
+	r[0] = a[0] << s;
+	return out;
+}
+
+/**
+ * @brief Right shift UNWORD array A by s bits
+ * @details
+ * - r[0..n-1] = a[0..n-1] >> s (0 <= s < BIT_LEN), 밀려난 하위 s bit 리턴 (하위 정렬) \n
+ * - 하위 WORD 부터 계산 -> r == a 또는 r 이 a 보다 낮은 주소 (WORD 이동 겸용) 가능 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD s (const)
+ * @return UNWORD a[0] mod 2^s
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_RShift_n(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD s)
+{
+	UNWORD i, out;
+
+	if(n == 0)
+		return 0;
+	if(s == 0)
+	{
+		for(i = 0 ; i < n ; i++)
+			r[i] = a[i];
+		return 0;
+	}
+	out = a[0] & (((UNWORD)1 << s) - 1);
+	for(i = 0 ; i + 1 < n ; i++)
+		r[i] = (a[i] >> s) | (a[i + 1] << (BIT_LEN - s));
+	r[n - 1] = a[n - 1] >> s;
+	return out;
+}
+
+/**
+ * @brief Reciprocal of normalized UNWORD d
+ * @details
+ * - v = Floor((W^2 - 1) / d) - W (d 의 최상위 bit 1), 2-by-1 나눗셈 (UW_Div_2by1) 의 몫 추정에 사용 \n
+ * - UDWORD : 2 WORD 나눗셈 1 번, 그 외 bit 단위 나눗셈 \n
+ * - Moller, Granlund, "Improved division by invariant integers" 참고 \n
+ * @param[in] UNWORD d (const)
+ * @return UNWORD v
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Reciprocal(const UNWORD d)
+{
+#if defined(UDWORD)
+	// (W^2 - 1) - W d = (~d) W + (W - 1)
+	return (UNWORD)(((((UDWORD)(UNWORD)~d) << BIT_LEN) | WORD_MASK) / d);
+#else
+	UNWORD i, top, q = 0, r = ~d;
+
+	for(i = 0 ; i < BIT_LEN ; i++)
+	{
+		top = r >> (BIT_LEN - 1);
+		r = (UNWORD)((r << 1) | 1);
+		q <<= 1;
+		if((top != 0) || (r >= d))
+		{
+			r -= d;
+			q |= 1;
+		}
+	}
+	return q;
+#endif
+}
+
+/**
+ * @brief 2-by-1 division with reciprocal
+ * @details
+ * - (u1 W + u0) = q d + r, 0 <= r < d (d 최상위 bit 1, u1 < d, v = UW_Reciprocal(d)) \n
+ * - 나눗셈 명령 없이 곱셈 1 번 + 보정 2 번 \n
+ * - Moller, Granlund, "Improved division by invariant integers" Algorithm 4 참고 \n
+ * @param[out] UNWORD *r 나머지
+ * @param[in] UNWORD u1 (const)
+ * @param[in] UNWORD u0 (const)
+ * @param[in] UNWORD d (const)
+ * @param[in] UNWORD v (const)
+ * @return UNWORD 몫
+ * @date 2026. 10. 17. \n
+ */
+static UNWORD UW_Div_2by1(UNWORD *r, const UNWORD u1, const UNWORD u0, const UNWORD d, const UNWORD v)
+{
+	UNWORD q[2], q0, q1, rem;
+
+	// (q1, q0) = v u1 + (u1, u0) + (1, 0)
+	UW_Mul(q, v, u1);
+	UW_Addc(&q1, q[1], u1, UW_Addc(&q0, q[0], u0, 0));
+	q1++;
+
+	rem = u0 - q1 * d;
+	if(rem > q0)
+	{
+		q1--;
+		rem += d;
+	}
+	if(rem >= d)
+	{
+		q1++;
+		rem -= d;
+	}
+
+	*r = rem;
+	return q1;
+}
+
+/**
+ * @brief Divide UNWORD array A by UNWORD d
+ * @details
+ * - q[0..n-1] = Floor(a / d), 나머지 리턴 (d != 0) \n
+ * - d 를 정규화 (최상위 bit 1) 후 WORD 마다 UW_Div_2by1 \n
+ * - q == a 가능, q 가 NULL 이면 나머지만 계산 \n
+ * @param[out] UNWORD *q
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD d (const)
+ * @return UNWORD a mod d
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Div_1(UNWORD *q, const UNWORD *a, const UNWORD n, const UNWORD d)
+{
+	UNWORD i, u, qi, r = 0;
+	UNWORD s = UW_Clz(d);
+	UNWORD dn = d << s;
+	UNWORD v = UW_Reciprocal(dn);
+
+	// (r, a[i]) << s 를 dn 으로 나눔 (r < dn)
+	for(i = n ; i > 0 ; i--)
+	{
+		u = a[i - 1];
+		if(s != 0)
+		{
+			r |= u >> (BIT_LEN - s);
+			u <<= s;
+		}
+		qi = UW_Div_2by1(&r, r, u, dn, v);
+		if(q != NULL)
+			q[i - 1] = qi;
+	}
+
+	return r >> s;
+}
+
+/**
+ * @brief Divide UNWORD array A by UNWORD array D (long division)
+ * @details
+ * - a = q d + r, 0 <= r < d (na >= nd >= 1, d[nd-1] != 0) \n
+ * - q : na - nd + 1 WORD, r : nd WORD (q, r 는 NULL 가능, 한 쪽만 계산) \n
+ * - d 최상위 bit 가 1 이 되도록 a, d 를 shift (정규화) 후 상위 WORD 부터 몫 한 WORD 씩 \n
+ * - 몫 추정 : 상위 2 WORD / d 최상위 WORD (UW_Div_2by1, 역수 한 번 계산), d 다음 WORD 로 보정 (최대 2 번) \n
+ * - q * d 뺄셈 (UW_SubMul_1) 후 음수면 d 한 번 더하기 (확률 ~ 2 / W) \n
+ * - 임시 배열 t : UW_DIV_SCRATCH(na, nd) WORD (정규화된 a (na + 1), d (nd)) \n
+ * - Knuth, TAOCP Vol. 2 Algorithm 4.3.1 D 참고 \n
+ * @param[out] UNWORD *q
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const)
+ * @param[in] UNWORD *d (const)
+ * @param[in] UNWORD nd (const)
+ * @param[out] UNWORD *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_Div_n(UNWORD *q, UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *d, const UNWORD nd, UNWORD *t)
+{
+	UNWORD i, j, qh, rh, d1, d0, v, s, u2, b, ovf;
+	UNWORD p[2];
+	UNWORD *un = t, *dn = t + na + 1;
+
+	if(nd == 1)
+	{
+		rh = UW_Div_1(q, a, na, d[0]);
+		if(r != NULL)
+			r[0] = rh;
+		return;
+	}
+
+	// 정규화 : dn = d << s, un = a << s (na + 1 WORD)
+	s = UW_Clz(d[nd - 1]);
+	UW_LShift_n(dn, d, nd, s);
+	un[na] = UW_LShift_n(un, a, na, s);
+	d1 = dn[nd - 1];
+	d0 = dn[nd - 2];
+	v = UW_Reciprocal(d1);
+
+	for(j = na - nd + 1 ; j-- > 0 ; )
+	{
+		// 몫 추정 qh = Floor((un[j+nd] W + un[j+nd-1]) / d1) (<= W - 1), 나머지 rh
+		u2 = un[j + nd];
+		if(u2 >= d1)
+		{
+			qh = WORD_MASK;
+			rh = un[j + nd - 1] + d1;
+			ovf = (rh < d1);
+		}
+		else
+		{
+			qh = UW_Div_2by1(&rh, u2, un[j + nd - 1], d1, v);
+			ovf = 0;
+		}
+
+		// qh d0 > rh W + un[j+nd-2] 이면 qh 가 큼 -> qh - 1 (rh 가 W 이상이면 종료)
+		while(ovf == 0)
+		{
+			UW_Mul(p, qh, d0);
+			if((p[1] < rh) || ((p[1] == rh) && (p[0] <= un[j + nd - 2])))
+				break;
+			qh--;
+			rh += d1;
+			ovf = (rh < d1);
+		}
+
+		// un[j..j+nd] -= qh dn, 음수면 dn 더하기
+		b = UW_SubMul_1(un + j, dn, nd, qh);
+		un[j + nd] = u2 - b;
+		if(u2 < b)
+		{
+			qh--;
+			un[j + nd] += UW_Add_n(un + j, un + j, dn, nd);
+		}
+		if(q != NULL)
+			q[j] = qh;
+	}
+
+	// r = un[0..nd-1] >> s
+	if(r != NULL)
+		UW_RShift_n(r, un, nd, s);
+	for(i = 0 ; i < na + nd + 1 ; i++)
+		t[i] = 0;
+}
+
+/**
+ * @brief Power of 2 modulo UNWORD array D
+ * @details
+ * - r = 2^e mod d (nd >= 1, d[nd-1] != 0), Montgomery 상수 R mod N, R^2 mod N 계산용 \n
+ * - 2^e 를 t 에 만든 후 UW_Div_n 나머지 (e 번 2 배 반복 X) \n
+ * - 임시 배열 t : UW_POW2_SCRATCH(e, nd) WORD \n
+ * @param[out] UNWORD *r (nd WORD)
+ * @param[in] UNWORD e (const)
+ * @param[in] UNWORD *d (const)
+ * @param[in] UNWORD nd (const)
+ * @param[out] UNWORD *t 임시 배열
+ * @date 2026. 10. 18. \n
+ */
+void UW_Pow2_Mod(UNWORD *r, const UNWORD e, const UNWORD *d, const UNWORD nd, UNWORD *t)
+{
+	UNWORD i, na = UW_POW2_LEN(e, nd);
+
+	for(i = 0 ; i < na ; i++)
+		t[i] = 0;
+	t[e >> WORD_SHIFT] = (UNWORD)1 << (e & (BIT_LEN - 1));
+	UW_Div_n(NULL, r, t, na, d, nd, t + na);
+}
+
+/**
+ * @brief Montgomery constants of UNWORD array N
+ * @details
+ * - 홀수 모듈러 n (nw WORD, n[nw-1] != 0), R = 2^rbits 인 Montgomery 상수 계산 \n
+ * - 리턴 : -N^(-1) mod 2^64 (Newton 반복, N * N = 1 mod 8 -> 3 bit 부터 반복마다 2 배), radix 에 맞게 하위 bit 만 사용 \n
+ * - rr = R^2 mod N = 2^(2 rbits) mod N (UW_Pow2_Mod, rr = NULL 이면 생략) \n
+ * - BN_MONT (W^n), R52_MONT (2^(52n)), BN_VEC_MONT (2^(32 Digits)) 공통 \n
+ * - 임시 배열 t : UW_MONT_SETUP_SCRATCH(rbits, nw) WORD \n
+ * @param[out] UNWORD *rr (nw WORD)
+ * @param[in] UNWORD *n (const)
+ * @param[in] UNWORD nw (const)
+ * @param[in] UNWORD rbits (const)
+ * @param[out] UNWORD *t 임시 배열
+ * @return UNLONG -N^(-1) mod 2^64
+ * @date 2026. 10. 18. \n
+ */
+UNLONG UW_Mont_Setup(UNWORD *rr, const UNWORD *n, const UNWORD nw, const UNWORD rbits, UNWORD *t)
+{
+	UNWORD i;
+	UNLONG n0 = 0, inv;
+
+	// N mod 2^64
+	for(i = 0 ; (i < nw) && (i < (64 / BIT_LEN)) ; i++)
+		n0 |= (UNLONG)n[i] << (i * BIT_LEN);
+
+	inv = n0;
+	for(i = 0 ; i < 5 ; i++)
+		inv *= 2 - n0 * inv;
+
+	if(rr != NULL)
+		UW_Pow2_Mod(rr, 2 * rbits, n, nw, t);
+
+	return (UNLONG)0 - inv;
+}
+
+/**
+ * @brief 4-bit window of UNWORD array E
+ * @details
+ * - e 의 i 번째 4-bit window (bit 4i ~ 4i + 3), 고정 4-bit window 지수승 공통 \n
+ * - BIT_LEN 은 4 의 배수 -> window 가 WORD 경계에 걸치지 않음 \n
+ * @param[in] UNWORD *e (const)
+ * @param[in] UNWORD i (const)
+ * @return UNWORD window 값 (0 ~ 15)
+ * @date 2026. 10. 18. \n
+ */
+UNWORD UW_Window(const UNWORD *e, const UNWORD i)
+{
+	UNWORD pos = i << 2;
+
+	return (e[pos >> WORD_SHIFT] >> (pos & (BIT_LEN - 1))) & 0xF;
+}
+
+/**
+ * @brief Constant-time table lookup of UNWORD arrays
+ * @details
+ * - r = tb[idx] (n WORD 배열 cnt 개, tb[k] = tb + k * n) \n
+ * - 비밀 값 idx (지수 window 등) 에 따른 메모리 접근 차이 없도록 table 전체를 읽고 mask 로 선택 \n
+ * - mask = 0 - (k == idx) 는 비교 / 분기 없이 계산 \n
+ * @param[out] UNWORD *r (n WORD)
+ * @param[in] UNWORD *tb (const)
+ * @param[in] UNWORD n (const)
+ * @param[in] UNWORD cnt (const)
+ * @param[in] UNWORD idx (const)
+ * @date 2026. 10. 18. \n
+ */
+void UW_Select_n(UNWORD *r, const UNWORD *tb, const UNWORD n, const UNWORD cnt, const UNWORD idx)
+{
+	UNWORD i, k, d, mask;
+
+	for(i = 0 ; i < n ; i++)
+		r[i] = 0;
+	for(k = 0 ; k < cnt ; k++)
+	{
+		// d = 0 인 경우만 mask = WORD_MASK
+		d = k ^ idx;
+		mask = ((d | ((UNWORD)0 - d)) >> (BIT_LEN - 1)) - 1;
+		for(i = 0 ; i < n ; i++)
+			r[i] |= tb[k * n + i] & mask;
+	}
+}
+
+// host byte 순서를 아는 경우 WORD 단위 memcpy + UW_Bswap (-mmovbe 인 경우 load / store 와 합쳐서 movbe)
+#if defined(__BYTE_ORDER__)
+#define UW_BYTE_ORDER
+#endif
+
+// big endian byte 배열 p[0..UW_BYTES-1] -> WORD
+static UNWORD UW_Load_BE(const UCHAR *p)
+{
+	UNWORD w = 0;
+#if defined(UW_BYTE_ORDER)
+	memcpy(&w, p, UW_BYTES);
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	w = UW_Bswap(w);
+#endif
+#else
+	UNWORD k;
+	for(k = 0 ; k < UW_BYTES ; k++)
+		w = (UNWORD)((w << 8) | p[k]);
+#endif
+	return w;
+}
+
+// little endian byte 배열 p[0..UW_BYTES-1] -> WORD
+static UNWORD UW_Load_LE(const UCHAR *p)
+{
+	UNWORD w = 0;
+#if defined(UW_BYTE_ORDER)
+	memcpy(&w, p, UW_BYTES);
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	w = UW_Bswap(w);
+#endif
+#else
+	UNWORD k;
+	for(k = UW_BYTES ; k > 0 ; k--)
+		w = (UNWORD)((w << 8) | p[k - 1]);
+#endif
+	return w;
+}
+
+// WORD -> big endian byte 배열 p[0..UW_BYTES-1]
+static void UW_Store_BE(UCHAR *p, UNWORD w)
+{
+#if defined(UW_BYTE_ORDER)
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	w = UW_Bswap(w);
+#endif
+	memcpy(p, &w, UW_BYTES);
+#else
+	UNWORD k;
+	for(k = UW_BYTES ; k > 0 ; k--)
+	{
+		p[k - 1] = (UCHAR)w;
+		w = (UNWORD)(w >> 8);
+	}
+#endif
+}
+
+// WORD -> little endian byte 배열 p[0..UW_BYTES-1]
+static void UW_Store_LE(UCHAR *p, UNWORD w)
+{
+#if defined(UW_BYTE_ORDER)
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	w = UW_Bswap(w);
+#endif
+	memcpy(p, &w, UW_BYTES);
+#else
+	UNWORD k;
+	for(k = 0 ; k < UW_BYTES ; k++)
+	{
+		p[k] = (UCHAR)w;
+		w = (UNWORD)(w >> 8);
+	}
+#endif
+}
+
+/**
+ * @brief Big endian bytes to UNWORD array
+ * @details
+ * - r[0..n-1] = buf[0..len-1] (buf[0] 이 최상위 byte) \n
+ * - 하위 WORD 부터 UW_BYTES 씩 한 번에 읽기 (bswap / movbe), 남는 상위 byte 만 byte 단위 \n
+ * - n WORD 를 넘는 상위 byte 는 무시, 남는 상위 WORD 는 0 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD n (const)
+ * @param[in] UCHAR *buf (const)
+ * @param[in] UNWORD len (const) byte 개수
+ * @date 2026. 10. 17. \n
+ */
+void UW_From_Bytes(UNWORD *r, const UNWORD n, const UCHAR *buf, const UNWORD len)
+{
+	UNWORD i, k, w;
+	UNWORD m = len / UW_BYTES;		// 전체 WORD 개수
+	UNWORD rem = len % UW_BYTES;	// 최상위 WORD 의 byte 개수
+
+	for(i = 0 ; (i < m) && (i < n) ; i++)
+		r[i] = UW_Load_BE(buf + len - (i + 1) * UW_BYTES);
+	if((rem != 0) && (m < n))
+	{
+		w = 0;
+		for(k = 0 ; k < rem ; k++)
+			w = (UNWORD)((w << 8) | buf[k]);
+		r[i++] = w;
+	}
+	for( ; i < n ; i++)
+		r[i] = 0;
+}
+
+/**
+ * @brief Little endian bytes to UNWORD array
+ * @details
+ * - r[0..n-1] = buf[0..len-1] (buf[0] 이 최하위 byte) \n
+ * - UW_From_Bytes 와 동일, byte 순서만 반대 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD n (const)
+ * @param[in] UCHAR *buf (const)
+ * @param[in] UNWORD len (const) byte 개수
+ * @date 2026. 10. 17. \n
+ */
+void UW_From_Bytes_LE(UNWORD *r, const UNWORD n, const UCHAR *buf, const UNWORD len)
+{
+	UNWORD i, k, w;
+	UNWORD m = len / UW_BYTES;
+	UNWORD rem = len % UW_BYTES;
+
+	for(i = 0 ; (i < m) && (i < n) ; i++)
+		r[i] = UW_Load_LE(buf + i * UW_BYTES);
+	if((rem != 0) && (m < n))
+	{
+		w = 0;
+		for(k = rem ; k > 0 ; k--)
+			w = (UNWORD)((w << 8) | buf[m * UW_BYTES + k - 1]);
+		r[i++] = w;
+	}
+	for( ; i < n ; i++)
+		r[i] = 0;
+}
+
+/**
+ * @brief UNWORD array to big endian bytes (fixed width)
+ * @details
+ * - buf[0..len-1] = a[0..n-1] mod 2^(8 len) (buf[0] 이 최상위 byte) \n
+ * - 길이 len 고정 : 값보다 길면 상위 byte 0 채우기, 짧으면 상위 byte 버림 (호출 측에서 길이 확인) \n
+ * @param[out] UCHAR *buf
+ * @param[in] UNWORD len (const) byte 개수
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @date 2026. 10. 17. \n
+ */
+void UW_To_Bytes(UCHAR *buf, const UNWORD len, const UNWORD *a, const UNWORD n)
+{
+	UNWORD i, k, w;
+	UNWORD m = len / UW_BYTES;
+	UNWORD rem = len % UW_BYTES;
+
+	for(i = 0 ; i < m ; i++)
+		UW_Store_BE(buf + len - (i + 1) * UW_BYTES, (i < n) ? a[i] : 0);
+	if(rem != 0)
+	{
+		w = (m < n) ? a[m] : 0;
+		for(k = rem ; k > 0 ; k--)
+		{
+			buf[k - 1] = (UCHAR)w;
+			w = (UNWORD)(w >> 8);
+		}
+	}
+}
+
+/**
+ * @brief UNWORD array to little endian bytes (fixed width)
+ * @details
+ * - buf[0..len-1] = a[0..n-1] mod 2^(8 len) (buf[0] 이 최하위 byte) \n
+ * - UW_To_Bytes 와 동일, byte 순서만 반대 \n
+ * @param[out] UCHAR *buf
+ * @param[in] UNWORD len (const) byte 개수
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @date 2026. 10. 17. \n
+ */
+void UW_To_Bytes_LE(UCHAR *buf, const UNWORD len, const UNWORD *a, const UNWORD n)
+{
+	UNWORD i, k, w;
+	UNWORD m = len / UW_BYTES;
+	UNWORD rem = len % UW_BYTES;
+
+	for(i = 0 ; i < m ; i++)
+		UW_Store_LE(buf + i * UW_BYTES, (i < n) ? a[i] : 0);
+	if(rem != 0)
+	{
+		w = (m < n) ? a[m] : 0;
+		for(k = 0 ; k < rem ; k++)
+		{
+			buf[m * UW_BYTES + k] = (UCHAR)w;
+			w = (UNWORD)(w >> 8);
+		}
+	}
+}
+
+/**
+ * @brief Fixed width Comba Multiplication (unrolled)
+ * @details
+ * - 길이 n 이 상수인 곳에서만 호출 -> 반복문 완전 unroll (분기 없는 straight-line 코드) \n
+ * - 모든 (i, k) 반복 횟수를 n 으로 고정하고 범위 조건은 컴파일 시간에 제거 \n
+ * @date 2026. 10. 17. \n
+ */
+UW_FORCE_INLINE void UW_Fixed_Comba_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n)
+{
+	UNWORD i, k;
+	UNWORD c0 = 0, c1 = 0, c2 = 0;
+
+	UW_UNROLL
+	for(k = 0 ; k < ((n << 1) - 1) ; k++)
+	{
+		UW_UNROLL
+		for(i = 0 ; i < n ; i++)
+			if((i <= k) && ((k - i) < n))
+				UW_MULADD(c0, c1, c2, a[i], b[k - i]);
+
+		r[k] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	}
+	r[k] = c0;
+}
+
+/**
+ * @brief Fixed width Comba Square (unrolled)
+ * @details
+ * - UW_Fixed_Comba_Mul 과 동일하게 상수 길이 n 에서 완전 unroll \n
+ * @date 2026. 10. 17. \n
+ */
+UW_FORCE_INLINE void UW_Fixed_Comba_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n)
+{
+	UNWORD i, k;
+	UNWORD c0 = 0, c1 = 0, c2 = 0;
+	UNWORD t0, t1, t2;
+
+	UW_UNROLL
+	for(k = 0 ; k < ((n << 1) - 1) ; k++)
+	{
+		t0 = t1 = t2 = 0;
+		UW_UNROLL
+		for(i = 0 ; i < n ; i++)
+			if((i < (k - i)) && (i <= k) && ((k - i) < n))
+				UW_MULADD(t0, t1, t2, a[i], a[k - i]);
+		UW_ADD2X3(c0, c1, c2, t0, t1, t2);
+
+		if((k & 1) == 0)
+			UW_MULADD(c0, c1, c2, a[k >> 1], a[k >> 1]);
+
+		r[k] = c0;
+		c0 = c1;
+		c1 = c2;
+		c2 = 0;
+	}
+	r[k] = c0;
+}
+
+// 고정 길이 Karatsuba 의 기본 곱셈 (UW_FIXED_KARA_BASE WORD)
+// MULX / ADX 사용 가능하면 row kernel 이 unroll 된 Comba 보다 빠름
+static void UW_Fixed_Base_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UW_Row_Mul(r, a, UW_FIXED_KARA_BASE, b, UW_FIXED_KARA_BASE);
+#else
+	UW_Fixed_Comba_Mul(r, a, b, UW_FIXED_KARA_BASE);
+#endif
+}
+
+
+/**
+ * @brief Fixed width Karatsuba Multiplication (subtractive)
+ * @details
+ * - r[0..2n-1] = a[0..n-1] * b[0..n-1], n = UW_FIXED_KARA_BASE * 2^k \n
+ * - a * b = a1b1 W^2h + (a0b0 + a1b1 + (a0 - a1)(b1 - b0)) W^h + a0b0 \n
+ * - 모든 부분 곱이 h * h 크기 -> 기본 곱셈은 고정 길이 unroll 함수 \n
+ * - t : 임시 배열 (4n WORD) \n
+ * @date 2026. 10. 17. \n
+ */
+static void UW_Fixed_Kara_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n, UNWORD *t)
+{
+	UNWORD h = n >> 1;
+	UNWORD sa, sb, c;
+
+	if(n == UW_FIXED_KARA_BASE)
+	{
+		UW_Fixed_Base_Mul(r, a, b);
+		return;
+	}
+
+	// r = a1b1 | a0b0
+	UW_Fixed_Kara_Mul(r, a, b, h, t);
+	UW_Fixed_Kara_Mul(r + n, a + h, b + h, h, t);
+
+	// t[n..2n-1] = |a0 - a1| * |b1 - b0|
+	sa = UW_Abs_Sub_n(t, a, a + h, h);
+	sb = UW_Abs_Sub_n(t + h, b + h, b, h);
+	UW_Fixed_Kara_Mul(t + n, t, t + h, h, t + (n << 1));
+
+	// t[0..n-1] = a0b0 + a1b1 +- t[n..2n-1] (c : 상위 WORD)
+	c = UW_Add_n(t, r, r + n, n);
+	if(sa == sb)	// (a0 - a1)(b1 - b0) >= 0
+		c += UW_Add_n(t, t, t + n, n);
+	else
+		c -= UW_Sub_n(t, t, t + n, n);
+
+	// r += t * W^h
+	c += UW_Add_n(r + h, r + h, t, n);
+	UW_Add_1(r + h + n, r + h + n, h, c);
+}
+
+#if !defined(UW_ASM_MULX_ADX)
+// MULX / ADX 사용 가능하면 2048 / 4096-bit 제곱은 row kernel 제곱이 Karatsuba 보다 빠름 (측정)
+static void UW_Fixed_Base_Sqr(UNWORD *r, const UNWORD *a)
+{
+	UW_Fixed_Comba_Sqr(r, a, UW_FIXED_KARA_BASE);
+}
+
+/**
+ * @brief Fixed width Karatsuba Square
+ * @details
+ * - a^2 = a1^2 W^2h + (a0^2 + a1^2 - (a0 - a1)^2) W^h + a0^2 \n
+ * - t : 임시 배열 (4n WORD) \n
+ * @date 2026. 10. 17. \n
+ */
+static void UW_Fixed_Kara_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNWORD *t)
+{
+	UNWORD h = n >> 1;
+	UNWORD c;
+
+	if(n == UW_FIXED_KARA_BASE)
+	{
+		UW_Fixed_Base_Sqr(r, a);
+		return;
+	}
+
+	UW_Fixed_Kara_Sqr(r, a, h, t);
+	UW_Fixed_Kara_Sqr(r + n, a + h, h, t);
+
+	UW_Abs_Sub_n(t, a, a + h, h);
+	UW_Fixed_Kara_Sqr(t + n, t, h, t + (n << 1));
+
+	c = UW_Add_n(t, r, r + n, n);
+	c -= UW_Sub_n(t, t, t + n, n);
+
+	c += UW_Add_n(r + h, r + h, t, n);
+	UW_Add_1(r + h + n, r + h + n, h, c);
+}
+#endif
+
+/**
+ * @brief Fixed width Multiplication (P-256, P-384, P-521, RSA-2048, RSA-4096)
+ * @details
+ * - r[0..2n-1] = a[0..n-1] * b[0..n-1] \n
+ * - 256 / 384 / 521-bit : 완전 unroll 된 Comba \n
+ * - 2048 / 4096-bit : 고정 길이 Karatsuba (기본 곱셈 unroll, 길이 체크 없음) \n
+ * - r 은 a, b 와 겹치면 안됨 \n
+ * @date 2026. 10. 17. \n
+ */
+void UW_Fixed_Mul_256(UNWORD *r, const UNWORD *a, const UNWORD *b)
+{
+	UW_Fixed_Comba_Mul(r, a, b, UW_WORDS(256));
+}
+
+void UW_Fixed_Mul_384(UNWORD *r, const UNWORD *a, const UNWORD *b)
+{
+	UW_Fixed_Comba_Mul(r, a, b, UW_WORDS(384));
+}
+
+void UW_Fixed_Mul_521(UNWORD *r, const UNWORD *a, const UNWORD *b)
+{
+	UW_Fixed_Comba_Mul(r, a, b, UW_WORDS(521));
+}
+
+void UW_Fixed_Mul_2048(UNWORD *r, const UNWORD *a, const UNWORD *b)
+{
+	UNWORD t[4 * UW_WORDS(2048)];
+	UW_Fixed_Kara_Mul(r, a, b, UW_WORDS(2048), t);
+}
+
+void UW_Fixed_Mul_4096(UNWORD *r, const UNWORD *a, const UNWORD *b)
+{
+	UNWORD t[4 * UW_WORDS(4096)];
+	UW_Fixed_Kara_Mul(r, a, b, UW_WORDS(4096), t);
+}
+
+/**
+ * @brief Fixed width Square (P-256, P-384, P-521, RSA-2048, RSA-4096)
+ * @details
+ * - r[0..2n-1] = (a[0..n-1])^2 \n
+ * - 256 / 384 / 521-bit : 완전 unroll 된 Comba \n
+ * - 2048 / 4096-bit : 고정 길이 Karatsuba (MULX / ADX 사용 가능하면 row kernel 제곱) \n
+ * - r 은 a 와 겹치면 안됨 \n
+ * @date 2026. 10. 17. \n
+ */
+void UW_Fixed_Sqr_256(UNWORD *r, const UNWORD *a)
+{
+	UW_Fixed_Comba_Sqr(r, a, UW_WORDS(256));
+}
+
+void UW_Fixed_Sqr_384(UNWORD *r, const UNWORD *a)
+{
+	UW_Fixed_Comba_Sqr(r, a, UW_WORDS(384));
+}
+
+void UW_Fixed_Sqr_521(UNWORD *r, const UNWORD *a)
+{
+	UW_Fixed_Comba_Sqr(r, a, UW_WORDS(521));
+}
+
+void UW_Fixed_Sqr_2048(UNWORD *r, const UNWORD *a)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UW_Row_Sqr(r, a, UW_WORDS(2048));
+#else
+	UNWORD t[4 * UW_WORDS(2048)];
+	UW_Fixed_Kara_Sqr(r, a, UW_WORDS(2048), t);
+#endif
+}
+
+void UW_Fixed_Sqr_4096(UNWORD *r, const UNWORD *a)
+{
+#if defined(UW_ASM_MULX_ADX)
+	UW_Row_Sqr(r, a, UW_WORDS(4096));
+#else
+	UNWORD t[4 * UW_WORDS(4096)];
+	UW_Fixed_Kara_Sqr(r, a, UW_WORDS(4096), t);
+#endif
+}
+
+/**
+ * @brief Fixed width Multiplication Dispatcher
+ * @details
+ * - 길이 n 이 고정 길이 (256, 384, 521, 2048, 4096-bit) 중 하나면 해당 함수로 곱셈 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD n (const)
+ * @return TRUE (고정 길이 곱셈 수행) / FALSE (지원하지 않는 길이)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD UW_Fixed_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n)
+{
+	switch(n)
+	{
+	case UW_WORDS(256):		UW_Fixed_Mul_256(r, a, b);		return TRUE;
+	case UW_WORDS(384):		UW_Fixed_Mul_384(r, a, b);		return TRUE;
+	case UW_WORDS(521):		UW_Fixed_Mul_521(r, a, b);		return TRUE;
+	case UW_WORDS(2048):	UW_Fixed_Mul_2048(r, a, b);		return TRUE;
+	case UW_WORDS(4096):	UW_Fixed_Mul_4096(r, a, b);		return TRUE;
+	default:												return FALSE;
+	}
+}
+
+/**
+ * @brief Fixed width Square Dispatcher
+ * @details
+ * - 길이 n 이 고정 길이 (256, 384, 521, 2048, 4096-bit) 중 하나면 해당 함수로 제곱 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const)
+ * @return TRUE (고정 길이 제곱 수행) / FALSE (지원하지 않는 길이)
+ * @date 2026. 10. 17. \n
+ */
+SNWORD UW_Fixed_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n)
+{
+	switch(n)
+	{
+	case UW_WORDS(256):		UW_Fixed_Sqr_256(r, a);			return TRUE;
+	case UW_WORDS(384):		UW_Fixed_Sqr_384(r, a);			return TRUE;
+	case UW_WORDS(521):		UW_Fixed_Sqr_521(r, a);			return TRUE;
+	case UW_WORDS(2048):	UW_Fixed_Sqr_2048(r, a);		return TRUE;
+	case UW_WORDS(4096):	UW_Fixed_Sqr_4096(r, a);		return TRUE;
+	default:												return FALSE;
+	}
+}
+
+/**
+ * @brief Absolute Subtract of UNWORD array A (n WORD) and B (m WORD, m <= n)
+ * @details
+ * - r[0..n-1] = |a[0..n-1] - b[0..m-1]| (b 는 상위 WORD 0 으로 확장) \n
+ * - a < b 인 경우 1 리턴 \n
+ * @date 2026. 10. 17. \n
+ */
+static UNWORD UW_Abs_Sub_Pad(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD *b, const UNWORD m)
+{
+	UNWORD i;
+
+	// a 의 상위 (n - m) WORD 중 0 이 아닌 값 있으면 a > b
+	for(i = n ; i > m ; i--)
+		if(a[i - 1] != 0)
+			break;
+
+	if((i == m) && (UW_Cmp_n(a, b, m) == SMALL))
+	{
+		UW_Sub_n(r, b, a, m);
+		for(i = m ; i < n ; i++)
+			r[i] = 0;
+		return 1;
+	}
+	UW_Sub_1(r + m, a + m, n - m, UW_Sub_n(r, a, b, m));
+	return 0;
+}
+
+// 병렬 부분 곱 종류
+#define UW_PROD_KARA_MUL	0
+#define UW_PROD_KARA_SQR	1
+#define UW_PROD_TOOM_MUL	2
+#define UW_PROD_TOOM_SQR	3
+
+// 병렬 부분 곱 작업 : r = a * b (제곱은 b 무시), t == NULL 이면 작업 안에서 임시 배열 할당
+typedef struct _UW_PROD
+{
+	UNWORD			*r;
+	const UNWORD	*a;
+	UNWORD			na;
+	const UNWORD	*b;
+	UNWORD			nb;
+	UNWORD			*t;
+	SNWORD			alg;
+} UW_PROD;
+
+static void UW_Prod_Task(void *arg)
+{
+	UW_PROD *p = (UW_PROD *)arg;
+	UNWORD n = (p->na > p->nb) ? p->na : p->nb;
+	UNWORD *t = p->t;
+
+	if(t == NULL)
+	{
+		switch(p->alg)
+		{
+		case UW_PROD_KARA_MUL:	n = UW_Kara_Scratch_Size(n);		break;
+		case UW_PROD_KARA_SQR:	n = UW_Kara_Sqr_Scratch_Size(n);	break;
+		case UW_PROD_TOOM_MUL:	n = UW_Toom_Scratch_Size(n);		break;
+		default:				n = UW_Toom_Sqr_Scratch_Size(n);	break;
+		}
+		t = (UNWORD *)malloc((n + 1) * sizeof(UNWORD));
+	}
+
+	switch(p->alg)
+	{
+	case UW_PROD_KARA_MUL:	UW_Kara_Mul(p->r, p->a, p->na, p->b, p->nb, t);	break;
+	case UW_PROD_KARA_SQR:	UW_Kara_Sqr(p->r, p->a, p->na, t);					break;
+	case UW_PROD_TOOM_MUL:	UW_Toom_Mul(p->r, p->a, p->na, p->b, p->nb, t);	break;
+	default:				UW_Toom_Sqr(p->r, p->a, p->na, t);					break;
+	}
+
+	if(p->t == NULL)
+		free(t);
+}
+
+// 부분 곱 n 개 (n <= 7) 를 worker pool 에서 수행 (p[0] 은 호출 스레드가 수행)
+static void UW_Prod_Run(UW_PROD *p, const UNWORD n)
+{
+	UW_TASK task[7];
+	UNWORD i;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		task[i].Func = UW_Prod_Task;
+		task[i].Arg = &p[i];
+	}
+	UW_Pool_Run(task, n);
+}
+
+// Karatsuba 임시 배열 크기 : 각 단계 4 * ceil(n / 2) WORD, 재귀 깊이만큼 누적 (약 4n)
+static UNWORD UW_Kara_Size(const UNWORD n, const UNWORD threshold)
+{
+	UNWORD h, size = 0, len = n;
+
+	while(len >= threshold)
+	{
+		h = (len + 1) >> 1;
+		size += (h << 2);
+		len = h;
+	}
+	return size;
+}
+
+/**
+ * @brief Scratch size of UW_Kara_Mul
+ * @details
+ * - max(na, nb) <= n 인 UW_Kara_Mul 호출에 필요한 임시 배열 크기 (WORD 개수) \n
+ * @param[in] UNWORD n (const)
+ * @return UNWORD 임시 배열 WORD 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Kara_Scratch_Size(const UNWORD n)
+{
+	return UW_Kara_Size(n, KARA_THRESHOLD);
+}
+
+/**
+ * @brief Scratch size of UW_Kara_Sqr
+ * @details
+ * - 길이 n 인 UW_Kara_Sqr 호출에 필요한 임시 배열 크기 (WORD 개수) \n
+ * @param[in] UNWORD n (const)
+ * @return UNWORD 임시 배열 WORD 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Kara_Sqr_Scratch_Size(const UNWORD n)
+{
+	return UW_Kara_Size(n, KARA_SQR_THRESHOLD);
+}
+
+/**
+ * @brief Karatsuba Multiplication of UNWORD array A and B (allocation free)
+ * @details
+ * - r[0..na+nb-1] = a[0..na-1] * b[0..nb-1] \n
+ * - 메모리 할당 없음 : 임시 배열 t 는 호출하는 쪽에서 UW_Kara_Scratch_Size(max(na, nb)) WORD 할당 \n
+ * - 작은 쪽 길이 < KARA_THRESHOLD : 기본 곱셈 (UW_Base_Mul) \n
+ * - na >= 2 * nb 정도의 불균형 입력 : a 를 nb WORD 단위로 나누어 균형 곱셈 후 누적 \n
+ * - 그 외 : 뺄셈형 Karatsuba, h = ceil(na / 2) \n
+ *   a * b = a1b1 W^2h + (a0b0 + a1b1 + (a0 - a1)(b1 - b0)) W^h + a0b0 \n
+ * - 병렬 모드 (UW_Pool_Use(h)) : 부분 곱 3 개를 worker pool 에서 동시 수행 (a0b0, a1b1 은 작업별 임시 배열 할당) \n
+ * - r 은 a, b 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const) (>= 1)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const) (>= 1)
+ * @param[in] UNWORD *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_Kara_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNWORD *t)
+{
+	UNWORD h, la1, lb1, i, m, c, sa, sb;
+
+	// 항상 na >= nb
+	if(na < nb)
+	{
+		UW_Kara_Mul(r, b, nb, a, na, t);
+		return;
+	}
+
+	if(nb < KARA_THRESHOLD)
+	{
+		UW_Base_Mul(r, a, na, b, nb);
+		return;
+	}
+
+	h = (na + 1) >> 1;
+
+	// 불균형 입력 : a 를 nb WORD 씩 잘라서 곱셈 (b1 이 비는 경우)
+	if(nb <= h)
+	{
+		UW_Kara_Mul(r, a, nb, b, nb, t);
+		for(i = nb ; i < na ; i += nb)
+		{
+			m = ((na - i) < nb) ? (na - i) : nb;
+			// t[0..m+nb-1] = a[i..i+m-1] * b
+			UW_Kara_Mul(t, b, nb, a + i, m, t + (nb << 1));
+			// r[i..i+nb-1] += t 하위, r[i+nb..i+nb+m-1] = t 상위 + carry
+			c = UW_Add_n(r + i, r + i, t, nb);
+			UW_Add_1(r + i + nb, t + nb, m, c);
+		}
+		return;
+	}
+
+	la1 = na - h;
+	lb1 = nb - h;
+
+	if(UW_Pool_Use(h) == TRUE)
+	{
+		UW_PROD p[3] = {
+			{t + (h << 1), t, h, t + h, h, t + (h << 2), UW_PROD_KARA_MUL},
+			{r, a, h, b, h, NULL, UW_PROD_KARA_MUL},
+			{r + (h << 1), a + h, la1, b + h, lb1, NULL, UW_PROD_KARA_MUL}
+		};
+
+		// t[0..2h-1] = |a0 - a1| | |b1 - b0| 먼저 계산 후 부분 곱 3 개 동시 수행
+		sa = UW_Abs_Sub_Pad(t, a, h, a + h, la1);
+		sb = UW_Abs_Sub_Pad(t + h, b, h, b + h, lb1) ^ 1;
+		UW_Prod_Run(p, 3);
+	}
+	else
+	{
+		// r = a1b1 | a0b0
+		UW_Kara_Mul(r, a, h, b, h, t);
+		UW_Kara_Mul(r + (h << 1), a + h, la1, b + h, lb1, t);
+
+		// t[2h..4h-1] = |a0 - a1| * |b1 - b0|
+		sa = UW_Abs_Sub_Pad(t, a, h, a + h, la1);
+		sb = UW_Abs_Sub_Pad(t + h, b, h, b + h, lb1) ^ 1;
+		UW_Kara_Mul(t + (h << 1), t, h, t + h, h, t + (h << 2));
+	}
+
+	// t[0..2h-1] = a0b0 + a1b1 +- t[2h..4h-1] (c : 상위 WORD)
+	m = la1 + lb1;
+	c = UW_Add_n(t, r, r + (h << 1), m);
+	c = UW_Add_1(t + m, r + m, (h << 1) - m, c);
+	if(sa == sb)	// (a0 - a1)(b1 - b0) >= 0
+		c += UW_Add_n(t, t, t + (h << 1), (h << 1));
+	else
+		c -= UW_Sub_n(t, t, t + (h << 1), (h << 1));
+
+	// r += t * W^h
+	c += UW_Add_n(r + h, r + h, t, (h << 1));
+	UW_Add_1(r + 3 * h, r + 3 * h, na + nb - 3 * h, c);
+}
+
+/**
+ * @brief Karatsuba Square of UNWORD array A (allocation free)
+ * @details
+ * - r[0..2n-1] = (a[0..n-1])^2 \n
+ * - a^2 = a1^2 W^2h + (a0^2 + a1^2 - (a0 - a1)^2) W^h + a0^2, h = ceil(n / 2) \n
+ * - 부분 곱 3 개가 모두 제곱 (곱셈 대비 UNWORD 곱 수 감소) \n
+ * - n < KARA_SQR_THRESHOLD : 기본 제곱 (UW_Base_Sqr) \n
+ * - 병렬 모드 (UW_Pool_Use(h)) : 부분 제곱 3 개를 worker pool 에서 동시 수행 \n
+ * - 임시 배열 t 는 호출하는 쪽에서 UW_Kara_Sqr_Scratch_Size(n) WORD 할당 \n
+ * - r 은 a 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) (>= 1)
+ * @param[in] UNWORD *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_Kara_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNWORD *t)
+{
+	UNWORD h, l, c;
+
+	if(n < KARA_SQR_THRESHOLD)
+	{
+		UW_Base_Sqr(r, a, n);
+		return;
+	}
+
+	h = (n + 1) >> 1;
+	l = n - h;
+
+	if(UW_Pool_Use(h) == TRUE)
+	{
+		UW_PROD p[3] = {
+			{t + (h << 1), t, h, NULL, 0, t + (h << 2), UW_PROD_KARA_SQR},
+			{r, a, h, NULL, 0, NULL, UW_PROD_KARA_SQR},
+			{r + (h << 1), a + h, l, NULL, 0, NULL, UW_PROD_KARA_SQR}
+		};
+
+		// t[0..h-1] = |a0 - a1| 먼저 계산 후 부분 제곱 3 개 동시 수행
+		UW_Abs_Sub_Pad(t, a, h, a + h, l);
+		UW_Prod_Run(p, 3);
+	}
+	else
+	{
+		// r = a1^2 | a0^2
+		UW_Kara_Sqr(r, a, h, t);
+		UW_Kara_Sqr(r + (h << 1), a + h, l, t);
+
+		// t[2h..4h-1] = (a0 - a1)^2
+		UW_Abs_Sub_Pad(t, a, h, a + h, l);
+		UW_Kara_Sqr(t + (h << 1), t, h, t + (h << 2));
+	}
+
+	// t[0..2h-1] = a0^2 + a1^2 - (a0 - a1)^2 (c : 상위 WORD)
+	c = UW_Add_n(t, r, r + (h << 1), (l << 1));
+	c = UW_Add_1(t + (l << 1), r + (l << 1), ((h - l) << 1), c);
+	c -= UW_Sub_n(t, t, t + (h << 1), (h << 1));
+
+	// r += t * W^h
+	c += UW_Add_n(r + h, r + h, t, (h << 1));
+	UW_Add_1(r + 3 * h, r + 3 * h, (n << 1) - 3 * h, c);
+}
+
+// Toom-Cook 보조 함수 : 평가 / 보간 값은 고정 길이 2 의 보수 (mod W^n) 로 저장
+
+// r[0..n-1] = -a[0..n-1] (mod W^n), r == a 가능
+static void UW_Neg_n(UNWORD *r, const UNWORD *a, const UNWORD n)
+{
+	UNWORD i;
+
+	for(i = 0 ; i < n ; i++)
+		r[i] = ~a[i];
+	UW_Add_1(r, r, n, 1);
+}
+
+// 2 의 보수 a[0..n-1] 를 절댓값으로 변환, 음수였으면 1 리턴
+static UNWORD UW_Sign_Abs(UNWORD *a, const UNWORD n)
+{
+	if((a[n - 1] & WORD_MASK_MSB) == 0)
+		return 0;
+	UW_Neg_n(a, a, n);
+	return 1;
+}
+
+// x[0..n-1] += y[0..m-1] (mod W^n, m <= n)
+static void UW_Add_Pad(UNWORD *x, const UNWORD n, const UNWORD *y, const UNWORD m)
+{
+	UW_Add_1(x + m, x + m, n - m, UW_Add_n(x, x, y, m));
+}
+
+// x[0..n-1] -= y[0..m-1] (mod W^n, m <= n)
+static void UW_Sub_Pad(UNWORD *x, const UNWORD n, const UNWORD *y, const UNWORD m)
+{
+	UW_Sub_1(x + m, x + m, n - m, UW_Sub_n(x, x, y, m));
+}
+
+// x[0..n-1] += y[0..m-1] * d (mod W^n, m <= n)
+static void UW_AddMul_Pad(UNWORD *x, const UNWORD n, const UNWORD *y, const UNWORD m, const UNWORD d)
+{
+	UNWORD c = UW_AddMul_1(x, y, m, d);
+
+	if(m < n)
+		UW_Add_1(x + m, x + m, n - m, c);
+}
+
+// x[0..n-1] -= y[0..m-1] * d (mod W^n, m <= n)
+static void UW_SubMul_Pad(UNWORD *x, const UNWORD n, const UNWORD *y, const UNWORD m, const UNWORD d)
+{
+	UNWORD c = UW_SubMul_1(x, y, m, d);
+
+	if(m < n)
+		UW_Sub_1(x + m, x + m, n - m, c);
+}
+
+// 2 의 보수 x[0..n-1] 산술 오른쪽 shift (0 < s < BIT_LEN)
+static void UW_Sar_n(UNWORD *x, const UNWORD n, const UNWORD s)
+{
+	UNWORD i;
+
+	for(i = 0 ; i + 1 < n ; i++)
+		x[i] = (x[i] >> s) | (x[i + 1] << (BIT_LEN - s));
+	x[n - 1] = (UNWORD)((SNWORD)x[n - 1] >> s);
+}
+
+// x[0..n-1] /= d (홀수 d 로 나누어 떨어지는 경우만, 2 의 보수 가능)
+// q = (x - borrow) * d^(-1) mod W, 다음 borrow 는 q * d 의 상위 WORD
+static void UW_Divexact_1(UNWORD *x, const UNWORD n, const UNWORD d)
+{
+	UNWORD i, s, c = 0, inv = d;
+	UNWORD p[2];
+
+	// d^(-1) mod W (Newton, d * d = 1 mod 8 에서 시작해 매번 정확한 bit 수 2 배)
+	for(i = 3 ; i < BIT_LEN ; i <<= 1)
+		inv *= 2 - d * inv;
+
+	for(i = 0 ; i < n ; i++)
+	{
+		s = x[i];
+		x[i] = s - c;
+		c = (s < c);
+		x[i] *= inv;
+		UW_Mul(p, x[i], d);
+		c += p[1];
+	}
+}
+
+// x[0..rn-off-1] 범위 안에서 r[off..] += x[0..n-1] (범위 밖 WORD 는 0 이어야 함)
+static void UW_Add_At(UNWORD *r, const UNWORD rn, const UNWORD off, const UNWORD *x, const UNWORD n)
+{
+	UNWORD m = ((rn - off) < n) ? (rn - off) : n;
+	UNWORD c = UW_Add_n(r + off, r + off, x, m);
+
+	UW_Add_1(r + off + m, r + off + m, rn - off - m, c);
+}
+
+/**
+ * @brief Evaluate np-way split of UNWORD array A at point x
+ * @details
+ * - e[0..k] = a(x) = a0 + a1 x + ... (조각 k WORD, 마지막 조각 s WORD) \n
+ * - x = 1, -1, 2, -2 : 상위 조각부터 Horner \n
+ * - x = 0 : 1/2 점 (2^(np-1) a(1/2) = 2^(np-1) a0 + ... + a(np-1)), 하위 조각부터 Horner \n
+ * - 결과는 절댓값으로 저장, 음수면 1 리턴 \n
+ * @date 2026. 10. 17. \n
+ */
+static UNWORD UW_Toom_Eval(UNWORD *e, const UNWORD *a, const UNWORD k, const UNWORD np, const UNWORD s, const SNWORD x)
+{
+	UNWORD i;
+
+	if(x == 0)
+	{
+		for(i = 0 ; i < k ; i++)
+			e[i] = a[i];
+		e[k] = 0;
+		for(i = 1 ; i < np ; i++)
+		{
+			UW_Mul_1(e, e, k + 1, 2);
+			UW_Add_Pad(e, k + 1, a + i * k, (i == np - 1) ? s : k);
+		}
+		return 0;
+	}
+
+	for(i = 0 ; i < s ; i++)
+		e[i] = a[(np - 1) * k + i];
+	for( ; i <= k ; i++)
+		e[i] = 0;
+	for(i = np - 1 ; i > 0 ; i--)
+	{
+		UW_Mul_1(e, e, k + 1, (x < 0) ? (UNWORD)(-x) : (UNWORD)x);
+		if(x < 0)
+			UW_Neg_n(e, e, k + 1);
+		UW_Add_Pad(e, k + 1, a + (i - 1) * k, k);
+	}
+	return UW_Sign_Abs(e, k + 1);
+}
+
+// Toom 부분 곱 (제곱 / 곱셈)
+static void UW_Toom_Prod(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNWORD *t, const SNWORD sqr)
+{
+	if(sqr)
+		UW_Toom_Sqr(r, a, na, t);
+	else
+		UW_Toom_Mul(r, a, na, b, nb, t);
+}
+
+/**
+ * @brief Toom-3 / Toom-4 Multiplication core
+ * @details
+ * - a, b 를 np (3 or 4) 개 조각 (k = ceil(na / np) WORD) 으로 나누어 2np - 1 개 점에서 평가 후 보간 \n
+ * - Toom-3 : 0, 1, -1, 2, inf \n
+ * - Toom-4 : 0, 1, -1, 2, -2, 1/2, inf \n
+ * - v0, vinf 는 r 에 직접, 나머지 점의 곱은 t 에 L = 2k + 2 WORD 2 의 보수로 저장 \n
+ * - 보간 중 나눗셈은 2^i shift 와 3, 15 로 나누어 떨어지는 나눗셈 (UW_Divexact_1) 만 사용 \n
+ * - 임시 배열 : 2(np - 1) * L WORD + 부분 곱 임시 배열 \n
+ * - 병렬 모드 (UW_Pool_Use(k)) : 모든 점을 먼저 평가한 후 부분 곱 2np - 1 개를 worker pool 에서 동시 수행 \n
+ * @date 2026. 10. 17. \n
+ */
+static void UW_Toom_Core(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, const UNWORD np, UNWORD *t, const SNWORD sqr)
+{
+	static const SNWORD point[5] = {1, -1, 2, -2, 0};
+	UNWORD k = (na + np - 1) / np;
+	UNWORD L = (k << 1) + 2;
+	UNWORD s = na - (np - 1) * k;
+	UNWORD u = nb - (np - 1) * k;
+	UNWORD rn = na + nb;
+	UNWORD ni = s + u;						// vinf 길이
+	UNWORD *vi = r + ((np - 1) * k << 1);	// vinf
+	UNWORD *ea = t + (2 * np - 3) * L;		// 평가 값
+	UNWORD *eb = ea + k + 1;
+	UNWORD *w = t + (2 * np - 2) * L;		// 부분 곱 임시 배열
+	UNWORD *v1, *vm1, *v2, *vm2, *vh;
+	UNWORD i, sa, sb;
+
+	if(UW_Pool_Use(k) == TRUE)
+	{
+		UW_PROD p[7];
+		UNWORD sg[5];
+		UNWORD *e = (UNWORD *)malloc((2 * np - 3) * (k + 1) * 2 * sizeof(UNWORD));
+		SNWORD alg = sqr ? UW_PROD_TOOM_SQR : UW_PROD_TOOM_MUL;
+
+		// v0 (호출 스레드, 임시 배열 w 사용), vinf, 나머지 점 곱셈 (작업별 임시 배열 할당)
+		p[0] = (UW_PROD){r, a, k, b, k, w, alg};
+		p[1] = (UW_PROD){vi, a + (np - 1) * k, s, b + (np - 1) * k, u, NULL, alg};
+		for(i = 0 ; i < 2 * np - 3 ; i++)
+		{
+			ea = e + i * (k + 1) * 2;
+			eb = ea + k + 1;
+			sg[i] = UW_Toom_Eval(ea, a, k, np, s, point[i]);
+			if(!sqr)
+				sg[i] ^= UW_Toom_Eval(eb, b, k, np, u, point[i]);
+			p[i + 2] = (UW_PROD){t + i * L, ea, k + 1, eb, k + 1, NULL, alg};
+		}
+		UW_Prod_Run(p, 2 * np - 1);
+
+		for(i = 0 ; i < 2 * np - 3 ; i++)
+			if(sg[i] && !sqr)
+				UW_Neg_n(t + i * L, t + i * L, L);
+		free(e);
+	}
+	else
+	{
+		// v0 = a0 * b0, vinf = a(np-1) * b(np-1)
+		UW_Toom_Prod(r, a, k, b, k, t, sqr);
+		UW_Toom_Prod(vi, a + (np - 1) * k, s, b + (np - 1) * k, u, t, sqr);
+
+		// 나머지 점 곱셈 : t[iL..(i+1)L-1] = a(x) * b(x)
+		for(i = 0 ; i < 2 * np - 3 ; i++)
+		{
+			sa = UW_Toom_Eval(ea, a, k, np, s, point[i]);
+			if(sqr)
+			{
+				UW_Toom_Sqr(t + i * L, ea, k + 1, w);
+				continue;
+			}
+			sb = UW_Toom_Eval(eb, b, k, np, u, point[i]);
+			UW_Toom_Mul(t + i * L, ea, k + 1, eb, k + 1, w);
+			if(sa != sb)
+				UW_Neg_n(t + i * L, t + i * L, L);
+		}
+	}
+
+	v1 = t;
+	vm1 = t + L;
+	v2 = t + (L << 1);
+
+	if(np == 3)
+	{
+		// 보간 : vm1 = c1, v1 = c2, v2 = c3
+		UW_Sub_n(v2, v2, vm1, L);			// (v2 - vm1) / 3 = c1 + c2 + 3c3 + 5c4
+		UW_Divexact_1(v2, L, 3);
+		UW_Sub_n(vm1, v1, vm1, L);			// (v1 - vm1) / 2 = c1 + c3
+		UW_Sar_n(vm1, L, 1);
+		UW_Sub_Pad(v1, L, r, (k << 1));		// v1 - v0 = c1 + c2 + c3 + c4
+		UW_Sub_n(v2, v2, v1, L);			// c3 = (v2 - v1) / 2 - 2 vinf
+		UW_Sar_n(v2, L, 1);
+		UW_SubMul_Pad(v2, L, vi, ni, 2);
+		UW_Sub_n(v1, v1, vm1, L);			// c2 = v1 - vm1 - vinf
+		UW_Sub_Pad(v1, L, vi, ni);
+		UW_Sub_n(vm1, vm1, v2, L);			// c1 = vm1 - c3
+
+		for(i = (k << 1) ; i < (k << 2) ; i++)
+			r[i] = 0;
+		UW_Add_At(r, rn, k, vm1, L);
+		UW_Add_At(r, rn, (k << 1), v1, L);
+		UW_Add_At(r, rn, 3 * k, v2, L);
+		return;
+	}
+
+	vm2 = t + 3 * L;
+	vh = t + (L << 2);
+
+	// 보간 : vm1 = c1, v1 = c2, vm2 = c3, v2 = c4, vh = c5
+	UW_Sub_n(vm1, v1, vm1, L);				// O1 = (v1 - vm1) / 2 = c1 + c3 + c5
+	UW_Sar_n(vm1, L, 1);
+	UW_Sub_n(v1, v1, vm1, L);				// E1 = v1 - O1
+	UW_Sub_n(vm2, v2, vm2, L);				// O2 = (v2 - vm2) / 4 = c1 + 4c3 + 16c5
+	UW_Sar_n(vm2, L, 2);
+	UW_SubMul_Pad(v2, L, vm2, L, 2);		// E2 = v2 - 2 O2
+	UW_Sub_Pad(v1, L, r, (k << 1));			// s1 = E1 - v0 - vinf = c2 + c4
+	UW_Sub_Pad(v1, L, vi, ni);
+	UW_Sub_Pad(v2, L, r, (k << 1));			// s2 = (E2 - v0 - 64 vinf) / 4 = c2 + 4c4
+	UW_SubMul_Pad(v2, L, vi, ni, 64);
+	UW_Sar_n(v2, L, 2);
+	UW_Sub_n(v2, v2, v1, L);				// c4 = (s2 - s1) / 3
+	UW_Divexact_1(v2, L, 3);
+	UW_Sub_n(v1, v1, v2, L);				// c2 = s1 - c4
+	UW_SubMul_Pad(vh, L, r, (k << 1), 64);	// h = (vh - 64 v0 - 16 c2 - 4 c4 - vinf) / 2 = 16c1 + 4c3 + c5
+	UW_SubMul_Pad(vh, L, v1, L, 16);
+	UW_SubMul_Pad(vh, L, v2, L, 4);
+	UW_Sub_Pad(vh, L, vi, ni);
+	UW_Sar_n(vh, L, 1);
+	UW_Sub_n(vm2, vm2, vm1, L);				// P = (O2 - O1) / 3 = c3 + 5c5
+	UW_Divexact_1(vm2, L, 3);
+	UW_Sub_n(vh, vh, vm1, L);				// Q = (h - O1) / 3 = 5c1 + c3
+	UW_Divexact_1(vh, L, 3);
+	UW_AddMul_Pad(vh, L, vm2, L, 4);		// c5 = (Q + 4P - 5 O1) / 15
+	UW_SubMul_Pad(vh, L, vm1, L, 5);
+	UW_Divexact_1(vh, L, 15);
+	UW_SubMul_Pad(vm2, L, vh, L, 5);		// c3 = P - 5c5
+	UW_Sub_n(vm1, vm1, vm2, L);				// c1 = O1 - c3 - c5
+	UW_Sub_n(vm1, vm1, vh, L);
+
+	for(i = (k << 1) ; i < 6 * k ; i++)
+		r[i] = 0;
+	UW_Add_At(r, rn, k, vm1, L);
+	UW_Add_At(r, rn, (k << 1), v1, L);
+	UW_Add_At(r, rn, 3 * k, vm2, L);
+	UW_Add_At(r, rn, (k << 2), v2, L);
+	UW_Add_At(r, rn, 5 * k, vh, L);
+}
+
+/**
+ * @brief Scratch size of UW_Toom_Mul
+ * @details
+ * - max(na, nb) <= n 인 UW_Toom_Mul 호출에 필요한 임시 배열 크기 (WORD 개수) \n
+ * - Toom-3 : 4L + T(k + 1), Toom-4 : 6L + T(k + 1), 불균형 : 2nb + T(nb) \n
+ *   -> TOOM3_THRESHOLD 이상에서 8n + 64 로 제한됨 (귀납법) \n
+ * @param[in] UNWORD n (const)
+ * @return UNWORD 임시 배열 WORD 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Toom_Scratch_Size(const UNWORD n)
+{
+	if(n < TOOM3_THRESHOLD)
+		return UW_Kara_Scratch_Size(n);
+	return (n << 3) + 64;
+}
+
+/**
+ * @brief Scratch size of UW_Toom_Sqr
+ * @details
+ * - 길이 n 인 UW_Toom_Sqr 호출에 필요한 임시 배열 크기 (WORD 개수) \n
+ * @param[in] UNWORD n (const)
+ * @return UNWORD 임시 배열 WORD 개수
+ * @date 2026. 10. 17. \n
+ */
+UNWORD UW_Toom_Sqr_Scratch_Size(const UNWORD n)
+{
+	if(n < TOOM3_SQR_THRESHOLD)
+		return UW_Kara_Sqr_Scratch_Size(n);
+	return (n << 3) + 64;
+}
+
+/**
+ * @brief Toom-Cook Multiplication of UNWORD array A and B (allocation free)
+ * @details
+ * - r[0..na+nb-1] = a[0..na-1] * b[0..nb-1] \n
+ * - 작은 쪽 길이 < TOOM3_THRESHOLD : Karatsuba (UW_Kara_Mul) \n
+ * - 작은 쪽 길이 >= TOOM4_THRESHOLD : Toom-4, 그 외 Toom-3 \n
+ * - 불균형 입력 (b 가 a 의 상위 조각까지 닿지 않음) : a 를 nb WORD 단위로 나누어 곱셈 후 누적 \n
+ * - 임시 배열 t 는 호출하는 쪽에서 UW_Toom_Scratch_Size(max(na, nb)) WORD 할당 \n
+ * - r 은 a, b 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD na (const) (>= 1)
+ * @param[in] UNWORD *b (const)
+ * @param[in] UNWORD nb (const) (>= 1)
+ * @param[in] UNWORD *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_Toom_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNWORD *t)
+{
+	UNWORD i, m, c;
+
+	// 항상 na >= nb
+	if(na < nb)
+	{
+		UW_Toom_Mul(r, b, nb, a, na, t);
+		return;
+	}
+
+	if(nb < TOOM3_THRESHOLD)
+	{
+		UW_Kara_Mul(r, a, na, b, nb, t);
+		return;
+	}
+
+	if((nb >= TOOM4_THRESHOLD) && (nb > 3 * ((na + 3) >> 2)))
+	{
+		UW_Toom_Core(r, a, na, b, nb, 4, t, 0);
+		return;
+	}
+	if(nb > (((na + 2) / 3) << 1))
+	{
+		UW_Toom_Core(r, a, na, b, nb, 3, t, 0);
+		return;
+	}
+
+	// 불균형 입력 : a 를 nb WORD 씩 잘라서 곱셈
+	UW_Toom_Mul(r, a, nb, b, nb, t);
+	for(i = nb ; i < na ; i += nb)
+	{
+		m = ((na - i) < nb) ? (na - i) : nb;
+		UW_Toom_Mul(t, b, nb, a + i, m, t + (nb << 1));
+		c = UW_Add_n(r + i, r + i, t, nb);
+		UW_Add_1(r + i + nb, t + nb, m, c);
+	}
+}
+
+/**
+ * @brief Toom-Cook Square of UNWORD array A (allocation free)
+ * @details
+ * - r[0..2n-1] = (a[0..n-1])^2, 평가는 한 번, 부분 곱은 모두 제곱 \n
+ * - n < TOOM3_SQR_THRESHOLD : Karatsuba 제곱 (UW_Kara_Sqr) \n
+ * - n >= TOOM4_SQR_THRESHOLD : Toom-4, 그 외 Toom-3 \n
+ * - 임시 배열 t 는 호출하는 쪽에서 UW_Toom_Sqr_Scratch_Size(n) WORD 할당 \n
+ * - r 은 a 와 겹치면 안됨 \n
+ * @param[out] UNWORD *r
+ * @param[in] UNWORD *a (const)
+ * @param[in] UNWORD n (const) (>= 1)
+ * @param[in] UNWORD *t 임시 배열
+ * @date 2026. 10. 17. \n
+ */
+void UW_Toom_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNWORD *t)
+{
+	if(n < TOOM3_SQR_THRESHOLD)
+		UW_Kara_Sqr(r, a, n, t);
+	else if(n >= TOOM4_SQR_THRESHOLD)
+		UW_Toom_Core(r, a, n, a, n, 4, t, 1);
+	else
+		UW_Toom_Core(r, a, n, a, n, 3, t, 1);
 }
@@ -2,6 +2,39 @@
 #define _WORD_H_
 
 #include "config.h"
+#include "intrin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// x86-64 BMI2 (MULX) + ADX (ADCX / ADOX) 사용 가능한 경우 row kernel 어셈블리 사용
+#if (BIT_LEN == 64) && defined(__GNUC__) && defined(__x86_64__) && defined(__BMI2__) && defined(__ADX__)
+#define UW_ASM_MULX_ADX
+#endif
+
+// bit 길이 -> WORD 개수
+#define UW_WORDS(bits)			(((bits) + BIT_LEN - 1) / BIT_LEN)
+
+// UW_Div_n 임시 배열 WORD 개수 (정규화된 피제수 na + 1, 제수 nd)
+#define UW_DIV_SCRATCH(na, nd)	((na) + (nd) + 1)
+
+// UW_Pow2_Mod 임시 배열 WORD 개수 (2^e : max(Floor(e / W) + 1, nd) WORD + UW_Div_n 임시 배열)
+#define UW_POW2_LEN(e, nd)		(((((e) >> WORD_SHIFT) + 1) > (nd)) ? (((e) >> WORD_SHIFT) + 1) : (nd))
+#define UW_POW2_SCRATCH(e, nd)	(UW_POW2_LEN(e, nd) + UW_DIV_SCRATCH(UW_POW2_LEN(e, nd), nd))
+
+// UW_Mont_Setup 임시 배열 WORD 개수 (R = 2^rbits, R^2 = 2^(2 rbits))
+#define UW_MONT_SETUP_SCRATCH(rbits, nd)	UW_POW2_SCRATCH(2 * (rbits), nd)
+
+// WORD 1 개의 byte 개수
+#define UW_BYTES				(BIT_LEN / 8)
+
+// 고정 길이 Karatsuba 의 기본 곱셈 길이 (WORD 개수, 2048 / 4096-bit 곱셈, 측정값)
+#if defined(UW_ASM_MULX_ADX)
+#define UW_FIXED_KARA_BASE		32
+#else
+#define UW_FIXED_KARA_BASE		16
+#endif
 
 // Define Function 
 void UW_Mul(UNWORD *r, const UNWORD a, const UNWORD b);
@@ -9,7 +42,71 @@ void UW_Mul2(UNWORD *r, const UNWORD a, const UNWORD b);
 void UW_Sqr(UNWORD *r, const UNWORD a);
 void UW_BitSearch(UNWORD *msb_bit, const UNWORD A) ;
 
+UNWORD UW_Mul_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b);
+UNWORD UW_AddMul_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b);
+UNWORD UW_SubMul_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b);
+
+void UW_Comba_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb);
+void UW_Comba_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n);
+void UW_Row_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb);
+void UW_Row_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n);
+void UW_Base_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb);
+void UW_Base_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n);
+
+void UW_Mont_Redc(UNWORD *r, UNWORD *t, const UNWORD *m, const UNWORD n, const UNWORD m0);
+void UW_Mont_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD *m, const UNWORD n, const UNWORD m0, UNWORD *t);
+void UW_Mont_Sqr(UNWORD *r, const UNWORD *a, const UNWORD *m, const UNWORD n, const UNWORD m0, UNWORD *t);
+
+UNWORD UW_Add_n(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n);
+UNWORD UW_Sub_n(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n);
+UNWORD UW_Add_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b);
+UNWORD UW_Sub_1(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD b);
+SNWORD UW_Cmp_n(const UNWORD *a, const UNWORD *b, const UNWORD n);
+UNWORD UW_Abs_Sub_n(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n);
+UNWORD UW_LShift_n(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD s);
+UNWORD UW_RShift_n(UNWORD *r, const UNWORD *a, const UNWORD n, const UNWORD s);
+
+UNWORD UW_Reciprocal(const UNWORD d);
+UNWORD UW_Div_1(UNWORD *q, const UNWORD *a, const UNWORD n, const UNWORD d);
+void UW_Div_n(UNWORD *q, UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *d, const UNWORD nd, UNWORD *t);
+void UW_Pow2_Mod(UNWORD *r, const UNWORD e, const UNWORD *d, const UNWORD nd, UNWORD *t);
+UNLONG UW_Mont_Setup(UNWORD *rr, const UNWORD *n, const UNWORD nw, const UNWORD rbits, UNWORD *t);
+UNWORD UW_Window(const UNWORD *e, const UNWORD i);
+void UW_Select_n(UNWORD *r, const UNWORD *tb, const UNWORD n, const UNWORD cnt, const UNWORD idx);
+
+void UW_From_Bytes(UNWORD *r, const UNWORD n, const UCHAR *buf, const UNWORD len);
+void UW_From_Bytes_LE(UNWORD *r, const UNWORD n, const UCHAR *buf, const UNWORD len);
+void UW_To_Bytes(UCHAR *buf, const UNWORD len, const UNWORD *a, const UNWORD n);
+void UW_To_Bytes_LE(UCHAR *buf, const UNWORD len, const UNWORD *a, const UNWORD n);
+
+void UW_Fixed_Mul_256(UNWORD *r, const UNWORD *a, const UNWORD *b);
+void UW_Fixed_Mul_384(UNWORD *r, const UNWORD *a, const UNWORD *b);
+void UW_Fixed_Mul_521(UNWORD *r, const UNWORD *a, const UNWORD *b);
+void UW_Fixed_Mul_2048(UNWORD *r, const UNWORD *a, const UNWORD *b);
+void UW_Fixed_Mul_4096(UNWORD *r, const UNWORD *a, const UNWORD *b);
+void UW_Fixed_Sqr_256(UNWORD *r, const UNWORD *a);
+void UW_Fixed_Sqr_384(UNWORD *r, const UNWORD *a);
+void UW_Fixed_Sqr_521(UNWORD *r, const UNWORD *a);
+void UW_Fixed_Sqr_2048(UNWORD *r, const UNWORD *a);
+void UW_Fixed_Sqr_4096(UNWORD *r, const UNWORD *a);
+SNWORD UW_Fixed_Mul(UNWORD *r, const UNWORD *a, const UNWORD *b, const UNWORD n);
+SNWORD UW_Fixed_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n);
+
+UNWORD UW_Kara_Scratch_Size(const UNWORD n);
+void UW_Kara_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNWORD *t);
+UNWORD UW_Kara_Sqr_Scratch_Size(const UNWORD n);
+void UW_Kara_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNWORD *t);
+
+UNWORD UW_Toom_Scratch_Size(const UNWORD n);
+UNWORD UW_Toom_Sqr_Scratch_Size(const UNWORD n);
+void UW_Toom_Mul(UNWORD *r, const UNWORD *a, const UNWORD na, const UNWORD *b, const UNWORD nb, UNWORD *t);
+void UW_Toom_Sqr(UNWORD *r, const UNWORD *a, const UNWORD n, UNWORD *t);
+
 UNWORD UW_Div(const UNWORD a, const UNWORD wlen);
 UNWORD UW_Mod(const UNWORD a, const UNWORD wlen);
+
+#ifdef __cplusplus
+}
+#endif
 #else
 #endif